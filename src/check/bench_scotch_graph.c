@@ -0,0 +1,486 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_scotch_graph.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the driver of the        **/
+/**                sequential graph mapping, partitioning  **/
+/**                and ordering benchmarks. It outputs one **/
+/**                JSON object per run.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#ifndef COMMON_OS_WINDOWS
+#include <sys/resource.h>
+#endif /* COMMON_OS_WINDOWS */
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+/*+ Benchmark operations. +*/
+
+#define BENCHOPERMAP                'm'           /* Static mapping onto a 2D mesh   */
+#define BENCHOPERPART               'p'           /* Partitioning                    */
+#define BENCHOPERORDER              'o'           /* Sparse matrix ordering          */
+
+/*+ Default parameters. +*/
+
+#define BENCHPARTNBR                64            /* Default number of parts         */
+#define BENCHSEEDVAL                1             /* Default random seed             */
+
+static const char *         C_usageList[] = {
+  "bench_scotch_graph [<input graph file> [<output data file>]] <options>",
+  "  -a<oper>   : Benchmarked operation:",
+  "                 m  : static mapping onto a 2D mesh (default)",
+  "                 o  : sparse matrix ordering",
+  "                 p  : partitioning",
+  "  -h         : Display this help",
+  "  -n<name>   : Name of the graph in the output",
+  "  -p<nbr>    : Number of parts (default: 64)",
+  "  -s<val>    : Random seed (default: 1)",
+  "  -t<nbr>    : Number of threads (default: library default)",
+  NULL };
+
+/****************************************/
+/*                                      */
+/* These routines compute the quality   */
+/* metrics of partitions and orderings. */
+/*                                      */
+/****************************************/
+
+/* This routine computes the edge cut and the
+** load imbalance of the given partition.
+** It returns:
+** - 0   : if metrics computed.
+** - !0  : on error.
+*/
+
+static
+int
+benchPartView (
+const SCOTCH_Graph * const  grafptr,
+const SCOTCH_Num            partnbr,
+const SCOTCH_Num * const    parttab,
+double * const              cutvptr,
+double * const              imbvptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_Num *        loadtab;
+  SCOTCH_Num          loadsum;
+  SCOTCH_Num          loadmax;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          partnum;
+  double              cutval;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, NULL, &edgetab, &edlotab);
+
+  if ((loadtab = memAlloc (partnbr * sizeof (SCOTCH_Num))) == NULL) {
+    errorPrint ("benchPartView: out of memory");
+    return (1);
+  }
+  memSet (loadtab, 0, partnbr * sizeof (SCOTCH_Num));
+
+  for (vertnum = 0, loadsum = 0, cutval = 0.0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          partval;
+    SCOTCH_Num          veloval;
+    SCOTCH_Num          edgenum;
+
+    partval = parttab[vertnum];
+    veloval = (velotab != NULL) ? velotab[vertnum] : 1;
+    loadtab[partval] += veloval;
+    loadsum          += veloval;
+
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      if (parttab[edgetab[edgenum - baseval] - baseval] != partval)
+        cutval += (edlotab != NULL) ? (double) edlotab[edgenum - baseval] : 1.0;
+    }
+  }
+
+  for (partnum = 0, loadmax = 0; partnum < partnbr; partnum ++) {
+    if (loadtab[partnum] > loadmax)
+      loadmax = loadtab[partnum];
+  }
+
+  memFree (loadtab);
+
+  *cutvptr = cutval / 2.0;                        /* Each cut edge has been counted twice */
+  *imbvptr = (loadsum > 0) ? ((double) loadmax * (double) partnbr / (double) loadsum - 1.0) : 0.0;
+
+  return (0);
+}
+
+/* This routine computes the number of non-zeros
+** and the operation count of the Cholesky factor
+** of the matrix of the given graph, permuted
+** according to the given ordering, like gotst
+** does without vertex weights. The elimination
+** tree is built by path compression, and column
+** counts are obtained by traversing row subtrees,
+** in time linear in the number of non-zeros.
+** It returns:
+** - 0   : if metrics computed.
+** - !0  : on error.
+*/
+
+static
+int
+benchOrderView (
+const SCOTCH_Graph * const  grafptr,
+const SCOTCH_Num * const    permtab,
+const SCOTCH_Num * const    peritab,
+double * const              nnzvptr,
+double * const              opcvptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        fathtab;                    /* Father of column in elimination tree   */
+  SCOTCH_Num *        anctab;                     /* Compressed ancestor array              */
+  SCOTCH_Num *        flagtab;                    /* Row marker array for row subtrees      */
+  SCOTCH_Num *        cnnztab;                    /* Number of extra-diagonals per column   */
+  SCOTCH_Num          pcolnum;
+  double              nnzval;
+  double              opcval;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  if (memAllocGroup ((void **) (void *)
+                     &fathtab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &anctab,  (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &flagtab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &cnnztab, (size_t) (vertnbr * sizeof (SCOTCH_Num)), NULL) == NULL) {
+    errorPrint ("benchOrderView: out of memory");
+    return (1);
+  }
+
+  for (pcolnum = 0; pcolnum < vertnbr; pcolnum ++) { /* Build elimination tree */
+    SCOTCH_Num          icolnum;
+    SCOTCH_Num          edgenum;
+
+    fathtab[pcolnum] =
+    anctab[pcolnum]  = -1;
+    icolnum = peritab[pcolnum] - baseval;
+    for (edgenum = verttab[icolnum]; edgenum < vendtab[icolnum]; edgenum ++) {
+      SCOTCH_Num          prownum;
+
+      prownum = permtab[edgetab[edgenum - baseval] - baseval] - baseval;
+      while ((prownum != -1) && (prownum < pcolnum)) { /* Climb up to current root, compressing path */
+        SCOTCH_Num          prownxt;
+
+        prownxt = anctab[prownum];
+        anctab[prownum] = pcolnum;
+        if (prownxt == -1)
+          fathtab[prownum] = pcolnum;
+        prownum = prownxt;
+      }
+    }
+  }
+
+  memSet (cnnztab, 0, vertnbr * sizeof (SCOTCH_Num));
+  for (pcolnum = 0; pcolnum < vertnbr; pcolnum ++) { /* Traverse row subtree of every row */
+    SCOTCH_Num          icolnum;
+    SCOTCH_Num          edgenum;
+
+    flagtab[pcolnum] = pcolnum;
+    icolnum = peritab[pcolnum] - baseval;
+    for (edgenum = verttab[icolnum]; edgenum < vendtab[icolnum]; edgenum ++) {
+      SCOTCH_Num          prownum;
+
+      for (prownum = permtab[edgetab[edgenum - baseval] - baseval] - baseval;
+           (prownum < pcolnum) && (flagtab[prownum] != pcolnum); prownum = fathtab[prownum]) {
+        flagtab[prownum] = pcolnum;               /* Row pcolnum is in column prownum of factor */
+        cnnztab[prownum] ++;
+      }
+    }
+  }
+
+  for (pcolnum = 0, nnzval = opcval = 0.0; pcolnum < vertnbr; pcolnum ++) {
+    double              fnnzval;
+
+    fnnzval  = (double) cnnztab[pcolnum] + 1.0;   /* Extra-diagonals plus diagonal */
+    nnzval  += fnnzval;
+    opcval  += fnnzval * fnnzval;
+  }
+
+  memFree (fathtab);                              /* Free group leader */
+
+  *nnzvptr = nnzval;
+  *opcvptr = opcval;
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  FILE *              outfptr;
+  const char *        nameptr;
+  const char *        filenamtab[2];
+  int                 filenbr;
+  int                 opertype;
+  SCOTCH_Num          partnbr;
+  SCOTCH_Num          seedval;
+  int                 thrdnbr;
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        cogrdat;                    /* Context graph */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          edgenbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num *        peritab;
+  SCOTCH_Num          cblknbr;
+  SCOTCH_Num          xdimsiz;
+  SCOTCH_Idx          memmax;
+  Clock               runtime;
+  double              qualtab[2];                 /* Cut and imbalance, or NNZ and OPC */
+  int                 o;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  opertype = BENCHOPERMAP;
+  partnbr  = BENCHPARTNBR;
+  seedval  = BENCHSEEDVAL;
+  thrdnbr  = -1;
+  nameptr  = NULL;
+  filenamtab[0] =
+  filenamtab[1] = "-";
+  for (i = 1, filenbr = 0; i < argc; i ++) {
+    if ((argv[i][0] != '-') || (argv[i][1] == '\0')) { /* If found a file name */
+      if (filenbr >= 2) {
+        SCOTCH_errorPrint ("main: too many file names given");
+        exit (EXIT_FAILURE);
+      }
+      filenamtab[filenbr ++] = argv[i];
+      continue;
+    }
+    switch (argv[i][1]) {
+      case 'A' :
+      case 'a' :
+        opertype = argv[i][2];
+        if ((opertype != BENCHOPERMAP) && (opertype != BENCHOPERPART) && (opertype != BENCHOPERORDER)) {
+          SCOTCH_errorPrint ("main: invalid operation '%s'", argv[i]);
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'H' :
+      case 'h' :
+        usagePrint (stdout, C_usageList);
+        exit (EXIT_SUCCESS);
+      case 'N' :
+      case 'n' :
+        nameptr = &argv[i][2];
+        break;
+      case 'P' :
+      case 'p' :
+        if ((partnbr = (SCOTCH_Num) atol (&argv[i][2])) < 1) {
+          SCOTCH_errorPrint ("main: invalid number of parts '%s'", argv[i]);
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'S' :
+      case 's' :
+        seedval = (SCOTCH_Num) atol (&argv[i][2]);
+        break;
+      case 'T' :
+      case 't' :
+        if ((thrdnbr = atoi (&argv[i][2])) < 1) {
+          SCOTCH_errorPrint ("main: invalid number of threads '%s'", argv[i]);
+          exit (EXIT_FAILURE);
+        }
+        break;
+      default :
+        SCOTCH_errorPrint ("main: unprocessed option '%s'", argv[i]);
+        exit (EXIT_FAILURE);
+    }
+  }
+  if (nameptr == NULL)
+    nameptr = filenamtab[0];
+
+  if ((fileptr = (strcmp (filenamtab[0], "-") == 0) ? stdin : fopen (filenamtab[0], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+  if ((outfptr = (strcmp (filenamtab[1], "-") == 0) ? stdout : fopen (filenamtab[1], "a")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open output file");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+  if (fileptr != stdin)
+    fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, &edgenbr);
+  if (memAllocGroup ((void **) (void *)
+                     &parttab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &permtab, (size_t) (vertnbr * sizeof (SCOTCH_Num)),
+                     &peritab, (size_t) (vertnbr * sizeof (SCOTCH_Num)), NULL) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_contextInit (&contdat);                  /* Fixed seed, deterministic behavior */
+  if ((SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1) != 0) ||
+      (SCOTCH_contextRandomClone (&contdat) != 0) ||
+      ((thrdnbr > 0) && (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0))) {
+    SCOTCH_errorPrint ("main: cannot initialize context");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_contextRandomSeed (&contdat, seedval);
+  SCOTCH_graphInit (&cogrdat);
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind context");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);
+
+  clockInit  (&runtime);
+  clockStart (&runtime);
+
+  switch (opertype) {
+    case BENCHOPERMAP :
+      for (xdimsiz = 1; (xdimsiz + 1) * (xdimsiz + 1) <= partnbr; xdimsiz ++) ; /* Find most square 2D mesh of partnbr domains */
+      while ((partnbr % xdimsiz) != 0)
+        xdimsiz --;
+      SCOTCH_archInit  (&archdat);
+      SCOTCH_archMesh2 (&archdat, xdimsiz, partnbr / xdimsiz);
+      o = SCOTCH_graphMap (&cogrdat, &archdat, &stradat, parttab);
+      SCOTCH_archExit  (&archdat);
+      break;
+    case BENCHOPERPART :
+      o = SCOTCH_graphPart (&cogrdat, partnbr, &stradat, parttab);
+      break;
+    default :
+      o = SCOTCH_graphOrder (&cogrdat, &stradat, permtab, peritab, &cblknbr, NULL, NULL);
+      break;
+  }
+
+  clockStop (&runtime);
+  memmax = SCOTCH_memMax ();                      /* Negative if memory tracing not enabled */
+#ifndef COMMON_OS_WINDOWS
+  if (memmax < 0) {                               /* Else, use peak resident set size of process */
+    struct rusage       rusadat;
+
+    if (getrusage (RUSAGE_SELF, &rusadat) == 0)
+#ifdef __APPLE__
+      memmax = (SCOTCH_Idx) rusadat.ru_maxrss;    /* Size already in bytes */
+#else /* __APPLE__ */
+      memmax = (SCOTCH_Idx) rusadat.ru_maxrss * 1024; /* Size in kilobytes */
+#endif /* __APPLE__ */
+  }
+#endif /* COMMON_OS_WINDOWS */
+
+  if (o != 0) {
+    SCOTCH_errorPrint ("main: cannot compute %s", (opertype == BENCHOPERORDER) ? "ordering" : "partition");
+    exit (EXIT_FAILURE);
+  }
+
+  o = (opertype == BENCHOPERORDER)
+      ? benchOrderView (&grafdat, permtab, peritab, &qualtab[0], &qualtab[1])
+      : benchPartView  (&grafdat, partnbr, parttab, &qualtab[0], &qualtab[1]);
+  if (o != 0)
+    exit (EXIT_FAILURE);
+
+  fprintf (outfptr, "{ \"graph\": \"%s\", \"vertices\": " SCOTCH_NUMSTRING ", \"edges\": " SCOTCH_NUMSTRING ", \"operation\": \"%s\", ",
+           nameptr, vertnbr, edgenbr / 2,
+           (opertype == BENCHOPERMAP) ? "map" : ((opertype == BENCHOPERPART) ? "part" : "order"));
+  if (thrdnbr > 0)
+    fprintf (outfptr, "\"threads\": %d, ", thrdnbr);
+  else
+    fprintf (outfptr, "\"threads\": null, ");
+  fprintf (outfptr, "\"seed\": " SCOTCH_NUMSTRING ", \"time\": %g, ",
+           seedval, (double) clockVal (&runtime));
+  if (memmax >= 0)
+    fprintf (outfptr, "\"memmax\": %ld, ", (long) memmax);
+  else
+    fprintf (outfptr, "\"memmax\": null, ");
+  if (opertype == BENCHOPERORDER)
+    fprintf (outfptr, "\"blocks\": " SCOTCH_NUMSTRING ", \"nnz\": %.17g, \"opc\": %.17g }\n",
+             cblknbr, qualtab[0], qualtab[1]);
+  else
+    fprintf (outfptr, "\"parts\": " SCOTCH_NUMSTRING ", \"cut\": %.17g, \"imbalance\": %g }\n",
+             partnbr, qualtab[0], qualtab[1]);
+
+  if (outfptr != stdout)
+    fclose (outfptr);
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&cogrdat);
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_graphExit   (&grafdat);
+  memFree (parttab);                              /* Free group leader */
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,312 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_bgraph_cost.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests and benchmarks the    **/
+/**                bipartition cost and gain kernels.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/arch.h"
+#include "../libscotch/bgraph.h"
+
+#include "scotch.h"
+
+#define TESTPARTNBR                 8             /* Number of random part arrays to check */
+
+/*************************/
+/*                       */
+/* The service routines. */
+/*                       */
+/*************************/
+
+/* This routine computes the cost of the
+** current partition of the given graph by
+** scanning its edges one at a time.
+** It returns:
+** - the sum of all vertex gains, in all cases.
+*/
+
+static
+Gnum
+testCostRef (
+const Bgraph * const        grafptr,
+Gnum * const                cuttab,               /* Array of numbers of cut edges, or NULL */
+Gnum * const                gaintab,              /* Array of vertex gains, or NULL         */
+Gnum * const                fnbrptr,
+Gnum * const                cmliptr)
+{
+  Gnum                vertnum;
+  Gnum                fronnbr;
+  Gnum                commload;
+  Gnum                gainsum;
+
+  const Gnum * restrict const       verttax = grafptr->s.verttax;
+  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const       edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const       edlotax = grafptr->s.edlotax;
+  const GraphPart * restrict const  parttax = grafptr->parttax;
+
+  for (vertnum = grafptr->s.baseval, fronnbr = commload = gainsum = 0;
+       vertnum < grafptr->s.vertnnd; vertnum ++) {
+    Gnum                edgenum;
+    Gnum                commcut;
+    Gnum                commgain;
+
+    for (edgenum = verttax[vertnum], commcut = commgain = 0;
+         edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                edloval;
+
+      edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+      if (parttax[edgetax[edgenum]] != parttax[vertnum]) {
+        commcut  ++;
+        commload += edloval;
+        commgain -= edloval;
+      }
+      else
+        commgain += edloval;
+    }
+    if (commcut != 0)
+      fronnbr ++;
+    if (cuttab != NULL) {
+      cuttab[vertnum]  = commcut;
+      gaintab[vertnum] = commgain;
+    }
+    gainsum += commgain;
+  }
+
+  *fnbrptr = fronnbr;
+  *cmliptr = commload / 2;
+
+  return (gainsum);
+}
+
+/* This routine checks the kernels against
+** the reference computation for the current
+** partition of the given graph.
+** It returns:
+** - 0   : if results match.
+** - !0  : on error.
+*/
+
+static
+int
+testCostCheck (
+Bgraph * const              grafptr,
+Gnum * const                cuttab,
+Gnum * const                gaintab)
+{
+  Gnum                vertnum;
+  Gnum                fronnbr;
+  Gnum                cmlisum;
+  Gnum                cmlesum;
+  Gnum                cmgesum;
+  Gnum                cpl1sum;
+  Gnum                ver1nbr;
+  Gnum                fnbrref;
+  Gnum                cmliref;
+
+  testCostRef (grafptr, cuttab, gaintab, &fnbrref, &cmliref);
+
+  for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
+    Gnum                cutnbr;
+    Gnum                cutload;
+    Gnum                edlosum;
+
+    cutnbr = bgraphCostVert (grafptr, grafptr->parttax, vertnum, &cutload, &edlosum);
+    if ((cutnbr != cuttab[vertnum]) ||
+        ((edlosum - 2 * cutload) != gaintab[vertnum])) {
+      errorPrint ("testCostCheck: invalid vertex values");
+      return (1);
+    }
+  }
+
+  bgraphCost2 (grafptr, grafptr->parttax, grafptr->frontab, &fronnbr,
+               &cpl1sum, &ver1nbr, &cmlisum, &cmlesum, &cmgesum);
+  if ((fronnbr != fnbrref) ||
+      (cmlisum != cmliref)) {
+    errorPrint ("testCostCheck: invalid partition cost");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  Graph *             grafptr;
+  Arch *              archptr;
+  ArchDom             domnorg;
+  ArchDom             domntab[2];
+  Bgraph              actgrafdat;
+  Gnum                vflowgttab[2] = { 0, 0 };
+  Gnum *              cuttab;
+  Gnum *              gaintab;
+  Gnum *              edlotax;
+  Gnum                vertnum;
+  int                 passnbr;
+  int                 passnum;
+  int                 partnum;
+  int                 i;
+
+  errorProg (argv[0]);
+
+  passnbr = 0;
+  switch (argc) {
+    case 3 :
+      passnbr = MAX (1, atoi (argv[2]));
+    case 2 :
+      break;
+    default :
+      errorPrint ("usage: %s graph_file [passnbr]", argv[0]);
+      exit       (EXIT_FAILURE);
+  }
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  SCOTCH_graphInit (&grafdat);
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    errorPrint ("main: cannot open file");
+    exit       (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    errorPrint ("main: cannot load graph");
+    exit       (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, 2);
+  grafptr = (Graph *) (void *) &grafdat;
+  archptr = (Arch *)  (void *) &archdat;
+  archDomFrst   (archptr, &domnorg);
+  archDomBipart (archptr, &domnorg, &domntab[0], &domntab[1]);
+
+  if (bgraphInit (&actgrafdat, grafptr, archptr, domntab, vflowgttab) != 0) {
+    errorPrint ("main: cannot create bipartition graph");
+    exit       (EXIT_FAILURE);
+  }
+
+  if (((cuttab  = malloc (actgrafdat.s.vertnbr * sizeof (Gnum))) == NULL) ||
+      ((gaintab = malloc (actgrafdat.s.vertnbr * sizeof (Gnum))) == NULL)) {
+    errorPrint ("main: out of memory");
+    exit       (EXIT_FAILURE);
+  }
+
+  edlotax = actgrafdat.s.edlotax;
+  for (i = 0; i < 2; i ++) {                      /* With edge loads if any, then without */
+    actgrafdat.s.edlotax = (i == 0) ? edlotax : NULL;
+
+    for (partnum = 0; partnum < TESTPARTNBR; partnum ++) {
+      for (vertnum = actgrafdat.s.baseval; vertnum < actgrafdat.s.vertnnd; vertnum ++)
+        actgrafdat.parttax[vertnum] = (GraphPart) ((partnum == 0) ? 0 : intRandVal (&intranddat, 2));
+
+      if (testCostCheck (&actgrafdat, cuttab - actgrafdat.s.baseval, gaintab - actgrafdat.s.baseval) != 0)
+        exit (EXIT_FAILURE);
+    }
+
+    if (passnbr > 0) {                            /* If micro-benchmark wanted */
+      Gnum                fnbrtmp;
+      Gnum                cmlitmp;
+      Gnum                gainsum;
+      double              timetab[2];
+
+      gainsum     = 0;
+      timetab[0]  = clockGet ();
+      for (passnum = 0; passnum < passnbr; passnum ++)
+        gainsum += testCostRef (&actgrafdat, NULL, NULL, &fnbrtmp, &cmlitmp);
+      timetab[0]  = clockGet () - timetab[0];
+      timetab[1]  = clockGet ();
+      for (passnum = 0; passnum < passnbr; passnum ++) {
+        for (vertnum = actgrafdat.s.baseval; vertnum < actgrafdat.s.vertnnd; vertnum ++) {
+          Gnum                cutload;
+          Gnum                edlosum;
+
+          bgraphCostVert (&actgrafdat, actgrafdat.parttax, vertnum, &cutload, &edlosum);
+          gainsum -= edlosum - 2 * cutload;
+        }
+      }
+      timetab[1]  = clockGet () - timetab[1];
+      if (gainsum != 0) {
+        errorPrint ("main: invalid benchmark result");
+        exit       (EXIT_FAILURE);
+      }
+
+      printf ("%s edges: reference: %g ns/edge, kernel: %g ns/edge\n",
+              (actgrafdat.s.edlotax != NULL) ? "weighted" : "unweighted",
+              timetab[0] * 1.0e9 / ((double) passnbr * (double) actgrafdat.s.edgenbr),
+              timetab[1] * 1.0e9 / ((double) passnbr * (double) actgrafdat.s.edgenbr));
+    }
+  }
+  actgrafdat.s.edlotax = edlotax;
+
+  free (gaintab);
+  free (cuttab);
+  bgraphExit (&actgrafdat);
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
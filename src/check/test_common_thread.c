@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2015,2018,2019,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2015,2018,2019,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 04 nov 2012     **/
 /**                                 to   : 10 jul 2018     **/
 /**                # Version 7.0  : from : 21 aug 2019     **/
-/**                                 to   : 31 aug 2021     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,8 @@
 
 #define COMPVAL(n)                  (((n) * ((n) + 1)) / 2)
 
+#define TASKVALNBR                  10000         /* Number of values summed by task tree */
+
 /*
 **  The static and global variables.
 */
@@ -89,6 +91,14 @@ typedef struct TestGroup_ {
   int                       redusum;              /*+ Value to compare reduction to +*/
 } TestGroup;
 
+/*+ The task data structure. +*/
+
+typedef struct TestTask_ {
+  int                       valnum;               /*+ First value of range +*/
+  int                       valnnd;               /*+ End of value range   +*/
+  int                       valsum;               /*+ Sum of range values  +*/
+} TestTask;
+
 /*************************/
 /*                       */
 /* The threaded routine. */
@@ -165,6 +175,42 @@ volatile TestGroup * restrict     grouptr)
   threadBarrier (descptr);                        /* Final barrier before freeing work array */
 }
 
+/* This routine sums a range of values by
+** recursively splitting it into two unbalanced
+** sub-ranges, the second one of which is spawned
+** as a task.
+*/
+
+static
+void
+testTask (
+ThreadTaskDescriptor * restrict const descptr,
+TestTask * restrict const             tdatptr)
+{
+  ThreadTask          taskdat;
+  TestTask            tdattab[2];
+  int                 valmed;
+  int                 valnum;
+
+  if ((tdatptr->valnnd - tdatptr->valnum) <= 16) { /* If range is small enough, sum it */
+    for (valnum = tdatptr->valnum, tdatptr->valsum = 0; valnum < tdatptr->valnnd; valnum ++)
+      tdatptr->valsum += valnum;
+    return;
+  }
+
+  valmed = tdatptr->valnum + (tdatptr->valnnd - tdatptr->valnum) / 4; /* Unbalanced split */
+  tdattab[0].valnum = tdatptr->valnum;
+  tdattab[0].valnnd = valmed;
+  tdattab[1].valnum = valmed;
+  tdattab[1].valnnd = tdatptr->valnnd;
+
+  threadTaskSpawn (descptr, &taskdat, (ThreadTaskFunc) testTask, (void *) &tdattab[1]);
+  testTask (descptr, &tdattab[0]);
+  threadTaskWait (descptr, &taskdat);
+
+  tdatptr->valsum = tdattab[0].valsum + tdattab[1].valsum;
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -178,6 +224,7 @@ char *              argv[])
 {
   ThreadContext       contdat;
   TestGroup           groudat;
+  TestTask            tdatdat;
   int                 thrdnbr;
 
   errorProg (argv[0]);
@@ -209,6 +256,19 @@ char *              argv[])
 
   free (groudat.datatab);
 
+  printf ("Performing task tree\n");
+
+  tdatdat.valnum = 0;
+  tdatdat.valnnd = TASKVALNBR;
+  if (threadTaskLaunch (&contdat, (ThreadTaskFunc) testTask, (void *) &tdatdat) != 0) {
+    errorPrint ("main: cannot launch task scheduler");
+    C_erroval = 1;
+  }
+  else if (tdatdat.valsum != COMPVAL (TASKVALNBR - 1)) {
+    errorPrint ("main: invalid task tree result");
+    C_erroval = 1;
+  }
+
   threadContextExit (&contdat);
 
   exit ((C_erroval == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
@@ -0,0 +1,297 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_context_coarsen_cache.c     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the caching of        **/
+/**                coarsening hierarchies in the library   **/
+/**                Context object.                         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define PARTNBR                     8
+#define PASSNBR                     4
+
+#define STRATSTRING                 "m{vert=200,low=r{job=t,map=t,poli=S,sep=h{pass=10}f{bal=0.05,move=120}},asc=b{bnd=f{bal=0.05,move=120},org=f{bal=0.05,move=120}}}"
+#define STRATNESTED                 "m{vert=200,low=m{vert=40,low=r{job=t,map=t,poli=S,sep=h{pass=10}f{bal=0.05,move=120}},asc=f{bal=0.05,move=120}},asc=b{bnd=m{vert=40,low=r{job=t,map=t,poli=S,sep=h{pass=10}f{bal=0.05,move=120}},asc=f{bal=0.05,move=120}},org=f{bal=0.05,move=120}}}"
+
+static const char *         C_straTab[2] = { STRATSTRING, STRATNESTED }; /* Plain and nested multilevel strategies */
+
+/*******************************/
+/*                             */
+/* The mapping check routines. */
+/*                             */
+/*******************************/
+
+/* This routine computes a mapping of the given
+** graph with the given strategy, or a remapping
+** if an old partition is provided, from a fixed
+** random seed.
+** It returns:
+** - 0   : if the mapping is valid.
+** - !0  : on error.
+*/
+
+static
+int
+testMap (
+SCOTCH_Context * const      contptr,
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Arch * const         archptr,
+const char * const          straptr,
+const SCOTCH_Num * const    parotab,
+SCOTCH_Num * const          parttab)
+{
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  int                 o;
+
+  SCOTCH_contextRandomSeed (contptr, 1);         /* Same random sequence for all mappings */
+
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_stratGraphMap (&stradat, straptr) != 0) {
+    SCOTCH_errorPrint ("testMap: cannot build strategy");
+    return (1);
+  }
+  o = (parotab == NULL)
+      ? SCOTCH_graphMap   (grafptr, archptr, &stradat, parttab)
+      : SCOTCH_graphRemap (grafptr, archptr, (SCOTCH_Num *) parotab, 1.0, NULL, &stradat, parttab);
+  SCOTCH_stratExit (&stradat);
+  if (o != 0) {
+    SCOTCH_errorPrint ("testMap: cannot compute mapping");
+    return (1);
+  }
+
+  SCOTCH_graphSize (grafptr, &vertnbr, NULL);
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    if ((parttab[vertnum] < 0) || (parttab[vertnum] >= PARTNBR)) {
+      SCOTCH_errorPrint ("testMap: invalid mapping");
+      return (1);
+    }
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      conttab[2];                 /* Contexts with and without cache */
+  SCOTCH_Graph        cogrtab[2];                 /* Context graphs                  */
+  SCOTCH_Graph        fgrfdat;                    /* Graph read from file            */
+  SCOTCH_Graph        grafdat;                    /* Graph with own load array       */
+  SCOTCH_Arch         archdat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_Num          edgenbr;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        parotab;
+  SCOTCH_Num          passnum;
+  int                 stranum;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphInit (&fgrfdat);
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&fgrfdat, fileptr, -1, 2) != 0) { /* Read source graph without vertex loads */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&fgrfdat, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, &edlotab);
+  if (((velotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parttab = malloc (2 * vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphInit (&grafdat);                    /* Graph will be re-built on the same arrays with new vertex loads */
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, PARTNBR);
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_contextInit (&conttab[i]);
+    SCOTCH_contextRandomClone (&conttab[i]);      /* Private generators, seeded before each mapping */
+    SCOTCH_contextOptionSetNum (&conttab[i], SCOTCH_OPTIONNUMDETERMINISTIC, 1); /* Even when multi-threaded */
+    SCOTCH_graphInit (&cogrtab[i]);
+    if (SCOTCH_contextBindGraph (&conttab[i], &grafdat, &cogrtab[i]) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+  }
+  if (SCOTCH_contextCoarsenCacheInit (&conttab[0]) != 0) {
+    SCOTCH_errorPrint ("main: cannot enable cache (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  for (stranum = 0; stranum < 2; stranum ++) {    /* Nested multilevel calls must not use cached levels */
+    for (passnum = 0; passnum < PASSNBR; passnum ++) { /* Map with varying loads */
+      for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+        velotab[vertnum] = 1 + ((vertnum * (passnum + 1)) % 7);
+      SCOTCH_graphFree (&grafdat);                /* Keep topology arrays; only vertex loads change */
+      if (SCOTCH_graphBuild (&grafdat, baseval, vertnbr, verttab, vendtab, velotab, NULL, edgenbr, edgetab, edlotab) != 0) {
+        SCOTCH_errorPrint ("main: cannot build graph");
+        exit (EXIT_FAILURE);
+      }
+
+      for (i = 0; i < 2; i ++) {
+        if (testMap (&conttab[i], &cogrtab[i], &archdat, C_straTab[stranum], NULL, parttab + i * vertnbr) != 0)
+          exit (EXIT_FAILURE);
+      }
+      if (memcmp (parttab, parttab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) { /* Matching is deterministic */
+        SCOTCH_errorPrint ("main: cached hierarchy changed mapping");
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  if ((edlotab = malloc (edgenbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Change edge loads in place, so that array addresses are the same */
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+      SCOTCH_Num          edgenum;
+
+      for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++)
+        edlotab[edgenum] = 1 + passnum * ((vertnum + edgetab[edgenum] - baseval) % 5); /* Symmetric edge loads */
+    }
+    SCOTCH_graphFree (&grafdat);
+    if (SCOTCH_graphBuild (&grafdat, baseval, vertnbr, verttab, vendtab, velotab, NULL, edgenbr, edgetab, edlotab) != 0) {
+      SCOTCH_errorPrint ("main: cannot build graph");
+      exit (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < 2; i ++) {
+      if (testMap (&conttab[i], &cogrtab[i], &archdat, STRATSTRING, NULL, parttab + i * vertnbr) != 0)
+        exit (EXIT_FAILURE);
+    }
+    if (memcmp (parttab, parttab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+      SCOTCH_errorPrint ("main: stale cached hierarchy used");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Remap, so that cached multinodes may straddle old parts */
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+      parotab[vertnum] = (parttab[vertnum] + passnum * (vertnum % 2)) % PARTNBR;
+    if (testMap (&conttab[0], &cogrtab[0], &archdat, STRATSTRING, parotab, parttab) != 0)
+      exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_contextCoarsenCacheInit (&conttab[0]) != 0) { /* Re-enabling discards cached levels */
+    SCOTCH_errorPrint ("main: cannot enable cache (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (testMap (&conttab[0], &cogrtab[0], &archdat, STRATSTRING, NULL, parttab) != 0)
+    exit (EXIT_FAILURE);
+
+  SCOTCH_contextCoarsenCacheExit (&conttab[0]);
+  if (testMap (&conttab[0], &cogrtab[0], &archdat, STRATSTRING, NULL, parttab) != 0)
+    exit (EXIT_FAILURE);
+
+  if (SCOTCH_contextCoarsenCacheInit (&conttab[0]) != 0) { /* Leave cache for context to free */
+    SCOTCH_errorPrint ("main: cannot enable cache (3)");
+    exit (EXIT_FAILURE);
+  }
+  if (testMap (&conttab[0], &cogrtab[0], &archdat, STRATSTRING, NULL, parttab) != 0)
+    exit (EXIT_FAILURE);
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_graphExit   (&cogrtab[i]);
+    SCOTCH_contextExit (&conttab[i]);
+  }
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+
+  free (edlotab);
+  free (parotab);
+  free (parttab);
+  free (velotab);
+
+  SCOTCH_graphExit (&fgrfdat);
+
+  exit (EXIT_SUCCESS);
+}
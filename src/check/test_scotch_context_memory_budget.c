@@ -0,0 +1,187 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_context_memory_budget.c     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the memory budget     **/
+/**                option of multilevel methods in the     **/
+/**                library Context object.                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define PARTNBR                     8
+
+#define STRATMAPSTRING              "r{job=t,map=t,poli=S,sep=m{vert=80,low=h{pass=10}f{bal=0.05,move=80},asc=b{bnd=f{bal=0.05,move=80},org=f{bal=0.05,move=80}}}}"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      conttab[2];                 /* Contexts without and with budget */
+  SCOTCH_Graph        cogrtab[2];                 /* Context graphs                   */
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num          budgval;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphInit (&grafdat);
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+  if (((parttab = malloc (2 * vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((permtab = malloc (2 * vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_contextInit (&conttab[i]);
+    SCOTCH_contextRandomClone (&conttab[i]);      /* Private generators, seeded before each computation */
+    SCOTCH_contextOptionSetNum (&conttab[i], SCOTCH_OPTIONNUMDETERMINISTIC, 1); /* Even when multi-threaded */
+    SCOTCH_graphInit (&cogrtab[i]);
+    if (SCOTCH_contextBindGraph (&conttab[i], &grafdat, &cogrtab[i]) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if (SCOTCH_contextOptionSetNum (&conttab[1], SCOTCH_OPTIONNUMMEMORYBUDGET, -1) == 0) {
+    SCOTCH_errorPrint ("main: negative budget accepted");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_contextOptionSetNum (&conttab[1], SCOTCH_OPTIONNUMMEMORYBUDGET, 1) != 0) { /* Budget so small that all spillable levels are spilled */
+    SCOTCH_errorPrint ("main: cannot set budget");
+    exit (EXIT_FAILURE);
+  }
+  if ((SCOTCH_contextOptionGetNum (&conttab[1], SCOTCH_OPTIONNUMMEMORYBUDGET, &budgval) != 0) ||
+      (budgval != 1)) {
+    SCOTCH_errorPrint ("main: invalid budget value");
+    exit (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < 2; i ++) {                      /* Recursive bipartitioning by multilevel bipartitioning */
+    SCOTCH_contextRandomSeed (&conttab[i], 1);
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_stratGraphMap (&stradat, STRATMAPSTRING) != 0) {
+      SCOTCH_errorPrint ("main: cannot build mapping strategy");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphPart (&cogrtab[i], PARTNBR, &stradat, parttab + i * vertnbr) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute partition");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+  }
+  if (memcmp (parttab, parttab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+    SCOTCH_errorPrint ("main: memory budget changed partition");
+    exit (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < 2; i ++) {                      /* Nested dissection by multilevel vertex separation */
+    SCOTCH_contextRandomSeed (&conttab[i], 1);
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_graphOrder (&cogrtab[i], &stradat, permtab + i * vertnbr, NULL, NULL, NULL, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute ordering");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+  }
+  if (memcmp (permtab, permtab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+    SCOTCH_errorPrint ("main: memory budget changed ordering");
+    exit (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_graphExit   (&cogrtab[i]);
+    SCOTCH_contextExit (&conttab[i]);
+  }
+
+  free (permtab);
+  free (parttab);
+
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,344 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_context_stats.c             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the statistics        **/
+/**                recording features of the library       **/
+/**                Context object.                         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define PARTNBR                     8
+
+/*************************************/
+/*                                   */
+/* The statistics checking routines. */
+/*                                   */
+/*************************************/
+
+/* This routine checks the consistency of
+** the statistics recorded in the given
+** context, and that classes of the given
+** type have been recorded.
+** It returns:
+** - 0   : if statistics are consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testStatsCheck (
+SCOTCH_Context * const      contptr,
+const char * const          clasptr)
+{
+  SCOTCH_Num          reconbr;
+  SCOTCH_Num          reconum;
+  SCOTCH_Num          clasnbr;
+
+  reconbr = SCOTCH_contextStatsNbr (contptr);
+  if (reconbr <= 0) {
+    SCOTCH_errorPrint ("testStatsCheck: no statistics recorded");
+    return (1);
+  }
+
+  for (reconum = clasnbr = 0; reconum < reconbr; reconum ++) {
+    const char *        recoclasptr;
+    const char *        recomethptr;
+    SCOTCH_Num          levlnum;
+    SCOTCH_Num          vertnbr;
+    SCOTCH_Num          edgenbr;
+    double              cutvtab[2];
+    double              imbvtab[2];
+    double              timeval;
+
+    if (SCOTCH_contextStatsData (contptr, reconum, &recoclasptr, &recomethptr, &levlnum, &vertnbr, &edgenbr,
+                                 cutvtab, imbvtab, &timeval) != 0) {
+      SCOTCH_errorPrint ("testStatsCheck: cannot get record");
+      return (1);
+    }
+    if ((recoclasptr == NULL) || (recomethptr == NULL) || (recomethptr[0] == '\0')) {
+      SCOTCH_errorPrint ("testStatsCheck: invalid names");
+      return (1);
+    }
+    if ((levlnum < 0) || (vertnbr < 0) || (edgenbr < 0) || (timeval < 0.0)) {
+      SCOTCH_errorPrint ("testStatsCheck: invalid record data");
+      return (1);
+    }
+    if (strcmp (recoclasptr, clasptr) == 0)
+      clasnbr ++;
+  }
+  if (clasnbr <= 0) {
+    SCOTCH_errorPrint ("testStatsCheck: class \"%s\" not recorded", clasptr);
+    return (1);
+  }
+
+  if (SCOTCH_contextStatsData (contptr, reconbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) == 0) {
+    SCOTCH_errorPrint ("testStatsCheck: out of range record accepted");
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine checks that the JSON output of
+** the given context looks well-formed and, if
+** a key is given, that it contains this key.
+** It returns:
+** - 0   : if output is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testStatsSave (
+SCOTCH_Context * const      contptr,
+const char * const          keyptr)
+{
+  FILE *              fileptr;
+  char *              databuf;
+  long                datasiz;
+  long                datanum;
+  int                 depthval;
+  int                 o;
+
+  if ((fileptr = tmpfile ()) == NULL) {
+    SCOTCH_errorPrint ("testStatsSave: cannot open temporary file");
+    return (1);
+  }
+  if (SCOTCH_contextStatsSave (contptr, fileptr) != 0) {
+    SCOTCH_errorPrint ("testStatsSave: cannot save statistics");
+    return (1);
+  }
+
+  datasiz = ftell (fileptr);
+  if ((databuf = malloc (datasiz + 1)) == NULL) {
+    SCOTCH_errorPrint ("testStatsSave: out of memory");
+    return (1);
+  }
+  rewind (fileptr);
+  if (fread (databuf, 1, datasiz, fileptr) != (size_t) datasiz) {
+    SCOTCH_errorPrint ("testStatsSave: cannot read statistics");
+    return (1);
+  }
+  databuf[datasiz] = '\0';
+  fclose (fileptr);
+
+  o = 0;
+  if ((databuf[0] != '{') ||
+      (strstr (databuf, "\"methods\"") == NULL) ||
+      (strstr (databuf, "\"calls\"") == NULL)) {
+    SCOTCH_errorPrint ("testStatsSave: invalid statistics header");
+    o = 1;
+  }
+  if ((keyptr != NULL) &&
+      (strstr (databuf, keyptr) == NULL)) {
+    SCOTCH_errorPrint ("testStatsSave: missing key \"%s\"", keyptr);
+    o = 1;
+  }
+  for (datanum = 0, depthval = 0; datanum < datasiz; datanum ++) { /* Check bracket balance */
+    switch (databuf[datanum]) {
+      case '{' :
+      case '[' :
+        depthval ++;
+        break;
+      case '}' :
+      case ']' :
+        if (-- depthval < 0)
+          datanum = datasiz;
+        break;
+    }
+  }
+  if (depthval != 0) {
+    SCOTCH_errorPrint ("testStatsSave: unbalanced statistics output");
+    o = 1;
+  }
+
+  free (databuf);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        cogrdat;                    /* Context graph */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num          passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphInit (&grafdat);
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+  if (((parttab = malloc (2 * vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((permtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Map without, then with statistics */
+    SCOTCH_contextInit (&contdat);
+    SCOTCH_contextRandomClone (&contdat);         /* Ensure reproducibility across passes */
+    SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1); /* Even when multi-threaded */
+    SCOTCH_graphInit (&cogrdat);
+    if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context (1)");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_contextStatsNbr (&contdat) != 0) {
+      SCOTCH_errorPrint ("main: statistics recorded by default");
+      exit (EXIT_FAILURE);
+    }
+    if ((passnum == 1) &&
+        (SCOTCH_contextStatsInit (&contdat) != 0)) {
+      SCOTCH_errorPrint ("main: cannot enable statistics (1)");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_graphPart (&cogrdat, PARTNBR, &stradat, parttab + passnum * vertnbr) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute partition");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    if (passnum == 1) {
+      if ((testStatsCheck (&contdat, "bgraph") != 0) ||
+          (testStatsSave (&contdat, "\"passes\"") != 0)) /* Diffusion reports its passes */
+        exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_graphExit   (&cogrdat);
+    SCOTCH_contextExit (&contdat);
+  }
+
+  if (memcmp (parttab, parttab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+    SCOTCH_errorPrint ("main: statistics recording changed partition");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_graphInit   (&cogrdat);
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind context (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_contextStatsInit (&contdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot enable statistics (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_graphOrder (&cogrdat, &stradat, permtab, NULL, NULL, NULL, NULL) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute ordering");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+
+  if ((testStatsCheck (&contdat, "hgraph") != 0) ||
+      (testStatsCheck (&contdat, "vgraph") != 0) ||
+      (testStatsSave (&contdat, "\"memory\"") != 0)) /* Arena counters always saved */
+    exit (EXIT_FAILURE);
+
+  if (SCOTCH_contextStatsInit (&contdat) != 0) {  /* Re-enabling discards previous records */
+    SCOTCH_errorPrint ("main: cannot enable statistics (3)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_contextStatsNbr (&contdat) != 0) {
+    SCOTCH_errorPrint ("main: statistics not reset");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphExit   (&cogrdat);
+  SCOTCH_contextExit (&contdat);
+
+  free (permtab);
+  free (parttab);
+
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,345 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_load.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the multi-threaded    **/
+/**                loading of source graphs, and measures  **/
+/**                its throughput with respect to          **/
+/**                sequential loading.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#ifndef COMMON_OS_WINDOWS
+#include <unistd.h>
+#include <sys/wait.h>
+#endif /* COMMON_OS_WINDOWS */
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/graph.h"
+
+#include "scotch.h"
+
+#define TEST_THRDNBR                4             /* Maximum number of threads to test */
+
+static File                 C_fileTab[1] = {      /* File array */
+                              { FILEMODER } };
+
+/*************************/
+/*                       */
+/* The service routines. */
+/*                       */
+/*************************/
+
+/* This routine compares two compact graphs.
+** It returns:
+** - 0   : if both graphs are identical.
+** - !0  : else.
+*/
+
+static
+int
+testGraphCompare (
+const Graph * const         gra0ptr,
+const Graph * const         gra1ptr)
+{
+  const Gnum          baseval = gra0ptr->baseval;
+  const Gnum          vertnbr = gra0ptr->vertnbr;
+  const Gnum          edgenbr = gra0ptr->edgenbr;
+
+  if ((gra1ptr->baseval != baseval) ||
+      (gra1ptr->vertnbr != vertnbr) ||
+      (gra1ptr->edgenbr != edgenbr) ||
+      (gra1ptr->velosum != gra0ptr->velosum) ||
+      (gra1ptr->edlosum != gra0ptr->edlosum) ||
+      (gra1ptr->degrmax != gra0ptr->degrmax))
+    return (1);
+  if (memcmp (gra0ptr->verttax + baseval, gra1ptr->verttax + baseval, (vertnbr + 1) * sizeof (Gnum)) != 0)
+    return (1);
+  if (memcmp (gra0ptr->edgetax + baseval, gra1ptr->edgetax + baseval, edgenbr * sizeof (Gnum)) != 0)
+    return (1);
+  if (((gra0ptr->velotax == NULL) != (gra1ptr->velotax == NULL)) ||
+      ((gra0ptr->velotax != NULL) && (memcmp (gra0ptr->velotax + baseval, gra1ptr->velotax + baseval, vertnbr * sizeof (Gnum)) != 0)))
+    return (1);
+  if (((gra0ptr->vlbltax == NULL) != (gra1ptr->vlbltax == NULL)) ||
+      ((gra0ptr->vlbltax != NULL) && (memcmp (gra0ptr->vlbltax + baseval, gra1ptr->vlbltax + baseval, vertnbr * sizeof (Gnum)) != 0)))
+    return (1);
+  if (((gra0ptr->edlotax == NULL) != (gra1ptr->edlotax == NULL)) ||
+      ((gra0ptr->edlotax != NULL) && (memcmp (gra0ptr->edlotax + baseval, gra1ptr->edlotax + baseval, edgenbr * sizeof (Gnum)) != 0)))
+    return (1);
+
+  return (0);
+}
+
+/* This routine loads a graph from the given
+** stream using the given number of threads,
+** and checks it against the reference graph.
+** It returns:
+** - 0   : if the loaded graph is identical.
+** - !0  : on error.
+*/
+
+static
+int
+testGraphLoad (
+const Graph * const         refgrafptr,
+FILE * const                stream,
+const int                   thrdnbr,
+double * const              timeptr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        cgrfdat;                    /* Context container graph */
+  double              timeval;
+  int                 o;
+
+  SCOTCH_contextInit (&contdat);
+  if ((thrdnbr > 0) &&
+      (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0)) {
+    SCOTCH_errorPrint ("testGraphLoad: cannot spawn threads");
+    return (1);
+  }
+  SCOTCH_graphInit (&grafdat);
+  SCOTCH_graphInit (&cgrfdat);
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cgrfdat) != 0) {
+    SCOTCH_errorPrint ("testGraphLoad: cannot bind context");
+    return (1);
+  }
+
+  timeval = clockGet ();
+  o = SCOTCH_graphLoad (&cgrfdat, stream, -1, 0);
+  *timeptr = clockGet () - timeval;
+
+  if (o != 0)
+    SCOTCH_errorPrint ("testGraphLoad: cannot load graph");
+  else if (testGraphCompare (refgrafptr, (Graph *) &grafdat) != 0) {
+    SCOTCH_errorPrint ("testGraphLoad: graphs differ");
+    o = 1;
+  }
+
+  SCOTCH_graphExit   (&cgrfdat);
+  SCOTCH_graphExit   (&grafdat);
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  Graph               grafdat;                    /* Reference graph loaded sequentially */
+  char *              texttab;                    /* Graph file contents                 */
+  size_t              textnbr;
+  size_t              textsiz;
+  size_t              textnum;
+  FILE *              fileptr;
+  double              timeval;
+  double              timetab[TEST_THRDNBR + 1];
+  double              timeseq;
+  int                 passnbr;
+  int                 passnum;
+  int                 thrdnbr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 2) || (argc > 3)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [pass_number]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+  passnbr = (argc > 2) ? atoi (argv[2]) : 1;
+  if (passnbr < 1)
+    passnbr = 1;
+
+  fileBlockInit (C_fileTab, 1);                   /* Set default stream pointers */
+  fileBlockName (C_fileTab, 0) = argv[1];         /* Use provided file           */
+  if (fileBlockOpen (C_fileTab, 1) != 0) {        /* Open possibly compressed file */
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+  for (texttab = NULL, textnbr = textsiz = 0; ; ) { /* Read whole text of graph file */
+    size_t              readnbr;
+
+    if (textnbr >= textsiz) {
+      textsiz = (textsiz == 0) ? 65536 : (textsiz * 2);
+      if ((texttab = realloc (texttab, textsiz)) == NULL) {
+        SCOTCH_errorPrint ("main: out of memory");
+        exit (EXIT_FAILURE);
+      }
+    }
+    if ((readnbr = fread (texttab + textnbr, 1, textsiz - textnbr, fileBlockFile (C_fileTab, 0))) == 0)
+      break;
+    textnbr += readnbr;
+  }
+  fileBlockClose (C_fileTab, 1);
+
+  if ((fileptr = tmpfile ()) == NULL) {           /* Uncompressed copy of graph file */
+    SCOTCH_errorPrint ("main: cannot create temporary file (1)");
+    exit (EXIT_FAILURE);
+  }
+  fwrite (texttab, 1, textnbr, fileptr);
+
+  for (passnum = 0, timeseq = 0.0; passnum < passnbr; passnum ++) { /* Load reference graph sequentially */
+    if (passnum > 0)
+      graphExit (&grafdat);
+    rewind (fileptr);
+    timeval = clockGet ();
+    if (graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot load graph (1)");
+      exit (EXIT_FAILURE);
+    }
+    timeseq += clockGet () - timeval;
+  }
+
+  for (thrdnbr = 0; thrdnbr <= TEST_THRDNBR; thrdnbr ++) { /* Load graph with 1 to TEST_THRDNBR threads, then with default context */
+    timetab[thrdnbr] = 0.0;
+    for (passnum = 0; passnum < passnbr; passnum ++) {
+      rewind (fileptr);
+      if (testGraphLoad (&grafdat, fileptr, (thrdnbr < TEST_THRDNBR) ? (thrdnbr + 1) : 0, &timeval) != 0) {
+        SCOTCH_errorPrint ("main: invalid threaded loading (%d)", thrdnbr);
+        exit (EXIT_FAILURE);
+      }
+      timetab[thrdnbr] += timeval;
+    }
+  }
+
+  fseek  (fileptr, 0, SEEK_END);                  /* Append second copy of graph to check stream position after loading */
+  fwrite (texttab, 1, textnbr, fileptr);
+  rewind (fileptr);
+  if ((testGraphLoad (&grafdat, fileptr, 2, &timeval) != 0) ||
+      (testGraphLoad (&grafdat, fileptr, 2, &timeval) != 0)) {
+    SCOTCH_errorPrint ("main: invalid threaded loading of consecutive graphs");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+#ifndef COMMON_OS_WINDOWS
+  {
+    int                 pipetab[2];
+    pid_t               procnum;
+
+    if (pipe (pipetab) != 0) {                    /* Two consecutive graphs from a non-seekable stream */
+      SCOTCH_errorPrint ("main: cannot create pipe");
+      exit (EXIT_FAILURE);
+    }
+    if ((procnum = fork ()) < 0) {
+      SCOTCH_errorPrint ("main: cannot fork");
+      exit (EXIT_FAILURE);
+    }
+    if (procnum == 0) {                           /* Child process writes graph twice */
+      size_t              writnum;
+      int                 copynum;
+
+      close (pipetab[0]);
+      for (copynum = 0; copynum < 2; copynum ++) {
+        for (writnum = 0; writnum < textnbr; ) {
+          ssize_t             writnbr;
+
+          if ((writnbr = write (pipetab[1], texttab + writnum, textnbr - writnum)) <= 0)
+            _exit (EXIT_FAILURE);
+          writnum += (size_t) writnbr;
+        }
+      }
+      close (pipetab[1]);
+      _exit (EXIT_SUCCESS);
+    }
+    close (pipetab[1]);
+    if ((fileptr = fdopen (pipetab[0], "r")) == NULL) {
+      SCOTCH_errorPrint ("main: cannot open pipe");
+      exit (EXIT_FAILURE);
+    }
+    if ((testGraphLoad (&grafdat, fileptr, 2, &timeval) != 0) ||
+        (testGraphLoad (&grafdat, fileptr, 2, &timeval) != 0)) {
+      SCOTCH_errorPrint ("main: invalid threaded loading of consecutive graphs from pipe");
+      exit (EXIT_FAILURE);
+    }
+    fclose  (fileptr);
+    waitpid (procnum, NULL, 0);
+  }
+#endif /* COMMON_OS_WINDOWS */
+
+  if ((fileptr = tmpfile ()) == NULL) {           /* Graph file with one number per line */
+    SCOTCH_errorPrint ("main: cannot create temporary file (2)");
+    exit (EXIT_FAILURE);
+  }
+  for (textnum = 0; textnum < textnbr; textnum ++) {
+    if (isspace ((unsigned char) texttab[textnum]))
+      texttab[textnum] = '\n';
+  }
+  fwrite (texttab, 1, textnbr, fileptr);
+  rewind (fileptr);
+  if (testGraphLoad (&grafdat, fileptr, 2, &timeval) != 0) {
+    SCOTCH_errorPrint ("main: invalid threaded loading of multi-line vertices");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  printf ("Graph size: %ld bytes\n", (long) textnbr);
+  printf ("Sequential loading: %g s, %g MB/s\n", timeseq / passnbr, ((double) textnbr * passnbr) / (timeseq * 1.0e6));
+  for (thrdnbr = 0; thrdnbr <= TEST_THRDNBR; thrdnbr ++) {
+    if (thrdnbr < TEST_THRDNBR)
+      printf ("Threaded loading (%d): ", thrdnbr + 1);
+    else
+      printf ("Threaded loading (default): ");
+    printf ("%g s, %g MB/s\n", timetab[thrdnbr] / passnbr, ((double) textnbr * passnbr) / (timetab[thrdnbr] * 1.0e6));
+  }
+
+  graphExit (&grafdat);
+  free      (texttab);
+
+  exit (EXIT_SUCCESS);
+}
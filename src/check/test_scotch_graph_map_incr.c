@@ -0,0 +1,274 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_incr.c            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the incremental       **/
+/**                mapping routine of the libScotch        **/
+/**                library.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define PARTNBR                     8
+#define PASSNBR                     6
+#define KBALVAL                     0.05
+
+/*******************************/
+/*                             */
+/* The mapping check routines. */
+/*                             */
+/*******************************/
+
+/* This routine checks that the given part
+** array is valid, and computes its maximum
+** imbalance ratio with respect to the given
+** vertex load array.
+** It returns:
+** - 0   : if the part array is valid.
+** - !0  : on error.
+*/
+
+static
+int
+testCheck (
+const SCOTCH_Num            vertnbr,
+const SCOTCH_Num * const    velotab,
+const SCOTCH_Num * const    parttab,
+double * const              imbaptr)
+{
+  SCOTCH_Num          loadtab[PARTNBR];
+  SCOTCH_Num          loadsum;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          partnum;
+  double              loadavg;
+  double              imbaval;
+
+  memset (loadtab, 0, PARTNBR * sizeof (SCOTCH_Num));
+  for (vertnum = 0, loadsum = 0; vertnum < vertnbr; vertnum ++) {
+    if ((parttab[vertnum] < 0) || (parttab[vertnum] >= PARTNBR)) {
+      SCOTCH_errorPrint ("testCheck: invalid part array");
+      return (1);
+    }
+    loadtab[parttab[vertnum]] += velotab[vertnum];
+    loadsum += velotab[vertnum];
+  }
+
+  loadavg = (double) loadsum / (double) PARTNBR;
+  for (partnum = 0, imbaval = 0.0; partnum < PARTNBR; partnum ++) {
+    double              imbatmp;
+
+    imbatmp = ((double) loadtab[partnum] - loadavg) / loadavg;
+    if (imbatmp < 0.0)
+      imbatmp = - imbatmp;
+    if (imbaval < imbatmp)
+      imbaval = imbatmp;
+  }
+  *imbaptr = imbaval;
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        velotab;                    /* Mirror of vertex loads held by mapping */
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        vchgtab;                    /* Array of changed vertices             */
+  SCOTCH_Num *        veldtab;                    /* Array of load deltas                  */
+  SCOTCH_Num          vchgnbr;
+  SCOTCH_Num          vchgnum;
+  SCOTCH_Num          passnum;
+  double              imbaval;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 2) != 0) { /* Read source graph without vertex loads */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  vchgnbr = (vertnbr + 49) / 50;                  /* Change loads of about 2% of vertices */
+  if (((velotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((vchgtab = malloc (vchgnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((veldtab = malloc (vchgnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    velotab[vertnum] = 1;
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, PARTNBR);
+  SCOTCH_stratInit (&stradat);                    /* Default strategy for full mappings */
+
+  if (SCOTCH_graphMapInit (&grafdat, &mappdat, &archdat, parttab) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize mapping");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, 0, NULL, NULL, KBALVAL, &stradat) != 0) { /* First call computes full mapping */
+    SCOTCH_errorPrint ("main: cannot compute mapping");
+    exit (EXIT_FAILURE);
+  }
+  if (testCheck (vertnbr, velotab, parttab, &imbaval) != 0)
+    exit (EXIT_FAILURE);
+
+  for (passnum = 0; passnum < PASSNBR; passnum ++) { /* Small load changes, refined locally */
+    for (vchgnum = 0; vchgnum < vchgnbr; vchgnum ++) {
+      vertnum = (vchgnum * 37 + passnum * 11) % vertnbr;
+      vchgtab[vchgnum] = vertnum + baseval;
+      veldtab[vchgnum] = ((vchgnum + passnum) % 3) - 1; /* Deltas in {-1, 0, 1} */
+      if (velotab[vertnum] + veldtab[vchgnum] <= 0)
+        veldtab[vchgnum] = 1;
+      velotab[vertnum] += veldtab[vchgnum];
+    }
+
+    if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, vchgnbr, vchgtab, veldtab, KBALVAL, &stradat) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute incremental mapping (1)");
+      exit (EXIT_FAILURE);
+    }
+    if (testCheck (vertnbr, velotab, parttab, &imbaval) != 0)
+      exit (EXIT_FAILURE);
+    printf ("Pass %d: imbalance %g\n", (int) passnum, imbaval);
+  }
+
+  for (vchgnum = 0; vchgnum < vchgnbr; vchgnum ++) { /* Heavy vertices in a same area, to trigger a full remapping */
+    vertnum = vchgnum;
+    vchgtab[vchgnum] = vertnum + baseval;
+    veldtab[vchgnum] = 20;
+    velotab[vertnum] += veldtab[vchgnum];
+  }
+  if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, vchgnbr, vchgtab, veldtab, KBALVAL, &stradat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute incremental mapping (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (testCheck (vertnbr, velotab, parttab, &imbaval) != 0)
+    exit (EXIT_FAILURE);
+  printf ("Heavy pass: imbalance %g\n", imbaval);
+
+  vchgtab[0] = baseval;                           /* Negative vertex load must be rejected */
+  veldtab[0] = - (velotab[0] + 1);
+  if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, 1, vchgtab, veldtab, KBALVAL, &stradat) == 0) {
+    SCOTCH_errorPrint ("main: invalid load delta accepted");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, 0, NULL, NULL, KBALVAL, &stradat) != 0) { /* Loads must be left unchanged */
+    SCOTCH_errorPrint ("main: cannot compute incremental mapping (3)");
+    exit (EXIT_FAILURE);
+  }
+  if (testCheck (vertnbr, velotab, parttab, &imbaval) != 0)
+    exit (EXIT_FAILURE);
+
+  if (SCOTCH_graphMapCompute (&grafdat, &mappdat, &stradat) != 0) { /* Plain mapping discards incremental data */
+    SCOTCH_errorPrint ("main: cannot compute mapping");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphMapIncrCompute (&grafdat, &mappdat, 0, NULL, NULL, KBALVAL, &stradat) != 0) { /* Restart from graph loads */
+    SCOTCH_errorPrint ("main: cannot compute incremental mapping (4)");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    velotab[vertnum] = 1;
+  if (testCheck (vertnbr, velotab, parttab, &imbaval) != 0)
+    exit (EXIT_FAILURE);
+
+  SCOTCH_graphMapExit (&grafdat, &mappdat);       /* Frees incremental data */
+  SCOTCH_stratExit    (&stradat);
+  SCOTCH_archExit     (&archdat);
+
+  free (veldtab);
+  free (vchgtab);
+  free (parttab);
+  free (velotab);
+
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
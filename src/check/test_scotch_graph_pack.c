@@ -0,0 +1,337 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_pack.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the packed edge array **/
+/**                of source graphs, and measures its      **/
+/**                memory footprint and traversal speed    **/
+/**                with respect to the plain edge array.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/graph.h"
+
+#include "scotch.h"
+
+static File                 C_fileTab[1] = {      /* File array */
+                              { FILEMODER } };
+
+/*************************/
+/*                       */
+/* The service routines. */
+/*                       */
+/*************************/
+
+/* This routine traverses all the edges of
+** the given graph by way of graph cursors.
+** It returns:
+** - the checksum of the traversal, in all cases.
+*/
+
+static
+Gunum
+testGraphTraverse (
+const Graph * const         grafptr)
+{
+  Gnum                vertnum;
+  Gunum               chekval;
+
+  for (vertnum = grafptr->baseval, chekval = 0; vertnum < grafptr->vertnnd; vertnum ++) {
+    GraphCursor         cursdat;
+
+    for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); )
+      chekval = (chekval * 31) + (Gunum) cursdat.vertend + (Gunum) cursdat.edgenum;
+  }
+
+  return (chekval);
+}
+
+/* This routine compares two compact graphs.
+** It returns:
+** - 0   : if both graphs are identical.
+** - !0  : else.
+*/
+
+static
+int
+testGraphCompare (
+const Graph * const         gra0ptr,
+const Graph * const         gra1ptr)
+{
+  const Gnum          baseval = gra0ptr->baseval;
+  const Gnum          vertnbr = gra0ptr->vertnbr;
+  const Gnum          edgenbr = gra0ptr->edgenbr;
+
+  if ((gra1ptr->baseval != baseval) ||
+      (gra1ptr->vertnbr != vertnbr) ||
+      (gra1ptr->edgenbr != edgenbr) ||
+      (gra1ptr->velosum != gra0ptr->velosum) ||
+      (gra1ptr->edlosum != gra0ptr->edlosum) ||
+      (gra1ptr->degrmax != gra0ptr->degrmax))
+    return (1);
+  if (memcmp (gra0ptr->verttax + baseval, gra1ptr->verttax + baseval, (vertnbr + 1) * sizeof (Gnum)) != 0)
+    return (1);
+  if (memcmp (gra0ptr->edgetax + baseval, gra1ptr->edgetax + baseval, edgenbr * sizeof (Gnum)) != 0)
+    return (1);
+  if (((gra0ptr->edlotax == NULL) != (gra1ptr->edlotax == NULL)) ||
+      ((gra0ptr->edlotax != NULL) && (memcmp (gra0ptr->edlotax + baseval, gra1ptr->edlotax + baseval, edgenbr * sizeof (Gnum)) != 0)))
+    return (1);
+
+  return (0);
+}
+
+/* This routine coarsens the given graph
+** using a single thread, and computes its
+** pseudo-diameter, after resetting the
+** random generator.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+testGraphCoarsen (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Graph * const        coarptr,
+SCOTCH_Num * const          multtab,
+SCOTCH_Num * const          diamptr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        cgrfdat;                    /* Context container graph */
+  SCOTCH_Num          vertnbr;
+  int                 o;
+
+  SCOTCH_contextInit (&contdat);
+  if (SCOTCH_contextThreadSpawn (&contdat, 1, NULL) != 0) { /* Use one thread for reproducibility */
+    SCOTCH_errorPrint ("testGraphCoarsen: cannot spawn threads");
+    return (1);
+  }
+  SCOTCH_graphInit (&cgrfdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &cgrfdat) != 0) {
+    SCOTCH_errorPrint ("testGraphCoarsen: cannot bind context");
+    return (1);
+  }
+
+  SCOTCH_graphSize (grafptr, &vertnbr, NULL);
+  SCOTCH_randomReset ();
+  *diamptr = SCOTCH_graphDiamPV (&cgrfdat);
+  SCOTCH_randomReset ();
+  o = SCOTCH_graphCoarsen (&cgrfdat, vertnbr / 4, 0.8, SCOTCH_COARSENNONE, coarptr, multtab);
+  if (o > 1)
+    SCOTCH_errorPrint ("testGraphCoarsen: cannot coarsen graph");
+
+  SCOTCH_graphExit   (&cgrfdat);
+  SCOTCH_contextExit (&contdat);
+
+  return ((o > 1) ? 1 : 0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Graph        grafdat;                    /* Plain graph                */
+  SCOTCH_Graph        packdat;                    /* Packed graph               */
+  SCOTCH_Graph        coa0dat;                    /* Coarse graph of plain one  */
+  SCOTCH_Graph        coa1dat;                    /* Coarse graph of packed one */
+  SCOTCH_Graph        mmapdat;                    /* Graph loaded from binary file */
+  SCOTCH_Num *        mul0tab;
+  SCOTCH_Num *        mul1tab;
+  SCOTCH_Num          dia0val;
+  SCOTCH_Num          dia1val;
+  Graph *             grafptr;
+  Graph *             packptr;
+  Graph *             coa0ptr;
+  Graph *             coa1ptr;
+  Graph *             mmapptr;
+  FILE *              stream;
+  Gunum               chk0val;
+  Gunum               chk1val;
+  double              timeval;
+  double              tim0val;
+  double              tim1val;
+  size_t              siz0val;
+  size_t              siz1val;
+  int                 passnbr;
+  int                 passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 2) || (argc > 3)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [pass_number]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+  passnbr = (argc > 2) ? atoi (argv[2]) : 1;
+  if (passnbr < 1)
+    passnbr = 1;
+
+  fileBlockInit (C_fileTab, 1);                   /* Set default stream pointers */
+  fileBlockName (C_fileTab, 0) = argv[1];         /* Use provided file           */
+  if (fileBlockOpen (C_fileTab, 1) != 0) {        /* Open possibly compressed file */
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_graphLoad (&grafdat, fileBlockFile (C_fileTab, 0), -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+  fileBlockClose (C_fileTab, 1);
+
+  grafptr = (Graph *) (void *) &grafdat;
+  packptr = (Graph *) (void *) &packdat;
+  coa0ptr = (Graph *) (void *) &coa0dat;
+  coa1ptr = (Graph *) (void *) &coa1dat;
+  SCOTCH_graphInit (&packdat);
+  if ((graphClone (grafptr, packptr) != 0) ||
+      (graphPack  (packptr) != 0)) {
+    SCOTCH_errorPrint ("main: cannot pack graph");
+    exit (EXIT_FAILURE);
+  }
+  if (graphCheck (packptr) != 0) {
+    SCOTCH_errorPrint ("main: invalid packed graph");
+    exit (EXIT_FAILURE);
+  }
+
+  for (passnum = 0, tim0val = tim1val = 0.0; passnum < passnbr; passnum ++) {
+    timeval  = clockGet ();
+    chk0val  = testGraphTraverse (grafptr);
+    tim0val += clockGet () - timeval;
+    timeval  = clockGet ();
+    chk1val  = testGraphTraverse (packptr);
+    tim1val += clockGet () - timeval;
+    if (chk0val != chk1val) {
+      SCOTCH_errorPrint ("main: invalid packed graph traversal");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if (((mul0tab = malloc (grafptr->vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((mul1tab = malloc (grafptr->vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphInit (&coa0dat);
+  SCOTCH_graphInit (&coa1dat);
+  if ((testGraphCoarsen (&grafdat, &coa0dat, mul0tab, &dia0val) != 0) ||
+      (testGraphCoarsen (&packdat, &coa1dat, mul1tab, &dia1val) != 0)) {
+    SCOTCH_errorPrint ("main: cannot coarsen graphs");
+    exit (EXIT_FAILURE);
+  }
+  if (dia0val != dia1val) {
+    SCOTCH_errorPrint ("main: pseudo-diameters differ");
+    exit (EXIT_FAILURE);
+  }
+  if ((testGraphCompare (coa0ptr, coa1ptr) != 0) ||
+      (memcmp (mul0tab, mul1tab, coa0ptr->vertnbr * 2 * sizeof (SCOTCH_Num)) != 0)) {
+    SCOTCH_errorPrint ("main: coarse graphs differ");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphExit (&coa1dat);
+  SCOTCH_graphExit (&coa0dat);
+  free (mul1tab);
+  free (mul0tab);
+
+  siz0val = grafptr->edgenbr * sizeof (Gnum);
+  siz1val = packptr->packptr->bytenbr + packptr->vertnbr * sizeof (Gnum);
+
+  if ((graphUnpack (packptr) != 0) ||             /* Unpacked graph must be identical to original one */
+      (graphCheck  (packptr) != 0) ||
+      (testGraphCompare (grafptr, packptr) != 0)) {
+    SCOTCH_errorPrint ("main: invalid unpacked graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((stream = tmpfile ()) == NULL) {            /* Binary graph files are mapped when possible */
+    SCOTCH_errorPrint ("main: cannot open temporary file");
+    exit (EXIT_FAILURE);
+  }
+  if (graphSaveBgrf (grafptr, stream) != 0) {
+    SCOTCH_errorPrint ("main: cannot save binary graph");
+    exit (EXIT_FAILURE);
+  }
+  rewind (stream);
+  SCOTCH_graphInit (&mmapdat);
+  if (SCOTCH_graphLoad (&mmapdat, stream, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load binary graph");
+    exit (EXIT_FAILURE);
+  }
+  fclose (stream);                                /* Mapping outlives stream */
+
+  mmapptr = (Graph *) (void *) &mmapdat;
+  if ((graphPack   (mmapptr) != 0) ||             /* Edge array of mapped graph is rebuilt on the heap */
+      (graphUnpack (mmapptr) != 0) ||
+      (graphCheck  (mmapptr) != 0) ||
+      (testGraphCompare (grafptr, mmapptr) != 0)) {
+    SCOTCH_errorPrint ("main: invalid unpacked binary graph");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphExit (&mmapdat);                    /* Rebuilt edge array must be freed along with mapping */
+
+  printf ("Plain edge array: %ld bytes\n", (long) siz0val);
+  printf ("Packed edge array: %ld bytes (%.2f bytes per arc)\n", (long) siz1val, (double) siz1val / (double) grafptr->edgenbr);
+  printf ("Plain traversal: %g s\n", tim0val / passnbr);
+  printf ("Packed traversal: %g s\n", tim1val / passnbr);
+
+  SCOTCH_graphExit (&packdat);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011,2014,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2014,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -65,7 +65,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 28 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -135,6 +135,7 @@ void                        bgraphZero          (Bgraph * restrict const);
 int                         bgraphCheck         (const Bgraph * restrict const);
 void                        bgraphCost          (Bgraph * restrict const);
 void                        bgraphCost2         (const Bgraph * restrict const, const GraphPart * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const);
+Gnum                        bgraphCostVert      (const Bgraph * restrict const, const GraphPart * restrict const, const Gnum, Gnum * restrict const, Gnum * restrict const);
 
 int                         bgraphStoreInit     (const Bgraph * const, BgraphStore * const);
 void                        bgraphStoreExit     (BgraphStore * const);
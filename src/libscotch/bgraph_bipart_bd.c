@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2016,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 31 aug 2019     **/
 /**                # Version 7.0  : from : 28 aug 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -64,227 +64,177 @@
 #include "bgraph_bipart_bd.h"
 #include "bgraph_bipart_st.h"
 
-/*****************************/
-/*                           */
-/* This is the main routine. */
-/*                           */
-/*****************************/
+/******************************/
+/*                            */
+/* The threaded fill routine. */
+/*                            */
+/******************************/
+
+#ifndef BGRAPHBIPARTBDNOTHREAD
+static
+void
+bgraphBipartBdScanEdge (
+BgraphBipartBdThread * restrict const blocptr,    /* Pointer to local block  */
+BgraphBipartBdThread * restrict const bremptr,    /* Pointer to remote block */
+const int                             srcpval,    /* Source phase value      */
+const int                             dstpval,    /* Destination phase value */
+const void * const                    globptr)    /* Unused                  */
+{
+  blocptr->edgennd[dstpval] = blocptr->edgennd[srcpval] + ((bremptr != NULL) ? bremptr->edgennd[srcpval] : 0);
+}
 
-int
-bgraphBipartBd (
-Bgraph * restrict const           orggrafptr,     /*+ Active graph      +*/
-const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
+static
+void
+bgraphBipartBdScanAnch (
+BgraphBipartBdThread * restrict const blocptr,    /* Pointer to local block  */
+BgraphBipartBdThread * restrict const bremptr,    /* Pointer to remote block */
+const int                             srcpval,    /* Source phase value      */
+const int                             dstpval,    /* Destination phase value */
+const void * const                    globptr)    /* Unused                  */
 {
-  Gnum * restrict             queutab;
-  Gnum                        queuheadval;
-  Gnum                        queutailval;
-  Gnum                        distmax;            /* Maximum distance allowed                                     */
-  Gnum * restrict             orgindxtax;         /* Based access to index array for original graph               */
-  Gnum                        orgfronnum;
-  Gnum                        ancfronnum;
-  Gnum                        bndfronnum;
-  Bgraph                      bndgrafdat;         /* Band graph structure                                         */
-  Gnum                        bndvertnbr;         /* Number of regular vertices in band graph (without anchors)   */
-  Gnum                        bndvertnnd;
-  const Gnum * restrict       bndvnumtax;         /* Band vertex number array, recycling queutab                  */
-  Gnum * restrict             bndveextax;         /* External gain array of band graph, if present                */
-  Gnum                        bndveexnbr;         /* Number of external array vertices                            */
-  Gnum                        bndvelosum;         /* Load of regular vertices in band graph                       */
-  Gnum                        bndedlosum;         /* Sum of edge loads                                            */
-  Gnum                        bndcompsize1;       /* Number of regular vertices in part 1 of band graph           */
-  Gnum                        bndcompload1;       /* Load of regular vertices in part 1                           */
-  Gnum                        bndvlvlnum;         /* Index of first band graph vertex to belong to the last layer */
+  if (bremptr != NULL) {
+    blocptr->eancnnd0[dstpval] = blocptr->eancnnd0[srcpval] + bremptr->eancnnd0[srcpval];
+    blocptr->eancnnd1[dstpval] = blocptr->eancnnd1[srcpval] + bremptr->eancnnd1[srcpval];
+  }
+  else {
+    blocptr->eancnnd0[dstpval] = blocptr->eancnnd0[srcpval];
+    blocptr->eancnnd1[dstpval] = blocptr->eancnnd1[srcpval];
+  }
+}
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+
+/* This routine fills the vertex and edge
+** arrays of the band graph, for a range of
+** its regular vertices, as well as the edge
+** arrays of the anchor vertices. When run
+** by several threads, the number of edges
+** of each range is computed beforehand, so
+** that all edges end up at the same place
+** as with a single thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+bgraphBipartBdFill (
+ThreadDescriptor * restrict const   descptr,      /*+ Thread descriptor, or NULL if sequential +*/
+BgraphBipartBdData * restrict const dataptr)
+{
+  Gnum                        bndvertbas;         /* Start index of vertex range         */
+  Gnum                        bndvertnnd;         /* End index of vertex range           */
   Gnum                        bndvertnum;
-  Gnum                        bndeancnbr;         /* Number of anchor edges                                       */
-  Gnum                        bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
+  Gnum                        bndvlvlnum;         /* Start index of last layer in range  */
   Gnum                        bndedgenum;
-  Gnum * restrict             bndedgetax;
-  Gnum * restrict             bndedlotax;
   Gnum                        bndedgetmp;
+  Gnum                        bndeancnbr0;        /* Number of edges to anchor 0 in range */
+  Gnum                        bndeancnbr1;        /* Number of edges to anchor 1 in range */
+  Gnum                        bndvelosum;
+  Gnum                        bndcompsize1;
+  Gnum                        bndcompload1;
+  Gnum                        bndedlosum;
   Gnum                        bnddegrmax;
-  Gnum                        bndcommgainextn;    /* Sum of all external gains in band graph                      */
-  Gnum                        bndcommgainextn1;   /* Sum of external gains accounted for in load, since in part 1 */
-  size_t                      bndedlooftval;      /* Offset of edge load array with respect to edge array         */
-  const Gnum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses                                */
-  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
-  const Gnum * restrict const orgvelotax = orggrafptr->s.velotax;
-  const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
-  const Gnum * restrict const orgedlotax = orggrafptr->s.edlotax;
-  GraphPart * restrict const  orgparttax = orggrafptr->parttax;
-  Gnum * restrict const       orgfrontab = orggrafptr->frontab;
-
-  if (orggrafptr->fronnbr == 0)                   /* If no separator vertices, apply strategy to full (original) graph */
-    return (bgraphBipartSt (orggrafptr, paraptr->stratorg));
-
-  distmax = (Gnum) paraptr->distmax;
-  if (distmax < 1)                                /* Always at least one layer of vertices around separator */
-    distmax = 1;
-
-  if (memAllocGroup ((void **) (void *)
-                     &queutab,    (size_t) (orggrafptr->s.vertnbr * sizeof (Gnum)),
-                     &orgindxtax, (size_t) (orggrafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
-    errorPrint ("bgraphBipartBd: out of memory (1)");
-    return     (1);
-  }
-  memSet (orgindxtax, ~0, orggrafptr->s.vertnbr * sizeof (Gnum)); /* Initialize index array */
-  orgindxtax -= orggrafptr->s.baseval;
-
-  queuheadval = orggrafptr->fronnbr;              /* First layer is vertices in frontier array                     */
-  for (orgfronnum = 0, bndvertnnd = orggrafptr->s.baseval; /* Flag vertices belonging to frontier as band vertices */
-       orgfronnum < queuheadval; orgfronnum ++) {
-    Gnum                orgvertnum;
-
-    orgvertnum = orgfrontab[orgfronnum];
-    orgindxtax[orgvertnum] = bndvertnnd ++;
-    queutab[orgfronnum] = orgvertnum;             /* Copy frontier array in queue array */
-  }
+  Gnum                        bndcommgainextn;
+  Gnum                        bndcommgainextn1;
+
+#ifndef BGRAPHBIPARTBDNOTHREAD
+  const int                           thrdnbr = (descptr != NULL) ? threadNbr (descptr) : 1;
+  const int                           thrdnum = (descptr != NULL) ? threadNum (descptr) : 0;
+#else /* BGRAPHBIPARTBDNOTHREAD */
+  const int                           thrdnbr = 1;
+  const int                           thrdnum = 0;
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+  const int                           thrdlst = thrdnbr - 1;
+  BgraphBipartBdThread * restrict const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Bgraph * restrict const       orggrafptr = dataptr->orggrafptr;
+  const Gnum * restrict const         orgverttax = orggrafptr->s.verttax;
+  const Gnum * restrict const         orgvendtax = orggrafptr->s.vendtax;
+  const Gnum * restrict const         orgvelotax = orggrafptr->s.velotax;
+  const Gnum * restrict const         orgedgetax = orggrafptr->s.edgetax;
+  const Gnum * restrict const         orgedlotax = orggrafptr->s.edlotax;
+  const Gnum * restrict const         orgveextax = orggrafptr->veextax;
+  const GraphPart * restrict const    orgparttax = orggrafptr->parttax;
+  const Gnum * restrict const         orgindxtax = dataptr->orgindxtax;
+  Bgraph * restrict const             bndgrafptr = dataptr->bndgrafptr;
+  Gnum * restrict const               bndverttax = bndgrafptr->s.verttax;
+  Gnum * restrict const               bndvelotax = bndgrafptr->s.velotax;
+  Gnum * restrict const               bndedgetax = bndgrafptr->s.edgetax;
+  Gnum * restrict const               bndedlotax = bndgrafptr->s.edlotax;
+  const Gnum * restrict const         bndvnumtax = bndgrafptr->s.vnumtax;
+  GraphPart * restrict const          bndparttax = bndgrafptr->parttax;
+  Gnum * restrict const               bndveextax = dataptr->bndveextax;
+  const Gnum                          bndvertnbr = dataptr->bndvertnnd - bndgrafptr->s.baseval;
+
+  bndvertbas = bndgrafptr->s.baseval + DATASCAN (bndvertnbr, thrdnbr, thrdnum); /* Compute bounds of each thread */
+  bndvertnnd = bndgrafptr->s.baseval + DATASCAN (bndvertnbr, thrdnbr, thrdnum + 1);
+  bndvlvlnum = dataptr->bndvlvlnum;
+  if (bndvlvlnum < bndvertbas)
+    bndvlvlnum = bndvertbas;
+  if (bndvlvlnum > bndvertnnd)
+    bndvlvlnum = bndvertnnd;
+
+  bndedgenum = bndgrafptr->s.baseval;
+#ifndef BGRAPHBIPARTBDNOTHREAD
+  if (thrdnbr > 1) {                              /* If several threads, compute start of edge sub-array of each of them */
+    Gnum                bndedgenbr;
+
+    for (bndvertnum = bndvertbas, bndedgenbr = 0; bndvertnum < bndvlvlnum; bndvertnum ++) { /* All edges of first levels are kept */
+      Gnum                orgvertnum;
 
-  bndvelosum   = 0;
-  bndedgenbr   = 0;                               /* Estimate upper bound on the number of edges */
-  bndcompsize1 = 0;
-  bndcompload1 = 0;
-  queutailval  = 0;
-  bndvlvlnum   = 0;                               /* Assume first layer is last layer   */
-  while (distmax -- > 0) {                        /* For all passes except the last one */
-    bndvlvlnum = queuheadval;                     /* Record start of last layer         */
-    while (queutailval < bndvlvlnum) {            /* For all vertices in queue          */
+      orgvertnum  = bndvnumtax[bndvertnum];
+      bndedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
+    }
+    for ( ; bndvertnum < bndvertnnd; bndvertnum ++) { /* Vertices of last level keep band edges, plus possibly an anchor edge */
       Gnum                orgvertnum;
       Gnum                orgedgenum;
-      Gnum                orgpartval;
-
-      orgvertnum = queutab[queutailval ++];
-#ifdef SCOTCH_DEBUG_BGRAPH2
-      if ((orgvertnum < orggrafptr->s.baseval) || (orgvertnum >= orggrafptr->s.vertnnd)) {
-        errorPrint ("bgraphBipartBd: internal error (1)");
-        return     (1);
-      }
-#endif /* SCOTCH_DEBUG_BGRAPH2 */
-      bndedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum]; /* Exact number of edges */
-      orgpartval = orgparttax[orgvertnum];
-      bndcompsize1 += orgpartval;                 /* Count vertices in part 1 */
-      if (orgvelotax != NULL) {
-        Gnum                orgveloval;
-
-        orgveloval    = orgvelotax[orgvertnum];
-        bndvelosum   += orgveloval;
-        bndcompload1 += orgveloval * orgpartval;
-      }
+      Gnum                ancedloval;
 
-      for (orgedgenum = orgverttax[orgvertnum];
+      orgvertnum = bndvnumtax[bndvertnum];
+      for (orgedgenum = orgverttax[orgvertnum], ancedloval = 0;
            orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
-        Gnum                orgvertend;
-
-        orgvertend = orgedgetax[orgedgenum];
-        if (orgindxtax[orgvertend] == ~0) {       /* If vertex not visited yet */
-          orgindxtax[orgvertend] = bndvertnnd ++; /* Flag it as enqueued       */
-          queutab[queuheadval ++] = orgvertend;   /* Enqueue it                */
-        }
+        if (orgindxtax[orgedgetax[orgedgenum]] != ~0)
+          bndedgenbr ++;
+        else
+          ancedloval += (orgedlotax != NULL) ? orgedlotax[orgedgenum] : 1;
       }
+      if (ancedloval > 0)
+        bndedgenbr ++;
     }
-  }
-  bndedgenbr += queuheadval - queutailval;        /* As many edges from anchors as remaining vertices */
-  while (queutailval < queuheadval) {             /* Process vertices in last layer                   */
-    Gnum                orgvertnum;
-    Gnum                orgpartval;
-
-    orgvertnum = queutab[queutailval ++];
-#ifdef SCOTCH_DEBUG_BGRAPH2
-    if ((orgvertnum < orggrafptr->s.baseval) || (orgvertnum >= orggrafptr->s.vertnnd)) {
-      errorPrint ("bgraphBipartBd: internal error (2)");
-      return     (1);
-    }
-#endif /* SCOTCH_DEBUG_BGRAPH2 */
-    bndedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum]; /* Upper bound on number of edges, including anchor edge */
-    orgpartval = orgparttax[orgvertnum];
-    bndcompsize1 += orgpartval;                   /* Count vertices in part 1 */
-    if (orgvelotax != NULL) {
-      Gnum                orgveloval;
-
-      orgveloval    = orgvelotax[orgvertnum];
-      bndvelosum   += orgveloval;
-      bndcompload1 += orgveloval * orgpartval;
-    }
-  }
-  bndvertnbr = bndvertnnd - orggrafptr->s.baseval;
-  if (orgvelotax == NULL) {
-    bndvelosum   = bndvertnbr;
-    bndcompload1 = bndcompsize1;
-  }
 
-  if ((bndcompsize1 >= (orggrafptr->s.vertnbr - orggrafptr->compsize0)) || /* If either part has all of its vertices in band, use plain graph instead */
-      ((bndvertnbr - bndcompsize1) >= orggrafptr->compsize0)) {
-    memFree (queutab);
-    return  (bgraphBipartSt (orggrafptr, paraptr->stratorg));
-  }                                               /* TRICK: since always at least one missing vertex per part, there is room for anchor vertices */
-
-  queutab[bndvertnbr]     =                       /* Anchor vertices do not have original vertex numbers */
-  queutab[bndvertnbr + 1] = -1;
-
-  memSet (&bndgrafdat, 0, sizeof (Bgraph));
-  bndgrafdat.s.flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP | BGRAPHHASANCHORS; /* All Bgraph arrays are non-freeable by bgraphExit() */
-  bndgrafdat.s.baseval = orggrafptr->s.baseval;
-  bndgrafdat.s.vertnbr = bndvertnbr += 2;         /* "+ 2" for anchor vertices */
-  bndgrafdat.s.vertnnd = bndvertnnd + 2;
-
-  bndveexnbr = (orggrafptr->veextax != NULL) ? bndvertnbr : 0;
-  if (memAllocGroup ((void **) (void *)           /* Do not allocate vnumtax but keep queutab instead */
-                     &bndgrafdat.s.verttax, (size_t) ((bndvertnbr + 1) * sizeof (Gnum)),
-                     &bndgrafdat.s.velotax, (size_t) (bndvertnbr       * sizeof (Gnum)),
-                     &bndveextax,           (size_t) (bndveexnbr       * sizeof (Gnum)),
-                     &bndgrafdat.frontab,   (size_t) (bndvertnbr       * sizeof (Gnum)),
-                     &bndgrafdat.parttax,   (size_t) (bndvertnbr       * sizeof (GraphPart)), NULL) == NULL) {
-    errorPrint ("bgraphBipartBd: out of memory (2)");
-    memFree    (queutab);
-    return     (1);
+    thrdptr->edgennd[0] = bndedgenbr;
+    threadScan (descptr, (void *) thrdptr, sizeof (BgraphBipartBdThread), (ThreadScanFunc) bgraphBipartBdScanEdge, NULL);
+    bndedgenum += thrdptr->edgennd[0] - bndedgenbr;
   }
-  bndgrafdat.parttax   -= orggrafptr->s.baseval;  /* From now on we should free a Bgraph and not a Graph */
-  bndgrafdat.s.verttax -= orggrafptr->s.baseval;
-  bndgrafdat.s.vendtax  = bndgrafdat.s.verttax + 1; /* Band graph is compact */
-  bndgrafdat.s.velotax -= orggrafptr->s.baseval;
-  bndgrafdat.s.vnumtax  = queutab - orggrafptr->s.baseval; /* TRICK: re-use queue array as vertex number array since vertices taken in queue order; will not be freed as graph vertex arrays are said to be grouped */
-  bndgrafdat.s.velosum  = orggrafptr->s.velosum;
-  bndgrafdat.s.velotax[bndvertnnd]     = orggrafptr->compload0 - (bndvelosum - bndcompload1); /* Set loads of anchor vertices */
-  bndgrafdat.s.velotax[bndvertnnd + 1] = orggrafptr->s.velosum - orggrafptr->compload0 - bndcompload1;
-  if (bndveexnbr != 0) {
-    bndveextax -= orggrafptr->s.baseval;
-    bndgrafdat.veextax = bndveextax;
-  }
-  else
-    bndveextax = NULL;
-
-  if (memAllocGroup ((void **) (void *)
-                     &bndgrafdat.s.edgetax, (size_t) (bndedgenbr * sizeof (Gnum)),
-                     &bndgrafdat.s.edlotax, (size_t) (bndedgenbr * sizeof (Gnum)), NULL) == NULL) {
-    errorPrint ("bgraphBipartBd: out of memory (3)");
-    bgraphExit (&bndgrafdat);
-    memFree    (queutab);
-    return     (1);
-  }
-  bndgrafdat.s.edgetax -= orggrafptr->s.baseval;
-  bndgrafdat.s.edlotax -= orggrafptr->s.baseval;
-  bndedgetax = bndgrafdat.s.edgetax;
-  bndedlotax = bndgrafdat.s.edlotax;
-  bndvnumtax = bndgrafdat.s.vnumtax;
-
-  bndvlvlnum += orggrafptr->s.baseval;            /* Now bndvlvlnum is based */
-  for (bndvertnum = bndedgenum = orggrafptr->s.baseval,
-       bnddegrmax = bndedlosum = bndcommgainextn = bndcommgainextn1 = 0;
-       bndvertnum < bndvlvlnum; bndvertnum ++) {  /* Fill index array for vertices not belonging to last level */
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+
+  bndvelosum       =
+  bndcompsize1     =
+  bndcompload1     =
+  bndedlosum       =
+  bnddegrmax       =
+  bndcommgainextn  =
+  bndcommgainextn1 = 0;
+  for (bndvertnum = bndvertbas; bndvertnum < bndvlvlnum; bndvertnum ++) { /* Fill index array for vertices not belonging to last level */
     Gnum                orgvertnum;
     GraphPart           orgpartval;
     Gnum                orgedgenum;
     Gnum                orgedloval;
+    Gnum                orgveloval;
     Gnum                bnddegrval;
 
     orgvertnum = bndvnumtax[bndvertnum];
     orgpartval = orgparttax[orgvertnum];
-    bndgrafdat.s.verttax[bndvertnum] = bndedgenum;
-    bndgrafdat.s.velotax[bndvertnum] = (orgvelotax != NULL) ? orgvelotax[orgvertnum] : 1;
-    bndgrafdat.parttax[bndvertnum] = orgpartval;
+    orgveloval = (orgvelotax != NULL) ? orgvelotax[orgvertnum] : 1;
+    bndverttax[bndvertnum] = bndedgenum;
+    bndvelotax[bndvertnum] = orgveloval;
+    bndparttax[bndvertnum] = orgpartval;
+    bndvelosum   += orgveloval;
+    bndcompsize1 += (Gnum) orgpartval;            /* Count vertices in part 1 */
+    bndcompload1 += orgveloval * (Gnum) orgpartval;
     if (bndveextax != NULL) {
       Gnum                orgveexval;
 
-      orgveexval = orggrafptr->veextax[orgvertnum];
+      orgveexval = orgveextax[orgvertnum];
       bndveextax[bndvertnum] = orgveexval;
       bndcommgainextn       += orgveexval;
       bndcommgainextn1      += orgveexval * (Gnum) orgpartval;
@@ -294,11 +244,8 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
          orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++, bndedgenum ++) {
 
 #ifdef SCOTCH_DEBUG_BGRAPH2
-      if ((bndedgenum >= (bndedgenbr + orggrafptr->s.baseval)) ||
-          (orgindxtax[orgedgetax[orgedgenum]] < 0)) {
-        errorPrint ("bgraphBipartBd: internal error (3)");
-        return     (1);
-      }
+      if (orgindxtax[orgedgetax[orgedgenum]] < 0)
+        errorPrint ("bgraphBipartBdFill: internal error (1)");
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
       if (orgedlotax != NULL)
         orgedloval = orgedlotax[orgedgenum];
@@ -307,28 +254,34 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
       bndedlotax[bndedgenum] = orgedloval;
     }
 
-    bnddegrval = bndedgenum - bndgrafdat.s.verttax[bndvertnum];
+    bnddegrval = bndedgenum - bndverttax[bndvertnum];
     if (bnddegrmax < bnddegrval)
       bnddegrmax = bnddegrval;
   }
-  bndeancnbr = 0;
+  bndeancnbr0 =
+  bndeancnbr1 = 0;
   for ( ; bndvertnum < bndvertnnd; bndvertnum ++) { /* Fill index array for vertices belonging to last level */
     Gnum                orgvertnum;
     Gnum                orgedgenum;
     GraphPart           orgpartval;
     Gnum                bnddegrval;
     Gnum                orgedloval;
+    Gnum                orgveloval;
     Gnum                ancedloval;               /* Accumulated edge load for anchor edge */
 
     orgvertnum = bndvnumtax[bndvertnum];
     orgpartval = orgparttax[orgvertnum];
-    bndgrafdat.s.verttax[bndvertnum] = bndedgenum;
-    bndgrafdat.s.velotax[bndvertnum] = (orgvelotax != NULL) ? orgvelotax[orgvertnum] : 1;
-    bndgrafdat.parttax[bndvertnum] = orgpartval;  /* Record part for vertices of last level */
+    orgveloval = (orgvelotax != NULL) ? orgvelotax[orgvertnum] : 1;
+    bndverttax[bndvertnum] = bndedgenum;
+    bndvelotax[bndvertnum] = orgveloval;
+    bndparttax[bndvertnum] = orgpartval;          /* Record part for vertices of last level */
+    bndvelosum   += orgveloval;
+    bndcompsize1 += (Gnum) orgpartval;
+    bndcompload1 += orgveloval * (Gnum) orgpartval;
     if (bndveextax != NULL) {
       Gnum                orgveexval;
 
-      orgveexval = orggrafptr->veextax[orgvertnum];
+      orgveexval = orgveextax[orgvertnum];
       bndveextax[bndvertnum] = orgveexval;
       bndcommgainextn       += orgveexval;
       bndcommgainextn1      += orgveexval * (Gnum) orgpartval;
@@ -340,12 +293,6 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
          orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
       Gnum                bndvertend;
 
-#ifdef SCOTCH_DEBUG_BGRAPH2
-      if (bndedgenum >= (bndedgenbr + orggrafptr->s.baseval)) {
-        errorPrint ("bgraphBipartBd: internal error (4)");
-        return     (1);
-      }
-#endif /* SCOTCH_DEBUG_BGRAPH2 */
       if (orgedlotax != NULL)
         orgedloval = orgedlotax[orgedgenum];
       bndedlosum += orgedloval;                   /* Normal arcs are accounted for twice; anchor arcs only once */
@@ -361,40 +308,42 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
     bndedlosum += ancedloval;                     /* Account for anchor edges a second time */
     if (ancedloval > 0) {                         /* If vertex is connected to rest of part */
       bndedlotax[bndedgenum]    = ancedloval;
-      bndedgetax[bndedgenum ++] = bndvertnnd + (Gnum) orgpartval; /* Add anchor edge to proper anchor vertex */
-      bndeancnbr ++;
+      bndedgetax[bndedgenum ++] = dataptr->bndvertnnd + (Gnum) orgpartval; /* Add anchor edge to proper anchor vertex */
+      if (orgpartval == 0)
+        bndeancnbr0 ++;
+      else
+        bndeancnbr1 ++;
     }
-    bnddegrval = bndedgenum - bndgrafdat.s.verttax[bndvertnum];
+    bnddegrval = bndedgenum - bndverttax[bndvertnum];
     if (bnddegrmax < bnddegrval)
       bnddegrmax = bnddegrval;
   }
-  bndgrafdat.parttax[bndvertnnd]     = 0;         /* Set parts of anchor vertices */
-  bndgrafdat.parttax[bndvertnnd + 1] = 1;
-
-  bndgrafdat.s.edlosum = bndedlosum;
-  bndgrafdat.s.verttax[bndvertnnd] = bndedgenum;  /* Mark end of regular edge array and start of first anchor edge array */
-  bndedgetmp = bndedgenum + bndeancnbr;
-#ifdef SCOTCH_DEBUG_BGRAPH2
-  if ((bndedgetmp - 1) >= (bndedgenbr + orggrafptr->s.baseval)) {
-    errorPrint ("bgraphBipartBd: internal error (5)");
-    return     (1);
-  }
-#endif /* SCOTCH_DEBUG_BGRAPH2 */
-  bndgrafdat.s.edgenbr = bndedgetmp - orggrafptr->s.baseval;
-  bndgrafdat.s.verttax[bndvertnnd + 2] = bndedgetmp; /* Mark end of edge array with anchor vertices             */
-  for (bndvertnum = bndvlvlnum; bndvertnum < bndvertnnd; bndvertnum ++) { /* Fill anchor edge arrays            */
-    if (bndgrafdat.s.verttax[bndvertnum + 1] > bndgrafdat.s.verttax[bndvertnum]) { /* If vertex is not isolated */
+  if (thrdnum == thrdlst)                         /* Last thread marks end of regular edge array and start of first anchor edge array */
+    bndverttax[dataptr->bndvertnnd] = bndedgenum;
+
+  thrdptr->eancnnd0[0] = bndeancnbr0;
+  thrdptr->eancnnd1[0] = bndeancnbr1;
+#ifndef BGRAPHBIPARTBDNOTHREAD
+  if (thrdnbr > 1)                                /* Compute start of anchor edge sub-arrays; also acts as barrier */
+    threadScan (descptr, (void *) thrdptr, sizeof (BgraphBipartBdThread), (ThreadScanFunc) bgraphBipartBdScanAnch, NULL);
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+
+  bndedgenum = bndverttax[dataptr->bndvertnnd];   /* Edges of anchor 0 follow regular edges */
+  bndedgetmp = bndedgenum + dataptr->thrdtab[thrdlst].eancnnd0[0] + dataptr->thrdtab[thrdlst].eancnnd1[0]; /* Edges of anchor 1 are filled backwards */
+  bndedgenum += thrdptr->eancnnd0[0] - bndeancnbr0;
+  bndedgetmp -= thrdptr->eancnnd1[0] - bndeancnbr1;
+  for (bndvertnum = bndvlvlnum; bndvertnum < bndvertnnd; bndvertnum ++) { /* Fill anchor edge arrays */
+    if (bndverttax[bndvertnum + 1] > bndverttax[bndvertnum]) { /* If vertex is not isolated */
       Gnum                bndedgelst;             /* Number of last edge */
       Gnum                bndvertend;
 
-      bndedgelst = bndgrafdat.s.verttax[bndvertnum + 1] - 1;
+      bndedgelst = bndverttax[bndvertnum + 1] - 1;
       bndvertend = bndedgetax[bndedgelst];        /* Get last neighbor of its edge sub-array */
-      if (bndvertend >= bndvertnnd) {             /* If it is an anchor                      */
+      if (bndvertend >= dataptr->bndvertnnd) {    /* If it is an anchor                      */
         Gnum                bndedloval;
 
-        bndedloval  = bndedlotax[bndedgelst];
-        bndedlosum += bndedloval;
-        if (bndvertend == bndvertnnd) {           /* Add edge from proper anchor */
+        bndedloval = bndedlotax[bndedgelst];      /* Anchor arcs already accounted for twice */
+        if (bndvertend == dataptr->bndvertnnd) {  /* Add edge from proper anchor */
           bndedgetax[bndedgenum]    = bndvertnum;
           bndedlotax[bndedgenum ++] = bndedloval;
         }
@@ -405,17 +354,210 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
       }
     }
   }
+
+  thrdptr->velosum       = bndvelosum;            /* Save local sums for reduction by caller */
+  thrdptr->compsize1     = bndcompsize1;
+  thrdptr->compload1     = bndcompload1;
+  thrdptr->edlosum       = bndedlosum;
+  thrdptr->degrmax       = bnddegrmax;
+  thrdptr->commgainextn  = bndcommgainextn;
+  thrdptr->commgainextn1 = bndcommgainextn1;
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+int
+bgraphBipartBd (
+Bgraph * restrict const           orggrafptr,     /*+ Active graph      +*/
+const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
+{
+  BgraphBipartBdData          filldat;            /* Data for band graph filling routine                          */
+  Gnum * restrict             queutab;
+  Gnum                        distmax;            /* Maximum distance allowed                                     */
+  Gnum * restrict             orgindxtax;         /* Based access to index array for original graph               */
+  Gnum                        orgfronnum;
+  Gnum                        ancfronnum;
+  Gnum                        bndfronnum;
+  Bgraph                      bndgrafdat;         /* Band graph structure                                         */
+  Gnum                        bndvertnbr;         /* Number of regular vertices in band graph (without anchors)   */
+  Gnum                        bndvertnnd;
+  const Gnum * restrict       bndvnumtax;         /* Band vertex number array, recycling queutab                  */
+  Gnum * restrict             bndveextax;         /* External gain array of band graph, if present                */
+  Gnum                        bndveexnbr;         /* Number of external array vertices                            */
+  Gnum                        bndvelosum;         /* Load of regular vertices in band graph                       */
+  Gnum                        bndedlosum;         /* Sum of edge loads                                            */
+  Gnum                        bndcompsize1;       /* Number of regular vertices in part 1 of band graph           */
+  Gnum                        bndcompload1;       /* Load of regular vertices in part 1                           */
+  Gnum                        bndvlvlnum;         /* Index of first band graph vertex to belong to the last layer */
+  Gnum                        bndvfixnbr;         /* Number of fixed vertices in band, always zero                */
+  Gnum                        bndvertnum;
+  Gnum                        bndedgenbr;         /* Upper bound on the number of edges, including anchor edges   */
+  Gnum                        bndedgenum;
+  Gnum * restrict             bndedgetax;
+  Gnum * restrict             bndedlotax;
+  Gnum                        bnddegrmax;
+  Gnum                        bndcommgainextn;    /* Sum of all external gains in band graph                      */
+  Gnum                        bndcommgainextn1;   /* Sum of external gains accounted for in load, since in part 1 */
+  size_t                      bndedlooftval;      /* Offset of edge load array with respect to edge array         */
+  double                      bndtimeval;         /* Start time of band graph extraction                          */
+  int                         thrdnbr;
+  int                         thrdnum;
+  const Gnum * restrict const orgverttax = orggrafptr->s.verttax; /* Fast accesses                                */
+  const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
+  const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
+  GraphPart * restrict const  orgparttax = orggrafptr->parttax;
+  Gnum * restrict const       orgfrontab = orggrafptr->frontab;
+
+  if (orggrafptr->fronnbr == 0)                   /* If no separator vertices, apply strategy to full (original) graph */
+    return (bgraphBipartSt (orggrafptr, paraptr->stratorg));
+
+  distmax = (Gnum) paraptr->distmax;
+  if (distmax < 1)                                /* Always at least one layer of vertices around separator */
+    distmax = 1;
+
+  bndtimeval = clockGet ();
+
+  if ((queutab = memAlloc (orggrafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
+    errorPrint ("bgraphBipartBd: out of memory (1)");
+    return     (1);
+  }
+  memCpy (queutab, orgfrontab, orggrafptr->fronnbr * sizeof (Gnum)); /* Copy frontier array in queue array */
+
+  if (graphBand (&orggrafptr->s, orggrafptr->fronnbr, queutab, distmax, /* First layer is vertices in frontier array */
+                 &orgindxtax, &bndvlvlnum, &bndvertnbr, &bndedgenbr,
+                 NULL, &bndvfixnbr, orggrafptr->contptr) != 0) {
+    errorPrint ("bgraphBipartBd: cannot number band vertices");
+    memFree    (queutab);
+    return     (1);
+  }
+  bndvertnnd  = bndvertnbr + orggrafptr->s.baseval;
+  bndedgenbr += bndvertnnd - bndvlvlnum;          /* As many edges from anchors as vertices in last layer */
+
+  thrdnbr = contextThreadNbr (orggrafptr->contptr);
+#ifndef BGRAPHBIPARTBDNOTHREAD
+  if (bndvertnbr < BGRAPHBIPARTBDTHRDMIN)         /* If band graph too small, fill it sequentially */
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+    thrdnbr = 1;
+
+  memSet (&bndgrafdat, 0, sizeof (Bgraph));
+  bndgrafdat.s.flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP | BGRAPHHASANCHORS; /* All Bgraph arrays are non-freeable by bgraphExit() */
+  bndgrafdat.s.baseval = orggrafptr->s.baseval;
+  bndgrafdat.s.vertnbr = bndvertnbr + 2;          /* "+ 2" for anchor vertices */
+  bndgrafdat.s.vertnnd = bndvertnnd + 2;
+
+  bndveexnbr = (orggrafptr->veextax != NULL) ? bndgrafdat.s.vertnbr : 0;
+  if (memAllocGroup ((void **) (void *)           /* Do not allocate vnumtax but keep queutab instead */
+                     &bndgrafdat.s.verttax, (size_t) ((bndgrafdat.s.vertnbr + 1) * sizeof (Gnum)),
+                     &bndgrafdat.s.velotax, (size_t) (bndgrafdat.s.vertnbr       * sizeof (Gnum)),
+                     &bndveextax,           (size_t) (bndveexnbr                 * sizeof (Gnum)),
+                     &bndgrafdat.frontab,   (size_t) (bndgrafdat.s.vertnbr       * sizeof (Gnum)),
+                     &bndgrafdat.parttax,   (size_t) (bndgrafdat.s.vertnbr       * sizeof (GraphPart)),
+                     &filldat.thrdtab,      (size_t) (thrdnbr                    * sizeof (BgraphBipartBdThread)), NULL) == NULL) {
+    errorPrint ("bgraphBipartBd: out of memory (2)");
+    memFree    (orgindxtax + orggrafptr->s.baseval);
+    memFree    (queutab);
+    return     (1);
+  }
+  bndgrafdat.parttax   -= orggrafptr->s.baseval;  /* From now on we should free a Bgraph and not a Graph */
+  bndgrafdat.s.verttax -= orggrafptr->s.baseval;
+  bndgrafdat.s.vendtax  = bndgrafdat.s.verttax + 1; /* Band graph is compact */
+  bndgrafdat.s.velotax -= orggrafptr->s.baseval;
+  bndgrafdat.s.vnumtax  = queutab - orggrafptr->s.baseval; /* TRICK: re-use queue array as vertex number array since vertices taken in queue order; will not be freed as graph vertex arrays are said to be grouped */
+  bndgrafdat.s.velosum  = orggrafptr->s.velosum;
+  if (bndveexnbr != 0) {
+    bndveextax -= orggrafptr->s.baseval;
+    bndgrafdat.veextax = bndveextax;
+  }
+  else
+    bndveextax = NULL;
+
+  if (memAllocGroup ((void **) (void *)
+                     &bndgrafdat.s.edgetax, (size_t) (bndedgenbr * sizeof (Gnum)),
+                     &bndgrafdat.s.edlotax, (size_t) (bndedgenbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("bgraphBipartBd: out of memory (3)");
+    bgraphExit (&bndgrafdat);
+    memFree    (orgindxtax + orggrafptr->s.baseval);
+    memFree    (queutab);
+    return     (1);
+  }
+  bndgrafdat.s.edgetax -= orggrafptr->s.baseval;
+  bndgrafdat.s.edlotax -= orggrafptr->s.baseval;
+  bndedgetax = bndgrafdat.s.edgetax;
+  bndedlotax = bndgrafdat.s.edlotax;
+  bndvnumtax = bndgrafdat.s.vnumtax;
+
+  filldat.orggrafptr = orggrafptr;
+  filldat.orgindxtax = orgindxtax;
+  filldat.bndgrafptr = &bndgrafdat;
+  filldat.bndveextax = bndveextax;
+  filldat.bndvlvlnum = bndvlvlnum;
+  filldat.bndvertnnd = bndvertnnd;
+#ifndef BGRAPHBIPARTBDNOTHREAD
+  if (thrdnbr > 1)
+    contextThreadLaunch (orggrafptr->contptr, (ThreadFunc) bgraphBipartBdFill, (void *) &filldat);
+  else
+#endif /* BGRAPHBIPARTBDNOTHREAD */
+    bgraphBipartBdFill (NULL, &filldat);
+
+  bndvelosum       =
+  bndcompsize1     =
+  bndcompload1     =
+  bndedlosum       =
+  bnddegrmax       =
+  bndcommgainextn  =
+  bndcommgainextn1 = 0;
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Reduce local sums of filling threads */
+    const BgraphBipartBdThread * restrict const thrdptr = &filldat.thrdtab[thrdnum];
+
+    bndvelosum       += thrdptr->velosum;
+    bndcompsize1     += thrdptr->compsize1;
+    bndcompload1     += thrdptr->compload1;
+    bndedlosum       += thrdptr->edlosum;
+    bndcommgainextn  += thrdptr->commgainextn;
+    bndcommgainextn1 += thrdptr->commgainextn1;
+    if (bnddegrmax < thrdptr->degrmax)
+      bnddegrmax = thrdptr->degrmax;
+  }
+  bndedgenum = bndgrafdat.s.verttax[bndvertnnd] + filldat.thrdtab[thrdnbr - 1].eancnnd0[0]; /* End of edge array of first anchor */
   bndgrafdat.s.verttax[bndvertnnd + 1] = bndedgenum; /* Mark end of edge array of first anchor and start of second */
+  bndgrafdat.s.verttax[bndvertnnd + 2] = bndedgenum + filldat.thrdtab[thrdnbr - 1].eancnnd1[0]; /* Mark end of edge array with anchor vertices */
+  bndgrafdat.s.edgenbr = bndgrafdat.s.verttax[bndvertnnd + 2] - orggrafptr->s.baseval;
 #ifdef SCOTCH_DEBUG_BGRAPH2
-  if (bndedgenum != bndedgetmp) {
-    errorPrint ("bgraphBipartBd: internal error (6)");
+  if (bndgrafdat.s.edgenbr > bndedgenbr) {
+    errorPrint ("bgraphBipartBd: internal error (1)");
     return     (1);
   }
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
 
+  contextStatsBand (orggrafptr->contptr, clockGet () - bndtimeval); /* Record time spent extracting band graph */
+
+  if ((bndcompsize1 >= (orggrafptr->s.vertnbr - orggrafptr->compsize0)) || /* If either part has all of its vertices in band, use plain graph instead */
+      ((bndvertnbr - bndcompsize1) >= orggrafptr->compsize0)) {
+    bgraphExit (&bndgrafdat);
+    memFree    (orgindxtax + orggrafptr->s.baseval);
+    memFree    (queutab);
+    return     (bgraphBipartSt (orggrafptr, paraptr->stratorg));
+  }                                               /* TRICK: since always at least one missing vertex per part, there is room for anchor vertices */
+
+  queutab[bndvertnbr]     =                       /* Anchor vertices do not have original vertex numbers */
+  queutab[bndvertnbr + 1] = -1;
+  bndvertnbr += 2;                                /* "+ 2" for anchor vertices */
+
+  bndgrafdat.s.velotax[bndvertnnd]     = orggrafptr->compload0 - (bndvelosum - bndcompload1); /* Set loads of anchor vertices */
+  bndgrafdat.s.velotax[bndvertnnd + 1] = orggrafptr->s.velosum - orggrafptr->compload0 - bndcompload1;
+  bndgrafdat.parttax[bndvertnnd]     = 0;         /* Set parts of anchor vertices */
+  bndgrafdat.parttax[bndvertnnd + 1] = 1;
+
+  bndgrafdat.s.edlosum = bndedlosum;
+
   if ((bndedgenum == bndgrafdat.s.verttax[bndvertnnd]) || /* If any of the anchor edges is isolated */
       (bndedgenum == bndgrafdat.s.verttax[bndvertnnd + 2])) {
     bgraphExit (&bndgrafdat);                     /* Free all band graph related data */
+    memFree    (orgindxtax + orggrafptr->s.baseval);
     memFree    (queutab);
     return     (bgraphBipartSt (orggrafptr, paraptr->stratorg)); /* Work on original graph */
   }
@@ -489,6 +631,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
       (bgraphCheck (&bndgrafdat)  != 0)) {
     errorPrint ("bgraphBipartBd: inconsistent band graph data");
     bgraphExit (&bndgrafdat);
+    memFree    (orgindxtax + orggrafptr->s.baseval);
     memFree    (queutab);
     return     (1);
   }
@@ -497,12 +640,14 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
   if (bgraphBipartSt (&bndgrafdat, paraptr->stratbnd) != 0) { /* Apply strategy to band graph */
     errorPrint ("bgraphBipartBd: cannot bipartition band graph");
     bgraphExit (&bndgrafdat);
+    memFree    (orgindxtax + orggrafptr->s.baseval);
     memFree    (queutab);
     return     (1);
   }
   if (bndgrafdat.parttax[bndvertnnd] ==           /* If band graph was too small and anchors went to the same part, apply strategy on full graph */
       bndgrafdat.parttax[bndvertnnd + 1]) {
     bgraphExit (&bndgrafdat);
+    memFree    (orgindxtax + orggrafptr->s.baseval);
     memFree    (queutab);
     return     (bgraphBipartSt (orggrafptr, paraptr->stratorg));
   }
@@ -567,7 +712,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
         if (orgindxtax[orgvertend] == ~0) {       /* If vertex never considered before */
 #ifdef SCOTCH_DEBUG_BGRAPH2
           if (orgparttax[orgvertend] != ancpartval) { /* Original vertex should always be in same part as anchor */
-            errorPrint ("bgraphBipartBd: internal error (7)");
+            errorPrint ("bgraphBipartBd: internal error (2)");
             return     (1);
           }
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
@@ -580,6 +725,7 @@ const BgraphBipartBdParam * const paraptr)        /*+ Method parameters +*/
   orggrafptr->fronnbr = orgfronnum;
 
   bgraphExit (&bndgrafdat);                       /* Free band graph structures */
+  memFree    (orgindxtax + orggrafptr->s.baseval);
   memFree    (queutab);
 
 #ifdef SCOTCH_DEBUG_BGRAPH2
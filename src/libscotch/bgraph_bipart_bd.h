@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011 ENSEIRB, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,9 +45,25 @@
 /**                                 to   : 04 nov 2010     **/
 /**                  Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 07 nov 2011     **/
+/**                  Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined BGRAPHBIPARTBDNOTHREAD)
+#define BGRAPHBIPARTBDNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined BGRAPHBIPARTBDNOTHREAD) */
+
+/*+ Minimum number of band vertices for
+    the band graph to be filled by several
+    threads.                               +*/
+
+#define BGRAPHBIPARTBDTHRDMIN       4096
+
 /*
 **  The type and structure definitions.
 */
@@ -60,6 +76,35 @@ typedef struct BgraphBipartBdParam_ {
   Strat *                   stratorg;             /*+ Strategy for original graph   +*/
 } BgraphBipartBdParam;
 
+/*+ The thread-specific data block. +*/
+
+typedef struct BgraphBipartBdThread_ {
+  Gnum                      edgennd[2];           /*+ After-last regular edge index; [2] for scan        +*/
+  Gnum                      eancnnd0[2];          /*+ After-last anchor edge index of anchor 0, for scan +*/
+  Gnum                      eancnnd1[2];          /*+ After-last anchor edge index of anchor 1, for scan +*/
+  Gnum                      velosum;              /*+ Load of regular vertices of sub-array              +*/
+  Gnum                      compsize1;            /*+ Number of vertices in part 1                       +*/
+  Gnum                      compload1;            /*+ Load of vertices in part 1                         +*/
+  Gnum                      edlosum;              /*+ Sum of edge loads                                  +*/
+  Gnum                      degrmax;              /*+ Maximum degree                                     +*/
+  Gnum                      commgainextn;         /*+ Sum of external gains                              +*/
+  Gnum                      commgainextn1;        /*+ Sum of external gains of vertices in part 1        +*/
+} BgraphBipartBdThread;
+
+/*+ The band graph filling routine parameter
+    structure. It contains the thread-independent
+    data.                                          +*/
+
+typedef struct BgraphBipartBdData_ {
+  const Bgraph *            orggrafptr;           /*+ Original graph                             +*/
+  const Gnum *              orgindxtax;           /*+ Band vertex indices of original vertices   +*/
+  Bgraph *                  bndgrafptr;           /*+ Band graph to fill                         +*/
+  Gnum *                    bndveextax;           /*+ External gain array of band graph, if any  +*/
+  Gnum                      bndvlvlnum;           /*+ Based index of first vertex of last layer  +*/
+  Gnum                      bndvertnnd;           /*+ Based after-last index of regular vertices +*/
+  BgraphBipartBdThread *    thrdtab;              /*+ Array of thread-specific data              +*/
+} BgraphBipartBdData;
+
 /*
 **  The function prototypes.
 */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011-2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011-2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.0  : from : 07 nov 2011     **/
 /**                                 to   : 08 aug 2013     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -168,6 +168,7 @@ BgraphBipartDfData * restrict const loopptr)
   Gnum                  veloval;
   float                 velfval;
   INT                   passnum;
+  double                passtim;                  /* Start time of passes                     */
   Anum                  distval;
 
 #ifndef BGRAPHBIPARTDFNOTHREAD
@@ -250,7 +251,8 @@ BgraphBipartDfData * restrict const loopptr)
       veexsum1 += veexval1;                       /* Sum all negative gains                        */
     }
 
-    difotax[vertnum] = 0.0;
+    difotax[vertnum] =                            /* Touch both arrays for memory affinity of local pages */
+    difntax[vertnum] = 0.0F;
     ielstax[vertnum] = 1.0F / (float) (edlosum + veexval - 2 * veexval1); /* Add absolute value of veexval */
   }
   if (veextax != NULL) {
@@ -283,10 +285,16 @@ skip :
     return;
   }
 
+  passtim = clockGet ();                          /* Time passes for statistics */
+
   velfval = 1.0F;                                 /* Assume no vertex loads     */
   for (passnum = loopptr->passnbr; passnum > 0; passnum --) { /* For all passes */
     Gnum                vertnum;
     Gnum                vancnnt;
+    float               varisum;                  /* Sum of variations of local values             */
+    float               valusum;                  /* Sum of absolute local values                  */
+    int                 moveval;                  /* Flag set if some local vertex changed part    */
+    int                 thrdtmp;
     float               vancval;                  /* Value to load vertex with if anchor   */
     float *             difttax;                  /* Temporary swap value                  */
     float               vancold0 = difotax[grafptr->s.vertnnd - 2]; /* Get for all threads */
@@ -296,6 +304,9 @@ skip :
 
     vancval0 =
     vancval1 = 0.0F;
+    varisum  =
+    valusum  = 0.0F;
+    moveval  = 0;
     vancval  = 0.0F;                              /* At first vertices are not anchors           */
     vertnum  = vertbas;                           /* Start processing regular vertices, then see */
     vancnnt  = vancnnd;                           /* Loop until end of (regular) vertex block    */
@@ -304,6 +315,9 @@ skip :
         Gnum                edgenum;
         Gnum                edgennd;
         float               diffval;
+        float               difnval;
+        float               difoval;
+        float               diffdlt;
 
         edgenum = verttax[vertnum];
         edgennd = vendtax[vertnum];
@@ -361,7 +375,13 @@ skip :
           vertnum = vancnnt;                      /* Skip regular computations but synchronize */
         }
 
-        difntax[vertnum] = diffval * ielstax[vertnum];
+        difnval  = diffval * ielstax[vertnum];
+        difoval  = difotax[vertnum];
+        diffdlt  = difnval - difoval;
+        varisum += (diffdlt < 0.0F) ? - diffdlt : diffdlt;
+        valusum += (difnval < 0.0F) ? - difnval : difnval;
+        moveval |= ((difnval <= 0.0F) != (difoval <= 0.0F)); /* Same part test as final part update */
+        difntax[vertnum] = difnval;
       }
       if (vertnum == vancnnd) {                   /* If first time we reach the end of regular vertices */
         loopptr->thrdtab[thrdnum].vanctab[0] = vancval0;
@@ -380,6 +400,10 @@ skip :
       vancval = loopptr->vanctab[vertnum - vancnnd] + loopptr->vanctab[vertnum - vancnnd]; /* Load variable with anchor value */
     }
 
+    loopptr->thrdtab[thrdnum].varitab[passnum & 1] = varisum; /* Parity prevents overwriting by threads ahead */
+    loopptr->thrdtab[thrdnum].valutab[passnum & 1] = valusum;
+    loopptr->thrdtab[thrdnum].movetab[passnum & 1] = moveval;
+
     difttax = (float *) difntax;                  /* Swap old and new diffusion arrays          */
     difntax = (float *) difotax;                  /* Casts to prevent IBM compiler from yelling */
     difotax = (float *) difttax;
@@ -392,6 +416,22 @@ skip :
       difotax = difntax;                          /* Roll-back to keep last valid array */
       break;
     }
+
+    for (thrdtmp = 0, varisum = valusum = 0.0F, moveval = 0; /* All threads take the same decision */
+         thrdtmp < thrdnbr; thrdtmp ++) {
+      varisum += loopptr->thrdtab[thrdtmp].varitab[passnum & 1];
+      valusum += loopptr->thrdtab[thrdtmp].valutab[passnum & 1];
+      moveval |= loopptr->thrdtab[thrdtmp].movetab[passnum & 1];
+    }
+    if ((moveval == 0) &&                         /* If diffusion has converged, stop early */
+        (varisum <= (valusum * BGRAPHBIPARTDFCONVRAT))) {
+      passnum --;                                 /* Account for current pass               */
+      break;
+    }
+  }
+  if ((thrdnum == 0) && (loopptr->abrtval == 0)) {
+    loopptr->passnum = loopptr->passnbr - passnum;
+    loopptr->passtim = clockGet () - passtim;
   }
 
   for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Update part according to diffusion state */
@@ -489,10 +529,10 @@ const BgraphBipartDfParam * const paraptr)        /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_BGRAPH1 */
 
-  if (memAllocGroup ((void **) (void *)
-                     &loopdat.thrdtab, (size_t) (thrdnbr            * sizeof (BgraphBipartDfThread)),
-                     &loopdat.difotax, (size_t) (grafptr->s.vertnbr * sizeof (float)),
-                     &loopdat.difntax, (size_t) (grafptr->s.vertnbr * sizeof (float)), NULL) == NULL) {
+  if (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                              &loopdat.thrdtab, (size_t) (thrdnbr            * sizeof (BgraphBipartDfThread)),
+                              &loopdat.difotax, (size_t) (grafptr->s.vertnbr * sizeof (float)),
+                              &loopdat.difntax, (size_t) (grafptr->s.vertnbr * sizeof (float)), NULL) == NULL) {
     errorPrint ("bgraphBipartDf: out of memory (1)");
     return     (1);
   }
@@ -501,6 +541,8 @@ const BgraphBipartDfParam * const paraptr)        /*+ Method parameters +*/
   loopdat.difotax -= grafptr->s.baseval;
   loopdat.difntax -= grafptr->s.baseval;
   loopdat.passnbr  = paraptr->passnbr;
+  loopdat.passnum  = 0;                           /* In case of early abort */
+  loopdat.passtim  = 0.0;
 
   compload0 = (paraptr->typeval == BGRAPHBIPARTDFTYPEBAL) /* If balanced parts wanted */
               ? grafptr->compload0avg             /* Target is average                */
@@ -524,7 +566,9 @@ const BgraphBipartDfParam * const paraptr)        /*+ Method parameters +*/
   grafptr->commgainextn = loopdat.thrdtab[thrdlst].commgainextn[0];
   grafptr->bbalval      = (double) ((grafptr->compload0dlt < 0) ? (- grafptr->compload0dlt) : grafptr->compload0dlt) / (double) grafptr->compload0avg;
 
-  memFree (loopdat.thrdtab);                      /* Free group leader */
+  contextArenaFree (grafptr->contptr, loopdat.thrdtab); /* Free group leader */
+
+  contextStatsPass (grafptr->contptr, (INT) loopdat.passnum, loopdat.passtim);
 
 #ifdef SCOTCH_DEBUG_BGRAPH2
   if (bgraphCheck (grafptr) != 0) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2018,2019,2021,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2018,2019,2021,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 08 nov 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,6 +58,11 @@
 
 #define BGRAPHBIPARTDFEPSILON       (1.0F / (float) (GNUMMAX))
 
+/* Relative variation of diffusion values below
+   which diffusion is considered as converged. */
+
+#define BGRAPHBIPARTDFCONVRAT       (1.0F / 1024.0F)
+
 /*+ Sign masking operator. +*/
 
 #define BGRAPHBIPARTDFGNUMSGNMSK(i) (- (Gnum) (((Gunum) (i)) >> (sizeof (Gnum) * 8 - 1)))
@@ -92,6 +97,9 @@ typedef struct BgraphBipartDfThread_ {
   float                     vanctab[2];           /*+ Area for (reducing) contributions to anchors   +*/
   Gnum                      veexsum;              /*+ Area for reducing sums of external gains       +*/
   Gnum                      veexsum1;
+  float                     varitab[2];           /*+ Sum of variations of values; [2] for parity    +*/
+  float                     valutab[2];           /*+ Sum of absolute values                         +*/
+  int                       movetab[2];           /*+ Flag set if some vertex changed part           +*/
 } BgraphBipartDfThread;
 
 /*+ The loop routine parameter
@@ -104,6 +112,8 @@ typedef struct BgraphBipartDfData_ {
   float *                   difotax;              /*+ Old diffusion value array     +*/
   BgraphBipartDfThread *    thrdtab;              /*+ Array of thread-specific data +*/
   INT                       passnbr;              /*+ Number of passes              +*/
+  INT                       passnum;              /*+ Number of passes performed    +*/
+  double                    passtim;              /*+ Time spent in passes          +*/
   float                     vanctab[2];           /*+ Anchor load arrays            +*/
   int                       abrtval;              /*+ Abort value                   +*/
 } BgraphBipartDfData;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -67,7 +67,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 20 aug 2019     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 25 jan 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -332,9 +332,9 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;
 
-  if (bgraphBipartFmTablInit (&tabldat) != 0) {
+  if (bgraphBipartFmTablInit (&tabldat, grafptr->contptr) != 0) {
     errorPrint ("bgraphBipartFm: internal error (1)"); /* Unable to do proper initialization */
-    bgraphBipartFmTablExit (&tabldat);
+    bgraphBipartFmTablExit (&tabldat, grafptr->contptr);
     return (1);
   }
 
@@ -343,7 +343,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
                      &hashtmp, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
                      &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL) {
     errorPrint ("bgraphBipartFm: out of memory (1)");
-    bgraphBipartFmTablExit (tablptr);
+    bgraphBipartFmTablExit (tablptr, grafptr->contptr);
     return (1);
   }
   hashtab = hashtmp;
@@ -357,8 +357,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
     for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) { /* Set initial gains */
       Gnum                veloval;
       Gnum                hashnum;
-      Gnum                edgenum;
-      Gnum                edloval;
+      Gnum                cutload;
+      Gnum                edlosum;
       Gnum                commcut;
       Gnum                commgain;
       int                 partval;
@@ -366,22 +366,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
 
       partval = grafptr->parttax[vertnum];
 
-      for (edgenum = verttax[vertnum], commcut = commgain = 0, edloval = 1;
-           edgenum < vendtax[vertnum]; edgenum ++) {
-        Gnum                vertend;
-        int                 partend;
-        int                 partdlt;
-
-        vertend = edgetax[edgenum];
-        partend = grafptr->parttax[vertend];
-        if (edlotax != NULL)
-          edloval = edlotax[edgenum];
-
-        partdlt   = partval ^ partend;
-        commcut  += partdlt;
-        commgain += (1 - 2 * partdlt) * edloval;
-      }
-      commgain *= domndist;                       /* Adjust internal gains with respect to external gains */
+      commcut  = bgraphCostVert (grafptr, grafptr->parttax, vertnum, &cutload, &edlosum);
+      commgain = (edlosum - 2 * cutload) * domndist; /* Adjust internal gains with respect to external gains */
       partdlt   = 2 * partval - 1;
       veloval   = (velotax != NULL) ? velotax[vertnum] : 1;
 
@@ -402,8 +388,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       Gnum                vertnum;
       Gnum                veloval;
       Gnum                hashnum;
-      Gnum                edgenum;
-      Gnum                edloval;
+      Gnum                cutload;
+      Gnum                edlosum;
       Gnum                commcut;
       Gnum                commgain;
       int                 partval;
@@ -412,22 +398,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       vertnum = grafptr->frontab[fronnum];
       partval = grafptr->parttax[vertnum];
 
-      for (edgenum = verttax[vertnum], commcut = commgain = 0, edloval = 1;
-           edgenum < vendtax[vertnum]; edgenum ++) {
-        Gnum                vertend;
-        int                 partend;
-        int                 partdlt;
-
-        vertend = edgetax[edgenum];
-        partend = grafptr->parttax[vertend];
-        if (edlotax != NULL)
-          edloval = edlotax[edgenum];
-
-        partdlt   = partval ^ partend;
-        commcut  += partdlt;
-        commgain += (1 - 2 * partdlt) * edloval;
-      }
-      commgain *= domndist;                       /* Adjust internal gains with respect to external gains */
+      commcut  = bgraphCostVert (grafptr, grafptr->parttax, vertnum, &cutload, &edlosum);
+      commgain = (edlosum - 2 * cutload) * domndist; /* Adjust internal gains with respect to external gains */
       partdlt   = 2 * partval - 1;
       veloval   = (velotax != NULL) ? velotax[vertnum] : 1;
 
@@ -599,7 +571,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
               if (bgraphBipartFmResize (&hashtab, &hashmax, &hashmsk, &savetab, savenbr, tablptr, &lockptr) != 0) {
                 errorPrint ("bgraphBipartFm: out of memory (2)");
                 memFree    (hashtab);             /* Free group leader */
-                bgraphBipartFmTablExit (tablptr);
+                bgraphBipartFmTablExit (tablptr, grafptr->contptr);
               }
               for (hashnum = (vertend * BGRAPHBIPARTFMHASHPRIME) & hashmsk; hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ; /* Search for new first free slot */
             }
@@ -847,7 +819,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
 
   memFree (hashtab);                              /* Free group leader */
-  bgraphBipartFmTablExit (tablptr);
+  bgraphBipartFmTablExit (tablptr, grafptr->contptr);
 
   return (0);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -61,7 +61,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 27 aug 2016     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -164,11 +164,11 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (((*(t)) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS)) == NULL)
+#define bgraphBipartFmTablInit(t,c) (((*(t)) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS, (c))) == NULL)
 #define bgraphBipartFmTablFree(t)   gainTablFree (*(t))
-#define bgraphBipartFmTablExit(t)   do {                     \
-                                      if (*(t) != NULL)      \
-                                        gainTablExit (*(t)); \
+#define bgraphBipartFmTablExit(t,c) do {                          \
+                                      if (*(t) != NULL)           \
+                                        gainTablExit (*(t), (c)); \
                                     } while (0)
 #define bgraphBipartFmTablAdd(t,v)  gainTablAdd ((*(t)), &(v)->gainlink, (v)->commgain)
 #define bgraphBipartFmTablDel(t,v)  gainTablDel ((*(t)), &(v)->gainlink)
@@ -197,9 +197,9 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (fiboHeapInit ((t), bgraphBipartFmCmpFunc))
+#define bgraphBipartFmTablInit(t,c) (fiboHeapInit ((t), bgraphBipartFmCmpFunc))
 #define bgraphBipartFmTablFree(t)   fiboHeapFree (t)
-#define bgraphBipartFmTablExit(t)   fiboHeapExit (t)
+#define bgraphBipartFmTablExit(t,c) fiboHeapExit (t)
 #define bgraphBipartFmTablAdd(t,v)  fiboHeapAdd ((t), &(v)->gainlink)
 #define bgraphBipartFmTablDel(t,v)  fiboHeapDel ((t), &(v)->gainlink)
 #define bgraphBipartFmIsFree(v)     ((v)->gainlink.linkdat.nextptr == BGRAPHBIPARTFMSTATEFREE)
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2013,2014,2016,2019,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2013,2014,2016,2019,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 01 may 2016     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -151,10 +151,11 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
   const Gnum * const          edlotax = grafptr->s.edlotax; /* [norestrict] */
   const Gnum * restrict const veextax = grafptr->veextax;
 
-  if ((bgraphBipartGgTablInit (&tabldat) != 0) ||
-      ((vexxtax = (BgraphBipartGgVertex *) memAlloc (grafptr->s.vertnbr * sizeof (BgraphBipartGgVertex))) == NULL)) {
+  if ((bgraphBipartGgTablInit (&tabldat, grafptr->contptr) != 0) ||
+      (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                               &vexxtax, (size_t) (grafptr->s.vertnbr * sizeof (BgraphBipartGgVertex)), NULL) == NULL)) {
     errorPrint ("bgraphBipartGg: out of memory (1)");
-    bgraphBipartGgTablExit (&tabldat);
+    bgraphBipartGgTablExit (&tabldat, grafptr->contptr);
     return (1);
   }
   vexxtax -= grafptr->s.baseval;                  /* Base access to vexxtax                */
@@ -274,10 +275,11 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
 
       if (permnum == 0) {                         /* If permutation has not been built yet  */
         if (permtab == NULL) {                    /* If permutation array not allocated yet */
-          if ((permtab = (Gnum *) memAlloc (grafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
+          if (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                                      &permtab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
             errorPrint ("bgraphBipartGg: out of memory (3)");
-            memFree    (vexxtax + grafptr->s.baseval);
-            bgraphBipartGgTablExit (&tabldat);
+            contextArenaFree (grafptr->contptr, vexxtax + grafptr->s.baseval);
+            bgraphBipartGgTablExit (&tabldat, grafptr->contptr);
             return (1);
           }
           intAscn (permtab, grafptr->s.vertnbr, grafptr->s.baseval); /* Initialize based permutation array */
@@ -345,10 +347,10 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
   grafptr->commgainextn = commgainextn;
   grafptr->bbalval      = (double) ((grafptr->compload0dlt < 0) ? (- grafptr->compload0dlt) : grafptr->compload0dlt) / (double) grafptr->compload0avg;
 
-  if (permtab != NULL)                            /* Free work arrays */
-    memFree (permtab);
-  memFree (vexxtax + grafptr->s.baseval);
-  bgraphBipartGgTablExit (&tabldat);
+  if (permtab != NULL)                            /* Free work arrays in reverse order */
+    contextArenaFree (grafptr->contptr, permtab);
+  contextArenaFree (grafptr->contptr, vexxtax + grafptr->s.baseval);
+  bgraphBipartGgTablExit (&tabldat, grafptr->contptr);
 
 #ifdef SCOTCH_DEBUG_BGRAPH2
   if (bgraphCheck (grafptr) != 0) {
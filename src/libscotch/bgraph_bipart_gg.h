@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -116,11 +116,11 @@ int                         bgraphBipartGg      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartGgTablInit(t)   (((*(t)) = gainTablInit (GAIN_LINMAX, BGRAPHBIPARTGGGAINTABLSUBBITS)) == NULL)
+#define bgraphBipartGgTablInit(t,c) (((*(t)) = gainTablInit (GAIN_LINMAX, BGRAPHBIPARTGGGAINTABLSUBBITS, (c))) == NULL)
 #define bgraphBipartGgTablFree(t)   gainTablFree (*(t))
-#define bgraphBipartGgTablExit(t)   do {                     \
-                                      if (*(t) != NULL)      \
-                                        gainTablExit (*(t)); \
+#define bgraphBipartGgTablExit(t,c) do {                          \
+                                      if (*(t) != NULL)           \
+                                        gainTablExit (*(t), (c)); \
                                     } while (0)
 #define bgraphBipartGgTablAdd(t,v)  gainTablAdd ((*(t)), &(v)->gainlink, (v)->commgain)
 #define bgraphBipartGgTablDel(t,v)  gainTablDel ((*(t)), &(v)->gainlink)
@@ -142,9 +142,9 @@ int                         bgraphBipartGg      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartGgTablInit(t)   (fiboHeapInit ((t), bgraphBipartGgCmpFunc))
+#define bgraphBipartGgTablInit(t,c) (fiboHeapInit ((t), bgraphBipartGgCmpFunc))
 #define bgraphBipartGgTablFree(t)   fiboHeapFree (t)
-#define bgraphBipartGgTablExit(t)   fiboHeapExit (t)
+#define bgraphBipartGgTablExit(t,c) fiboHeapExit (t)
 #define bgraphBipartGgTablAdd(t,v)  fiboHeapAdd ((t), &(v)->gainlink)
 #define bgraphBipartGgTablDel(t,v)  fiboHeapDel ((t), &(v)->gainlink)
 #define bgraphBipartGgTablFrst(t)   fiboHeapMin ((t))
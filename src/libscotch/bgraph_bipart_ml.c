@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2011,2014,2015,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2011,2014,2015,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 16 aug 2015     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -104,7 +105,8 @@ const BgraphBipartMlParam * const     paraptr)    /*+ Method parameters
 
   *coarmultptr = NULL;                            /* Allocate multloctab along with coarse graph */
   if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr,
-                    paraptr->coarnbr, paraptr->coarrat, GRAPHCOARSENNOCOMPACT,
+                    paraptr->coarnbr, paraptr->coarrat,
+                    GRAPHCOARSENNOCOMPACT | graphCoarsenTypeFlag (paraptr->coartype),
                     NULL, NULL, 0, finegrafptr->contptr) != 0)
     return (1);                                   /* Return if coarsening failed */
 
@@ -302,7 +304,11 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
 }
 
 /* This routine recursively performs the
-** bipartitioning recursion.
+** bipartitioning recursion. When a memory
+** budget is set and exceeded once the coarser
+** graph is built, the arrays of the current
+** graph, if it is itself a coarse graph, are
+** spilled until it is uncoarsened.
 ** It returns:
 ** - 0 : if bipartitioning could be computed.
 ** - 1 : on error.
@@ -311,19 +317,45 @@ const GraphCoarsenMulti * const coarmulttab)      /*+ Pointer to un-based multin
 static
 int
 bgraphBipartMl2 (
-Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
-const BgraphBipartMlParam * const paraptr)        /*+ Method parameters +*/
+Bgraph * restrict const           grafptr,        /*+ Active graph                         +*/
+GraphCoarsenMulti ** const        multptr,        /*+ Its multinode array, if coarse graph +*/
+GraphCoarsenBudget * const        budgptr,        /*+ Memory budget                        +*/
+const BgraphBipartMlParam * const paraptr)        /*+ Method parameters                    +*/
 {
   Bgraph              coargrafdat;
   GraphCoarsenMulti * coarmulttab;
+  GraphCoarsenSpill   spildat;
+  size_t              coarmemusiz;
   int                 o;
 
   if (bgraphBipartMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = bgraphBipartMl2         (&coargrafdat, paraptr))              == 0) &&
+    coarmemusiz = graphCoarsenSpillSize (&coargrafdat.s, coargrafdat.veextax);
+    budgptr->memunbr += coarmemusiz;
+
+    spildat.fileptr = NULL;
+    if ((multptr != NULL) &&                      /* If current graph is a coarse graph over budget */
+        (budgptr->memumax > 0) &&
+        (budgptr->memunbr > budgptr->memumax)) {
+      if (graphCoarsenSpill (&grafptr->s, *multptr, grafptr->veextax, &spildat) == 0) { /* Level remains resident if it cannot be spilled */
+        grafptr->veextax  = NULL;
+        budgptr->memunbr -= spildat.memusiz;
+      }
+    }
+
+    o = bgraphBipartMl2 (&coargrafdat, &coarmulttab, budgptr, paraptr);
+
+    if (spildat.fileptr != NULL) {                /* If current graph has been spilled */
+      if (graphCoarsenRestore (&grafptr->s, multptr, &grafptr->veextax, &spildat) != 0)
+        o = 1;
+      budgptr->memunbr += spildat.memusiz;
+    }
+
+    if ((o == 0) &&
         ((o = bgraphBipartMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = bgraphBipartSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("bgraphBipartMl2: cannot apply ascending strategy");
     bgraphExit (&coargrafdat);
+    budgptr->memunbr -= coarmemusiz;
   }
   else {
     if (((o = bgraphBipartMlUncoarsen (grafptr, NULL, NULL))        == 0) && /* Finalize graph   */
@@ -351,12 +383,18 @@ bgraphBipartMl (
 Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
 const BgraphBipartMlParam * const paraptr)        /*+ Method parameters +*/
 {
+  GraphCoarsenBudget  budgdat;
+  INT                 budgval;
   Gnum                levlnum;                    /* Save value for graph level */
   int                 o;
 
+  contextValuesGetInt (grafptr->contptr, CONTEXTOPTIONNUMMEMORYBUDGET, &budgval);
+  budgdat.memumax = (size_t) budgval * 1024;      /* Budget is expressed in kilobytes */
+  budgdat.memunbr = 0;
+
   levlnum = grafptr->levlnum;                     /* Save graph level                   */
   grafptr->levlnum = 0;                           /* Initialize coarsening level        */
-  o = bgraphBipartMl2 (grafptr, paraptr);         /* Perform multi-level bipartitioning */
+  o = bgraphBipartMl2 (grafptr, NULL, &budgdat, paraptr); /* Perform multi-level bipartitioning */
   grafptr->levlnum = levlnum;                     /* Restore graph level                */
 
   return (o);
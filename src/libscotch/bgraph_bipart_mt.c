@@ -0,0 +1,231 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_mt.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module bipartitions an active      **/
+/**                graph by applying the same strategy     **/
+/**                several times concurrently, from the    **/
+/**                same initial bipartition, and keeping   **/
+/**                the best result.                        **/
+/**                                                        **/
+/**   NOTES      : # Every try runs on a single thread,    **/
+/**                  with its own pseudo-random generator  **/
+/**                  spawned according to its try number,  **/
+/**                  and the best try is selected in try   **/
+/**                  order. Hence, for a given random      **/
+/**                  seed, the result depends neither on   **/
+/**                  the number of threads nor on their    **/
+/**                  scheduling.                           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_BGRAPH_BIPART_MT
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "bgraph.h"
+#include "bgraph_bipart_mt.h"
+#include "bgraph_bipart_st.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine runs a single try, on a
+** private copy of the part and frontier
+** arrays of the original graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+bgraphBipartMt2 (
+Context * const                   contptr,        /*+ Context of the try +*/
+const int                         trynum,         /*+ Try number         +*/
+BgraphBipartMtData * const        dataptr)        /*+ Shared try data    +*/
+{
+  BgraphBipartMtTry * restrict const  tryptr = &dataptr->trytab[trynum];
+  const Bgraph * restrict const       grafptr = dataptr->grafptr;
+
+  tryptr->grafdat = *grafptr;                     /* Share source graph and external gain arrays */
+  tryptr->grafdat.s.flagval &= ~(GRAPHFREETABS | BGRAPHFREEFRON | BGRAPHFREEPART | BGRAPHFREEVEEX);
+  tryptr->grafdat.contptr = contptr;              /* Run try in its own context */
+
+  if (memAllocGroup ((void **) (void *)
+                     &tryptr->grafdat.parttax, (size_t) (grafptr->s.vertnbr * sizeof (GraphPart)),
+                     &tryptr->grafdat.frontab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("bgraphBipartMt2: out of memory");
+    tryptr->grafdat.parttax = NULL;               /* Nothing to free */
+    tryptr->o = 1;
+    return;
+  }
+  tryptr->grafdat.parttax -= grafptr->s.baseval;
+
+  bgraphStoreUpdt (&tryptr->grafdat, dataptr->storptr); /* Start from initial bipartition */
+  tryptr->o = bgraphBipartSt (&tryptr->grafdat, dataptr->straptr);
+}
+
+/* This routine tells whether the first
+** try is better than the second one, using
+** the same criteria as the strategy
+** selection operator: balanced results are
+** preferred, then smaller cuts, then smaller
+** imbalances. Both tries must have computed
+** a bipartition.
+** It returns:
+** - 1  : if first try is better.
+** - 0  : else.
+*/
+
+static
+int
+bgraphBipartMtBetter (
+const Bgraph * const        gra0ptr,
+const Bgraph * const        gra1ptr)
+{
+  Gnum                compload0;
+  int                 b0;
+  int                 b1;
+
+  compload0 = gra0ptr->compload0avg + gra0ptr->compload0dlt;
+  b0 = ((compload0 < gra0ptr->compload0min) ||
+        (compload0 > gra0ptr->compload0max)) ? 1 : 0;
+  compload0 = gra1ptr->compload0avg + gra1ptr->compload0dlt;
+  b1 = ((compload0 < gra1ptr->compload0min) ||
+        (compload0 > gra1ptr->compload0max)) ? 1 : 0;
+
+  if (b0 != b1)
+    return ((b0 < b1) ? 1 : 0);
+  if (b0 == 0)                                    /* If both are valid, compare on cut */
+    return (( (gra0ptr->commload <  gra1ptr->commload) ||
+             ((gra0ptr->commload == gra1ptr->commload) &&
+              (abs (gra0ptr->compload0dlt) < abs (gra1ptr->compload0dlt)))) ? 1 : 0);
+  return (( (abs (gra0ptr->compload0dlt) <  abs (gra1ptr->compload0dlt)) || /* Else compare on imbalance */
+           ((abs (gra0ptr->compload0dlt) == abs (gra1ptr->compload0dlt)) &&
+            (gra0ptr->commload < gra1ptr->commload))) ? 1 : 0);
+}
+
+/* This routine performs the bipartitioning.
+** It returns:
+** - 0   : if bipartitioning could be computed.
+** - 1   : on error.
+*/
+
+int
+bgraphBipartMt (
+Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
+const BgraphBipartMtParam * const paraptr)        /*+ Method parameters +*/
+{
+  BgraphBipartMtData  datadat;
+  BgraphStore         storval;                    /* Initial, then best bipartition */
+  BgraphBipartMtTry * trytab;
+  INT                 trynbr;
+  INT                 trynum;
+  INT                 trybst;
+  int                 o;
+
+  trynbr = paraptr->trynbr;
+  if (trynbr < 1) {
+    errorPrint ("bgraphBipartMt: invalid number of tries");
+    return (1);
+  }
+
+  if ((trytab = memAlloc (trynbr * sizeof (BgraphBipartMtTry))) == NULL) {
+    errorPrint ("bgraphBipartMt: out of memory (1)");
+    return (1);
+  }
+  if (bgraphStoreInit (grafptr, &storval) != 0) {
+    errorPrint ("bgraphBipartMt: out of memory (2)");
+    memFree    (trytab);
+    return (1);
+  }
+  bgraphStoreSave (grafptr, &storval);            /* Save initial bipartition for all tries */
+
+  datadat.grafptr = grafptr;
+  datadat.storptr = &storval;
+  datadat.straptr = paraptr->strat;
+  datadat.trytab  = trytab;
+  if (contextThreadLaunchMulti (grafptr->contptr, (int) trynbr, (ContextSplitFunc) bgraphBipartMt2, (void *) &datadat) != 0) {
+    errorPrint      ("bgraphBipartMt: cannot launch tries");
+    bgraphStoreExit (&storval);
+    memFree         (trytab);
+    return (1);
+  }
+
+  for (trynum = 0, trybst = -1; trynum < trynbr; trynum ++) { /* Select best try in try order */
+    if (trytab[trynum].o != 0)                    /* If try did not bipartition */
+      continue;
+    if ((trybst < 0) ||
+        (bgraphBipartMtBetter (&trytab[trynum].grafdat, &trytab[trybst].grafdat) != 0))
+      trybst = trynum;
+  }
+
+  o = 1;
+  if (trybst >= 0) {                              /* If at least one try did bipartition */
+    bgraphStoreSave (&trytab[trybst].grafdat, &storval);
+    bgraphStoreUpdt (grafptr, &storval);          /* Bipartition of best try becomes current */
+    o = 0;
+  }
+
+  for (trynum = 0; trynum < trynbr; trynum ++) {
+    if (trytab[trynum].grafdat.parttax != NULL)   /* If try arrays were allocated */
+      memFree (trytab[trynum].grafdat.parttax + grafptr->s.baseval); /* Free group leader */
+  }
+  bgraphStoreExit (&storval);
+  memFree         (trytab);
+
+#ifdef SCOTCH_DEBUG_BGRAPH2
+  if (bgraphCheck (grafptr) != 0) {
+    errorPrint ("bgraphBipartMt: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_BGRAPH2 */
+
+  return (o);
+}
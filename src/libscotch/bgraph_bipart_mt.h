@@ -0,0 +1,83 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_mt.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the function       **/
+/**                declarations for the multi-try          **/
+/**                bipartitioning method.                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct BgraphBipartMtParam_ {
+  INT                       trynbr;               /*+ Number of independent tries +*/
+  Strat *                   strat;                /*+ Strategy applied by tries   +*/
+} BgraphBipartMtParam;
+
+/*+ The data of a single try. +*/
+
+typedef struct BgraphBipartMtTry_ {
+  Bgraph                    grafdat;              /*+ Bipartition graph of the try +*/
+  int                       o;                    /*+ Return value of the strategy +*/
+} BgraphBipartMtTry;
+
+/*+ The sub-task parameter structure. +*/
+
+typedef struct BgraphBipartMtData_ {
+  const Bgraph *            grafptr;              /*+ Original graph                  +*/
+  const BgraphStore *       storptr;              /*+ Initial bipartition of graph    +*/
+  const Strat *             straptr;              /*+ Strategy applied by tries       +*/
+  BgraphBipartMtTry *       trytab;               /*+ Array of try data               +*/
+} BgraphBipartMtData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_BGRAPH_BIPART_MT
+static void                 bgraphBipartMt2     (Context * const, const int, BgraphBipartMtData * const);
+static int                  bgraphBipartMtBetter (const Bgraph * const, const Bgraph * const);
+#endif /* SCOTCH_BGRAPH_BIPART_MT */
+
+int                         bgraphBipartMt      (Bgraph * restrict const, const BgraphBipartMtParam * const);
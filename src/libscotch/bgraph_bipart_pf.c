@@ -0,0 +1,503 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_pf.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module bipartitions an active      **/
+/**                graph by refining its frontier with     **/
+/**                concurrent gain computations, in the    **/
+/**                spirit of the Fiduccia-Mattheyses       **/
+/**                heuristic.                              **/
+/**                                                        **/
+/**   NOTES      : # Every pass, threads compute in        **/
+/**                  parallel the gains of the vertices    **/
+/**                  of their own vertex range, and select **/
+/**                  candidate moves, including slightly   **/
+/**                  negative ones for hill-climbing.      **/
+/**                  Moves which are spoiled by better     **/
+/**                  neighbor moves are filtered out, and  **/
+/**                  the remaining ones are applied in     **/
+/**                  ascending gain order, as long as      **/
+/**                  balance is preserved. The best state  **/
+/**                  found across passes is kept.          **/
+/**                # When the graph has anchors, as is     **/
+/**                  the case for band graphs, the two     **/
+/**                  anchor vertices are never moved.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "bgraph.h"
+#include "bgraph_bipart_gg.h"
+#include "bgraph_bipart_pf.h"
+
+/************************************/
+/*                                  */
+/* The threaded reduction routines. */
+/*                                  */
+/************************************/
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+static
+void
+bgraphBipartPfScan (
+BgraphBipartPfThread * restrict const blocptr,    /* Pointer to local block  */
+BgraphBipartPfThread * restrict const bremptr,    /* Pointer to remote block */
+const int                             srcpval,    /* Source phase value      */
+const int                             dstpval,    /* Destination phase value */
+const void * const                    globptr)    /* Unused                  */
+{
+  blocptr->fronnnd[dstpval] = blocptr->fronnnd[srcpval] + ((bremptr != NULL) ? bremptr->fronnnd[srcpval] : 0);
+}
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+/*********************/
+/*                   */
+/* The gain routine. */
+/*                   */
+/*********************/
+
+/* This routine computes the communication
+** gain of moving the given vertex to the
+** other part, with respect to the current
+** state of the part array.
+** It returns:
+** - the gain, that is, the variation of
+**   the communication load, in all cases.
+*/
+
+static
+Gnum
+bgraphBipartPfGain (
+const Bgraph * restrict const grafptr,
+const Gnum                    vertnum,
+Gnum * restrict const         cutpptr,            /*+ Pointer to number of cut edges of vertex    +*/
+Gnum * restrict const         intnptr)            /*+ Pointer to internal load of vertex, or NULL +*/
+{
+  Gnum                cutload;
+  Gnum                edlosum;
+  Gnum                commgain;
+  int                 partval;
+
+  partval  = (int) grafptr->parttax[vertnum];
+  *cutpptr = bgraphCostVert (grafptr, grafptr->parttax, vertnum, &cutload, &edlosum);
+  commgain = (edlosum - 2 * cutload) * grafptr->domndist; /* Adjust internal gains with respect to external gains */
+  if (grafptr->veextax != NULL)
+    commgain += (1 - 2 * partval) * grafptr->veextax[vertnum];
+
+  if (intnptr != NULL)
+    *intnptr = (edlosum - cutload) * grafptr->domndist;
+  return (commgain);
+}
+
+/******************************/
+/*                            */
+/* The threaded loop routine. */
+/*                            */
+/******************************/
+
+/* This routine performs the refinement
+** passes on the given part of the
+** bipartition graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+bgraphBipartPfLoop (
+ThreadDescriptor * restrict const   descptr,
+BgraphBipartPfData * restrict const loopptr)
+{
+  Gnum * restrict     movetab;                    /* Local sub-array of move pairs     */
+  Gnum                movenbr;                    /* Number of local candidate moves   */
+  Gnum                movenum;
+  Gnum                movetmp;
+  Gnum                vertbas;                    /* Start index of vertex range       */
+  Gnum                vertnnd;                    /* End index of vertex range         */
+  Gnum                vmovnnd;                    /* End index of movable vertex range */
+  Gnum                vertnum;
+  Gnum                fronnbr;                    /* Local number of frontier vertices */
+  Gnum                passnum;
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+#else /* BGRAPHBIPARTPFNOTHREAD */
+  const int                           thrdnbr = 1;
+  const int                           thrdnum = 0;
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+  Bgraph * restrict const             grafptr = loopptr->grafptr;
+  const Gnum * restrict const         verttax = grafptr->s.verttax;
+  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Gnum * restrict const         veextax = grafptr->veextax;
+  GraphPart * restrict const          parttax = grafptr->parttax;
+  GraphPart * restrict const          pbsttax = loopptr->pbsttax;
+  Gnum * restrict const               gaintax = loopptr->gaintax;
+  Gnum * restrict const               passtax = loopptr->passtax;
+  const Gnum                          baseval = grafptr->s.baseval;
+  const Gnum                          vertnbr = grafptr->s.vertnbr;
+
+  vertbas = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum); /* Compute bounds of each thread */
+  vertnnd = baseval + DATASCAN (vertnbr, thrdnbr, (thrdnum + 1));
+  vmovnnd = MIN (vertnnd, loopptr->vertnnd);      /* Anchor vertices, if any, are not movable */
+  movetab = loopptr->movetab + 2 * (vertbas - baseval);
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* No vertex is a candidate yet */
+    passtax[vertnum] = 0;
+  memCpy (pbsttax + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (GraphPart)); /* Initial state is best state to date */
+
+  for (passnum = 1; ; passnum ++) {               /* Stamps of current pass range from (4 * passnum) to (4 * passnum + 3) */
+    const Gnum          compload0dlt    = loopptr->compload0dlt;
+    const Gnum          compload0dltmit = loopptr->compload0dltmit;
+    const Gnum          compload0dltmat = loopptr->compload0dltmat;
+    const Gnum          compload0dltabs = ABS (compload0dlt);
+    Gnum                veloval;
+
+    for (vertnum = vertbas, movenbr = 0, veloval = 1; /* Select candidate moves in vertex range */
+         vertnum < vmovnnd; vertnum ++) {
+      Gnum                commgain;
+      Gnum                commcut;
+      Gnum                commintn;
+      Gnum                compgain;
+      Gnum                passval;
+
+      commgain = bgraphBipartPfGain (grafptr, vertnum, &commcut, &commintn);
+      if (velotax != NULL)
+        veloval = velotax[vertnum];
+      compgain = (2 * (Gnum) parttax[vertnum] - 1) * veloval;
+
+      if (commgain < 0)                           /* Moves which decrease the cut are always candidates */
+        passval = 4 * passnum;
+      else if ((commcut <= 0) ||                  /* Other candidates must belong to the frontier              */
+               (passtax[vertnum] == (4 * passnum - 2))) /* And must not have been moved by the previous pass */
+        continue;
+      else if (commgain <= (commintn / BGRAPHBIPARTPFCLIMBDIV)) /* Moves which lose little allow for hill-climbing */
+        passval = 4 * passnum;
+      else if (((compload0dlt < compload0dltmit) || (compload0dlt > compload0dltmat)) && /* Moves which improve a broken balance */
+               (ABS (compload0dlt + compgain) < compload0dltabs))
+        passval = 4 * passnum + 1;                /* Flag move as a balance move */
+      else
+        continue;
+
+      passtax[vertnum] = passval;
+      gaintax[vertnum] = commgain;
+      movetab[2 * movenbr]     = commgain;
+      movetab[2 * movenbr + 1] = vertnum;
+      movenbr ++;
+    }
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until all candidates are known */
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+    for (movenum = 0, movetmp = movenbr, movenbr = 0; /* Filter out moves spoiled by better neighbor moves */
+         movenum < movetmp; movenum ++) {
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edloval;
+      Gnum                commgain;
+      Gnum                commgaintmp;
+      int                 partval;
+
+      commgain = movetab[2 * movenum];
+      vertnum  = movetab[2 * movenum + 1];
+      partval  = (int) parttax[vertnum];
+      for (edgenum = verttax[vertnum], commgaintmp = 0, edloval = 1;
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+        int                 partend;
+
+        vertend = edgetax[edgenum];
+        partend = (int) parttax[vertend];
+        if (((passtax[vertend] >> 2) == passnum) && /* If neighbor will be moved before current vertex */
+            ((gaintax[vertend] < commgain) ||
+             ((gaintax[vertend] == commgain) && (vertend < vertnum))))
+          partend ^= 1;                           /* Account for it as if already moved */
+        if (edlotax != NULL)
+          edloval = edlotax[edgenum];
+
+        commgaintmp += (1 - 2 * (partval ^ partend)) * edloval;
+      }
+      commgaintmp *= grafptr->domndist;
+      if (veextax != NULL)
+        commgaintmp += (1 - 2 * partval) * veextax[vertnum];
+
+      if ((commgaintmp <= 0) ||                   /* Keep moves which do not increase the cut, or balance moves which are not spoiled */
+          (((passtax[vertnum] & 1) != 0) && (commgaintmp <= commgain))) {
+        movetab[2 * movenbr]     = commgain;      /* Keep original gain as sort key, for consistency of move ordering */
+        movetab[2 * movenbr + 1] = vertnum;
+        movenbr ++;
+      }
+    }
+    loopptr->thrdtab[thrdnum].movenbr = movenbr;
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until all moves are filtered */
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+    if (thrdnum == 0) {                           /* First thread applies moves sequentially */
+      Gnum * restrict     movetax;                /* Global move array                       */
+      Gnum                compload0dltmin;        /* Smallest imbalance allowed during pass  */
+      Gnum                compload0dltmax;        /* Largest imbalance allowed during pass   */
+      Gnum                compload0dltcur;
+      Gnum                compsize0cur;
+      Gnum                commloadcur;
+      Gnum                commgainextncur;
+      Gnum                commexcscur;            /* Load excess with respect to theoretical imbalance */
+      int                 thrdtmp;
+
+      movetax = loopptr->movetab;
+      for (thrdtmp = 1, movenbr = loopptr->thrdtab[0].movenbr; thrdtmp < thrdnbr; thrdtmp ++) { /* Gather move sub-arrays */
+        movetmp = loopptr->thrdtab[thrdtmp].movenbr;
+        memMov (movetax + 2 * movenbr, movetax + 2 * DATASCAN (vertnbr, thrdnbr, thrdtmp), 2 * movetmp * sizeof (Gnum));
+        movenbr += movetmp;
+      }
+      intSort2asc2 (movetax, movenbr);            /* Sort moves by ascending gain, then by vertex number */
+
+      compload0dltmin = MIN (compload0dlt, compload0dltmit); /* Balance must not get worse than it is */
+      compload0dltmax = MAX (compload0dlt, compload0dltmat);
+      compload0dltcur = compload0dlt;
+      compsize0cur    = loopptr->compsize0;
+      commloadcur     = loopptr->commload;
+      commgainextncur = loopptr->commgainextn;
+      for (movenum = 0, veloval = 1; movenum < movenbr; movenum ++) {
+        Gnum                vertnum;
+        Gnum                commcut;
+        Gnum                compgain;
+        int                 partval;
+
+        vertnum = movetax[2 * movenum + 1];
+        partval = (int) parttax[vertnum];
+        if (velotax != NULL)
+          veloval = velotax[vertnum];
+        compgain = (2 * partval - 1) * veloval;
+        if (((compload0dltcur + compgain) < compload0dltmin) || /* Skip moves which would break balance */
+            ((compload0dltcur + compgain) > compload0dltmax))
+          continue;
+
+        commloadcur     += bgraphBipartPfGain (grafptr, vertnum, &commcut, NULL); /* Use exact gain with respect to previous moves */
+        compload0dltcur += compgain;
+        compsize0cur    += (2 * partval - 1);
+        if (veextax != NULL)
+          commgainextncur += 2 * (2 * partval - 1) * veextax[vertnum];
+        parttax[vertnum] = (GraphPart) (partval ^ 1);
+        passtax[vertnum] = 4 * passnum + 2;       /* Lock vertex for next pass */
+      }
+
+      loopptr->compload0dlt = compload0dltcur;
+      loopptr->compsize0    = compsize0cur;
+      loopptr->commload     = commloadcur;
+      loopptr->commgainextn = commgainextncur;
+
+      commexcscur = (compload0dltcur < compload0dltmit) ? (compload0dltmit - compload0dltcur)
+                    : ((compload0dltcur > compload0dltmat) ? (compload0dltcur - compload0dltmat) : 0);
+      if ((commexcscur < loopptr->commexcsbst) || /* Record state if better balanced, or with smaller load */
+          ((commexcscur == loopptr->commexcsbst) &&
+           ((commloadcur < loopptr->commloadbst) ||
+            ((commloadcur == loopptr->commloadbst) && (ABS (compload0dltcur) < ABS (loopptr->compload0dltbst)))))) {
+        loopptr->commexcsbst     = commexcscur;
+        loopptr->compload0dltbst = compload0dltcur;
+        loopptr->compsize0bst    = compsize0cur;
+        loopptr->commloadbst     = commloadcur;
+        loopptr->commgainextnbst = commgainextncur;
+        loopptr->savenbr         = 0;             /* Reset number of passes without improvement */
+        loopptr->saveval         = 1;             /* Current state has to be saved              */
+      }
+      else {
+        loopptr->savenbr ++;
+        loopptr->saveval = 0;
+      }
+      loopptr->flagval = ((movenbr == 0) ||       /* Stop when nothing to do, when stalled, or when all passes done */
+                          (loopptr->savenbr >= BGRAPHBIPARTPFSTALLNBR) ||
+                          (passnum == loopptr->passnbr)) ? 1 : 0;
+    }
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until moves are applied */
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+    if (loopptr->saveval != 0)                    /* If new best state found, save local part of it */
+      memCpy (pbsttax + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (GraphPart));
+
+    if (loopptr->flagval != 0)
+      break;
+  }
+
+  if (loopptr->saveval == 0) {                    /* If last state is not the best one, roll back to best state */
+    memCpy (parttax + vertbas, pbsttax + vertbas, (vertnnd - vertbas) * sizeof (GraphPart));
+#ifndef BGRAPHBIPARTPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until all parts are restored */
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+  }
+
+  for (vertnum = vertbas, fronnbr = 0;            /* Build local frontier in move sub-array */
+       vertnum < vertnnd; vertnum ++) {
+    Gnum                commcut;
+
+    bgraphBipartPfGain (grafptr, vertnum, &commcut, NULL);
+    if (commcut > 0)
+      movetab[fronnbr ++] = vertnum;
+  }
+  loopptr->thrdtab[thrdnum].fronnnd[0] = fronnbr;
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+  threadScan (descptr, (void *) &loopptr->thrdtab[thrdnum], sizeof (BgraphBipartPfThread), (ThreadScanFunc) bgraphBipartPfScan, NULL);
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+  memCpy (grafptr->frontab + loopptr->thrdtab[thrdnum].fronnnd[0] - fronnbr, movetab, fronnbr * sizeof (Gnum));
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the bipartitioning.
+** It returns:
+** - 0 : if bipartitioning could be computed.
+** - 1 : on error.
+*/
+
+int
+bgraphBipartPf (
+Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
+const BgraphBipartPfParam * const paraptr)        /*+ Method parameters +*/
+{
+  BgraphBipartPfData  loopdat;
+  Gnum                comploadsum;                /* Overall vertex load sum, including fixed */
+  Gnum                compload0dltmit;
+  Gnum                compload0dltmat;
+
+  const int                 thrdnbr = contextThreadNbr (grafptr->contptr);
+#ifndef BGRAPHBIPARTPFNOTHREAD
+  const int                 thrdlst = thrdnbr - 1;
+#else /* BGRAPHBIPARTPFNOTHREAD */
+  const int                 thrdlst = 0;
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+  comploadsum = grafptr->s.velosum + grafptr->vfixload[0] + grafptr->vfixload[1];
+  compload0dltmat = (paraptr->deltval <= 0.0L) ? 0
+                    : ((Gnum) ((double) comploadsum * paraptr->deltval /
+                               (double) MAX (grafptr->domnwght[0], grafptr->domnwght[1])) + 1);
+  compload0dltmit = MAX ((grafptr->compload0min - grafptr->compload0avg), - compload0dltmat);
+  compload0dltmat = MIN ((grafptr->compload0max - grafptr->compload0avg), compload0dltmat);
+
+  if (grafptr->fronnbr == 0) {                    /* If no current frontier    */
+    if ((grafptr->compload0dlt >= compload0dltmit) && /* If balance is correct */
+        (grafptr->compload0dlt <= compload0dltmat))
+      return (0);                                 /* Nothing to do            */
+    else {                                        /* Imbalance must be fought */
+      BgraphBipartGgParam   paradat;
+
+      paradat.passnbr = 4;                        /* Use a standard algorithm */
+      if (bgraphBipartGg (grafptr, &paradat) != 0) /* Return if error         */
+        return (1);
+      if (grafptr->fronnbr == 0)                  /* If new partition has no frontier */
+        return (0);                               /* This algorithm is still useless  */
+    }
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab, (size_t) (thrdnbr                * sizeof (BgraphBipartPfThread)),
+                     &loopdat.movetab, (size_t) (grafptr->s.vertnbr * 2 * sizeof (Gnum)),
+                     &loopdat.gaintax, (size_t) (grafptr->s.vertnbr     * sizeof (Gnum)),
+                     &loopdat.passtax, (size_t) (grafptr->s.vertnbr     * sizeof (Gnum)),
+                     &loopdat.pbsttax, (size_t) (grafptr->s.vertnbr     * sizeof (GraphPart)), NULL) == NULL) {
+    errorPrint ("bgraphBipartPf: out of memory");
+    return     (1);
+  }
+
+  loopdat.grafptr          = grafptr;
+  loopdat.gaintax         -= grafptr->s.baseval;
+  loopdat.passtax         -= grafptr->s.baseval;
+  loopdat.pbsttax         -= grafptr->s.baseval;
+  loopdat.passnbr          = paraptr->passnbr;
+  loopdat.vertnnd          = ((grafptr->s.flagval & BGRAPHHASANCHORS) != 0) ? (grafptr->s.vertnnd - 2) : grafptr->s.vertnnd;
+  loopdat.compload0dltmit  = compload0dltmit;
+  loopdat.compload0dltmat  = compload0dltmat;
+  loopdat.compload0dlt     =
+  loopdat.compload0dltbst  = grafptr->compload0dlt;
+  loopdat.compsize0        =
+  loopdat.compsize0bst     = grafptr->compsize0;
+  loopdat.commload         =
+  loopdat.commloadbst      = grafptr->commload;
+  loopdat.commgainextn     =
+  loopdat.commgainextnbst  = grafptr->commgainextn;
+  loopdat.commexcsbst      = (grafptr->compload0dlt < compload0dltmit) ? (compload0dltmit - grafptr->compload0dlt)
+                             : ((grafptr->compload0dlt > compload0dltmat) ? (grafptr->compload0dlt - compload0dltmat) : 0);
+  loopdat.savenbr          = 0;
+  loopdat.saveval          = 0;
+  loopdat.flagval          = 0;
+
+#ifndef BGRAPHBIPARTPFNOTHREAD
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) bgraphBipartPfLoop, (void *) &loopdat);
+#else /* BGRAPHBIPARTPFNOTHREAD */
+  bgraphBipartPfLoop (NULL, &loopdat);
+#endif /* BGRAPHBIPARTPFNOTHREAD */
+
+  grafptr->fronnbr      = loopdat.thrdtab[thrdlst].fronnnd[0]; /* Get data after scan-reduction */
+  grafptr->compload0    = grafptr->compload0avg + loopdat.compload0dltbst;
+  grafptr->compload0dlt = loopdat.compload0dltbst;
+  grafptr->compsize0    = loopdat.compsize0bst;
+  grafptr->commload     = loopdat.commloadbst;
+  grafptr->commgainextn = loopdat.commgainextnbst;
+  grafptr->bbalval      = (double) ((grafptr->compload0dlt < 0) ? (- grafptr->compload0dlt) : grafptr->compload0dlt) / (double) grafptr->compload0avg;
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+#ifdef SCOTCH_DEBUG_BGRAPH2
+  if (bgraphCheck (grafptr) != 0) {
+    errorPrint ("bgraphBipartPf: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_BGRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,115 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bgraph_bipart_pf.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the function       **/
+/**                declarations for the multi-threaded     **/
+/**                boundary refinement bipartitioning      **/
+/**                method.                                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Hill-climbing move threshold: frontier
+    moves whose loss is smaller than this
+    fraction of the internal load of the
+    vertex are considered as candidates.  +*/
+
+#define BGRAPHBIPARTPFCLIMBDIV      4
+
+/*+ Maximum number of passes without
+    improvement before stopping.     +*/
+
+#define BGRAPHBIPARTPFSTALLNBR      4
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct BgraphBipartPfParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes to do +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio +*/
+} BgraphBipartPfParam;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct BgraphBipartPfThread_ {
+  Gnum                      movenbr;              /*+ Number of candidate moves in sub-array         +*/
+  Gnum                      fronnnd[2];           /*+ After-last frontier vertex index; [2] for scan +*/
+} BgraphBipartPfThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct BgraphBipartPfData_ {
+  Bgraph *                  grafptr;              /*+ Graph to work on                      +*/
+  BgraphBipartPfThread *    thrdtab;              /*+ Array of thread-specific data         +*/
+  Gnum *                    movetab;              /*+ Array of (gain, vertex) move pairs    +*/
+  Gnum *                    gaintax;              /*+ Gain of candidate vertices            +*/
+  Gnum *                    passtax;              /*+ Pass stamp of candidate vertices      +*/
+  GraphPart *               pbsttax;              /*+ Part array of best state to date      +*/
+  INT                       passnbr;              /*+ Maximum number of passes              +*/
+  Gnum                      vertnnd;              /*+ After-last movable vertex             +*/
+  Gnum                      compload0dltmit;      /*+ Theoretical smallest imbalance        +*/
+  Gnum                      compload0dltmat;      /*+ Theoretical largest imbalance         +*/
+  Gnum                      compload0dlt;         /*+ Current imbalance                     +*/
+  Gnum                      compload0dltbst;      /*+ Best imbalance                        +*/
+  Gnum                      compsize0;            /*+ Current number of vertices in part 0  +*/
+  Gnum                      compsize0bst;         /*+ Number of vertices in part 0 of best  +*/
+  Gnum                      commload;             /*+ Current communication load            +*/
+  Gnum                      commloadbst;          /*+ Best communication load               +*/
+  Gnum                      commgainextn;         /*+ Current external communication gain   +*/
+  Gnum                      commgainextnbst;      /*+ External communication gain of best   +*/
+  Gnum                      commexcsbst;          /*+ Imbalance excess of best state        +*/
+  INT                       savenbr;              /*+ Number of passes without improvement  +*/
+  int                       saveval;              /*+ Set if current state is best state    +*/
+  int                       flagval;              /*+ Set when no more passes are to be run +*/
+} BgraphBipartPfData;
+
+/*
+**  The function prototypes.
+*/
+
+int                         bgraphBipartPf      (Bgraph * restrict const, const BgraphBipartPfParam * const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 02 jan 2017     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -80,6 +80,8 @@
 #include "bgraph_bipart_gg.h"
 #include "bgraph_bipart_gp.h"
 #include "bgraph_bipart_ml.h"
+#include "bgraph_bipart_mt.h"
+#include "bgraph_bipart_pf.h"
 #include "bgraph_bipart_zr.h"
 #include "bgraph_bipart_st.h"
 
@@ -117,7 +119,17 @@ static union {
 static union {
   BgraphBipartMlParam       param;
   StratNodeMethodData       padding;
-} bgraphbipartstdefaultml = { { 100, 0.8L, &stratdummy, &stratdummy } };
+} bgraphbipartstdefaultml = { { 100, 0.8L, GRAPHCOARHEM, &stratdummy, &stratdummy } };
+
+static union {
+  BgraphBipartMtParam       param;
+  StratNodeMethodData       padding;
+} bgraphbipartstdefaultmt = { { 4, &stratdummy } };
+
+static union {
+  BgraphBipartPfParam       param;
+  StratNodeMethodData       padding;
+} bgraphbipartstdefaultpf = { { -1, 0.01L } };
 
 static StratMethodTab       bgraphbipartstmethtab[] = { /* Bipartitioning methods array */
                               { BGRAPHBIPARTSTMETHBD, "b",  (StratMethodFunc) bgraphBipartBd, &bgraphbipartstdefaultbd },
@@ -127,6 +139,8 @@ static StratMethodTab       bgraphbipartstmethtab[] = { /* Bipartitioning method
                               { BGRAPHBIPARTSTMETHGG, "h",  (StratMethodFunc) bgraphBipartGg, &bgraphbipartstdefaultgg },
                               { BGRAPHBIPARTSTMETHGP, "g",  (StratMethodFunc) bgraphBipartGp, &bgraphbipartstdefaultgp },
                               { BGRAPHBIPARTSTMETHML, "m",  (StratMethodFunc) bgraphBipartMl, &bgraphbipartstdefaultml },
+                              { BGRAPHBIPARTSTMETHMT, "t",  (StratMethodFunc) bgraphBipartMt, &bgraphbipartstdefaultmt },
+                              { BGRAPHBIPARTSTMETHPF, "p",  (StratMethodFunc) bgraphBipartPf, &bgraphbipartstdefaultpf },
                               { BGRAPHBIPARTSTMETHZR, "z",  (StratMethodFunc) bgraphBipartZr, NULL },
                               { -1,                   NULL, (StratMethodFunc) NULL,           NULL } };
 
@@ -191,6 +205,26 @@ static StratParamTab        bgraphbipartstparatab[] = { /* Method parameter list
                                 (byte *) &bgraphbipartstdefaultml.param,
                                 (byte *) &bgraphbipartstdefaultml.param.coarrat,
                                 NULL },
+                              { BGRAPHBIPARTSTMETHML,  STRATPARAMCASE,   "type",
+                                (byte *) &bgraphbipartstdefaultml.param,
+                                (byte *) &bgraphbipartstdefaultml.param.coartype,
+                                (void *) "hscl" },
+                              { BGRAPHBIPARTSTMETHMT,  STRATPARAMSTRAT,  "strat",
+                                (byte *) &bgraphbipartstdefaultmt.param,
+                                (byte *) &bgraphbipartstdefaultmt.param.strat,
+                                (void *) &bgraphbipartststratab },
+                              { BGRAPHBIPARTSTMETHMT,  STRATPARAMINT,    "tries",
+                                (byte *) &bgraphbipartstdefaultmt.param,
+                                (byte *) &bgraphbipartstdefaultmt.param.trynbr,
+                                NULL },
+                              { BGRAPHBIPARTSTMETHPF,  STRATPARAMINT,    "pass",
+                                (byte *) &bgraphbipartstdefaultpf.param,
+                                (byte *) &bgraphbipartstdefaultpf.param.passnbr,
+                                NULL },
+                              { BGRAPHBIPARTSTMETHPF,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &bgraphbipartstdefaultpf.param,
+                                (byte *) &bgraphbipartstdefaultpf.param.deltval,
+                                NULL },
                               { BGRAPHBIPARTSTMETHNBR, STRATPARAMINT,    NULL,
                                 NULL, NULL, NULL } };
 
@@ -241,6 +275,71 @@ StratTab                    bgraphbipartststratab = { /* Strategy tables for gra
 /*                                             */
 /***********************************************/
 
+/* This routine computes the imbalance of
+** the current bipartition, that is, the
+** deviation of the load of part 0 with
+** respect to its average, relatively to it.
+** It returns:
+** - the imbalance ratio, in all cases.
+*/
+
+static
+double
+bgraphBipartStImbalance (
+const Bgraph * restrict const grafptr)
+{
+  Gnum                compload0dlt;
+
+  if (grafptr->compload0avg <= 0)
+    return (0.0);
+
+  compload0dlt = grafptr->compload0dlt;
+  return ((double) ((compload0dlt < 0) ? - compload0dlt : compload0dlt) / (double) grafptr->compload0avg);
+}
+
+/* This routine applies the given method
+** to the given graph, and records the
+** statistics of the call in its context.
+** It returns:
+** - the value returned by the method.
+*/
+
+static
+int
+bgraphBipartStStats (
+Bgraph * restrict const       grafptr,            /*+ Active graph to bipartition +*/
+const Strat * restrict const  straptr)            /*+ Method strategy node        +*/
+{
+  StatsRecord         recodat;
+  StatsRecord *       recoold;
+  int                 o;
+
+  recodat.clasptr    = "bgraph";
+  recodat.methptr    = straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr;
+  recodat.levlnum    = grafptr->levlnum;
+  recodat.vertnbr    = grafptr->s.vertnbr;
+  recodat.edgenbr    = grafptr->s.edgenbr;
+  recodat.cutvtab[0] = (double) grafptr->commload;
+  recodat.imbvtab[0] = bgraphBipartStImbalance (grafptr);
+  recodat.passnbr    = -1;                        /* Not an iterative method unless it tells so */
+  recodat.passtim    = 0.0;
+  recodat.bandtim    = -1.0;                      /* No band graph built unless method tells so */
+  recodat.timeval    = clockGet ();
+  recoold            = grafptr->contptr->recoptr; /* Save record of enclosing call, if any */
+  grafptr->contptr->recoptr = &recodat;
+
+  o = ((BgraphBipartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+      (grafptr, (const void * const) &straptr->data.methdat.datadat);
+
+  grafptr->contptr->recoptr = recoold;
+  recodat.timeval    = clockGet () - recodat.timeval;
+  recodat.cutvtab[1] = (double) grafptr->commload;
+  recodat.imbvtab[1] = bgraphBipartStImbalance (grafptr);
+  contextStatsAdd (grafptr->contptr, &recodat);   /* Statistics are not critical */
+
+  return (o);
+}
+
 /* This routine performs the bipartitioning of
 ** the given active graph according to the
 ** given strategy.
@@ -364,6 +463,8 @@ const Strat * restrict const  straptr)            /*+ Bipartitioning strategy
 #else /* SCOTCH_DEBUG_BGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_BGRAPH2 */
+      if (grafptr->contptr->statptr != NULL)      /* If strategy statistics wanted */
+        return (bgraphBipartStStats (grafptr, straptr));
       return (((BgraphBipartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
               (grafptr, (const void * const) &straptr->data.methdat.datadat));
 #ifdef SCOTCH_DEBUG_BGRAPH2
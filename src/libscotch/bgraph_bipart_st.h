@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 05 apr 2018     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 07 nov 2024     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,8 @@ typedef enum BgraphBipartStMethodType_ {
   BGRAPHBIPARTSTMETHGG,                           /*+ Greedy Graph Growing   +*/
   BGRAPHBIPARTSTMETHGP,                           /*+ Gibbs-Poole-Stockmeyer +*/
   BGRAPHBIPARTSTMETHML,                           /*+ Multi-level (strategy) +*/
+  BGRAPHBIPARTSTMETHMT,                           /*+ Multi-try (strategy)   +*/
+  BGRAPHBIPARTSTMETHPF,                           /*+ Parallel frontier FM   +*/
   BGRAPHBIPARTSTMETHZR,                           /*+ Move all to part zero  +*/
   BGRAPHBIPARTSTMETHNBR                           /*+ Number of methods      +*/
 } BgraphBipartStMethodType;
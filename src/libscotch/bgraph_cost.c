@@ -1,4 +1,4 @@
-/* Copyright 2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                cost function computation routine.      **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 22 feb 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,65 @@
 /*                       */
 /*************************/
 
+/* This routine computes, for the given vertex,
+** the number of its neighbors which are not in
+** its part, the load of the edges linking it to
+** these neighbors, and the load of all of its
+** edges. The presence of edge loads is tested
+** once per vertex rather than once per edge,
+** and contributions are accumulated without
+** branches, so that compilers can vectorize
+** the scanning of the adjacency block.
+** It returns:
+** - the number of cut edges, in all cases.
+*/
+
+Gnum
+bgraphCostVert (
+const Bgraph * restrict const     grafptr,        /*+ Graph the topology of which to use      +*/
+const GraphPart * restrict const  parttax,        /*+ Part array to use                       +*/
+const Gnum                        vertnum,        /*+ Vertex to consider                      +*/
+Gnum * restrict const             cutlptr,        /*+ Pointer to load of cut edges to compute +*/
+Gnum * restrict const             edlsptr)        /*+ Pointer to load of all edges to compute +*/
+{
+  Gnum                edgenum;
+  Gnum                edgennd;
+  Gnum                cutnbr;                     /* Number of cut edges */
+
+  const Gnum * restrict const edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const edlotax = grafptr->s.edlotax;
+  const Gnum                  partval = (Gnum) parttax[vertnum];
+
+  edgenum = grafptr->s.verttax[vertnum];
+  edgennd = grafptr->s.vendtax[vertnum];
+  cutnbr  = 0;
+  if (edlotax == NULL) {                          /* If edges are not weighted, cut load is number of cut edges */
+    *edlsptr = edgennd - edgenum;
+    for ( ; edgenum < edgennd; edgenum ++)
+      cutnbr += partval ^ (Gnum) parttax[edgetax[edgenum]];
+    *cutlptr = cutnbr;
+  }
+  else {
+    Gnum                cutload;
+    Gnum                edlosum;
+
+    for (cutload = edlosum = 0; edgenum < edgennd; edgenum ++) {
+      Gnum                partdlt;
+      Gnum                edloval;
+
+      partdlt  = partval ^ (Gnum) parttax[edgetax[edgenum]];
+      edloval  = edlotax[edgenum];
+      cutnbr  += partdlt;
+      cutload += edloval & (- partdlt);           /* TRICK: add load only if difference in parts */
+      edlosum += edloval;
+    }
+    *cutlptr = cutload;
+    *edlsptr = edlosum;
+  }
+
+  return (cutnbr);
+}
+
 /* This routine computes the cost of the
 ** provided partition for the given graph.
 ** It returns:
@@ -86,12 +145,8 @@ Gnum * restrict const             cmgeptr)        /*+ Pointer to external commun
   Gnum                cmgesum;                    /* External communication gain                  */
   Gnum                vertnum;                    /* Number of current vertex                     */
 
-  const Gnum * restrict const       verttax = grafptr->s.verttax;
-  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
   const Gnum * restrict const       velotax = grafptr->s.velotax;
   const Gnum * restrict const       veextax = grafptr->veextax;
-  const Gnum * restrict const       edgetax = grafptr->s.edgetax;
-  const Gnum * restrict const       edlotax = grafptr->s.edlotax;
 
   fronptr = frontab;
   cpl1sum = 0;
@@ -100,12 +155,12 @@ Gnum * restrict const             cmgeptr)        /*+ Pointer to external commun
   cmlesum = grafptr->commloadextn0;
   cmgesum = 0;
   for (vertnum = grafptr->s.baseval; vertnum < grafptr->s.vertnnd; vertnum ++) {
-    Gnum                fronval;                  /* Frontier flag                        */
     Gnum                partval;                  /* Part of current vertex               */
     Gnum                partmsk;                  /* Mask for adding contributions or not */
     Gnum                veloval;                  /* Vertex load                          */
-    Gnum                edloval;                  /* Edge load                            */
-    Gnum                edgenum;                  /* Number of current edge               */
+    Gnum                cutnbr;                   /* Number of cut edges of vertex        */
+    Gnum                cutload;                  /* Load of cut edges of vertex          */
+    Gnum                edlosum;                  /* Load of all edges of vertex          */
 
     partval = (Gnum) parttax[vertnum];
     partmsk = - partval;                          /* TRICK: 0 -> 0; 1 -> 0xFF..FF */
@@ -122,21 +177,10 @@ Gnum * restrict const             cmgeptr)        /*+ Pointer to external commun
       cmgesum += veexval * (1 - 2 * partval);
     }
 
-    edloval = 1;                                  /* Assume edges are not weighted    */
-    fronval = 0;                                  /* Assume vertex is not in frontier */
-    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
-      Gnum                partend;
-      Gnum                partdlt;
-
-      if (edlotax != NULL)
-        edloval = edlotax[edgenum];
-      partend  = parttax[edgetax[edgenum]];
-      partdlt  = partval ^ partend;
-      cmlisum += edloval & (- partdlt);           /* TRICK: add load only if difference in parts; loads are counted twice */
-      fronval |= partdlt;                         /* Record whether some neighbor is not in same part as vertex           */
-    }
+    cutnbr   = bgraphCostVert (grafptr, parttax, vertnum, &cutload, &edlosum);
+    cmlisum += cutload;                           /* Cut loads are counted twice */
 
-    if ((fronptr != NULL) && (fronval != 0))      /* If frontier array wanted and vertex belongs to it */
+    if ((fronptr != NULL) && (cutnbr != 0))       /* If frontier array wanted and vertex belongs to it */
       *(fronptr ++) = vertnum;                    /* Add vertex to frontier array                      */
   }
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 02 dec 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -337,6 +337,30 @@ typedef void (* ThreadFunc) (ThreadDescriptor * const, void * const);
 typedef void (* ThreadReduceFunc) (void * const, void * const, const void * const);
 typedef void (* ThreadScanFunc) (void * const, void * const, const int, const int, const void * const);
 
+/** The abstract task scheduler context. **/
+
+struct ThreadTaskContext_;
+typedef struct ThreadTaskContext_ ThreadTaskContext;
+
+/** The task scheduler worker descriptor. **/
+
+typedef struct ThreadTaskDescriptor_ {
+  ThreadTaskContext *       contptr;              /*+ Pointer to task scheduler context +*/
+  int                       thrdnum;              /*+ Worker thread instance number     +*/
+} ThreadTaskDescriptor;
+
+/** The task routine type. **/
+
+typedef void (* ThreadTaskFunc) (ThreadTaskDescriptor * const, void * const);
+
+/** The task structure, allocated by the spawning thread. **/
+
+typedef struct ThreadTask_ {
+  ThreadTaskFunc            funcptr;              /*+ Function to call at run time  +*/
+  void *                    paraptr;              /*+ Pointer to function parameter +*/
+  int                       flagval;              /*+ Set once task has completed   +*/
+} ThreadTask;
+
 /*
 **  Handling of values.
 */
@@ -346,6 +370,53 @@ typedef void (* ThreadScanFunc) (void * const, void * const, const int, const in
 struct ValuesContext_;
 typedef struct ValuesContext_ ValuesContext;
 
+/*
+**  Handling of statistics.
+*/
+
+/*+ The abstract context statistics datatype. +*/
+
+struct StatsContext_;
+typedef struct StatsContext_ StatsContext;
+
+/*+ The statistics record of a strategy method call. +*/
+
+typedef struct StatsRecord_ {
+  const char *              clasptr;              /*+ Name of strategy class                    +*/
+  const char *              methptr;              /*+ Name of strategy method                   +*/
+  INT                       levlnum;              /*+ Coarsening or nested dissection level     +*/
+  INT                       vertnbr;              /*+ Number of vertices of processed graph     +*/
+  INT                       edgenbr;              /*+ Number of arcs of processed graph         +*/
+  double                    cutvtab[2];           /*+ Cut before and after call, or -1          +*/
+  double                    imbvtab[2];           /*+ Imbalance before and after call, or -1    +*/
+  double                    timeval;              /*+ Wall-clock time, including sub-calls      +*/
+  INT                       passnbr;              /*+ Number of iterations performed, or -1     +*/
+  double                    passtim;              /*+ Wall-clock time spent in iterations       +*/
+  double                    bandtim;              /*+ Wall-clock time spent building band graph +*/
+} StatsRecord;
+
+/*
+**  Handling of work memory.
+*/
+
+/*+ The abstract context work memory arena datatype. +*/
+
+struct ArenaContext_;
+typedef struct ArenaContext_ ArenaContext;
+
+/*
+**  Handling of cached data.
+*/
+
+/*+ The context cache header. It is the first
+    field of data structures that a context keeps
+    across library calls, so that the context can
+    free them without knowing their type.         +*/
+
+typedef struct ContextCache_ {
+  void                   (* exitfunc) (struct ContextCache_ * const); /*+ Routine to free cached data +*/
+} ContextCache;
+
 /*
 **  Handling of execution contexts.
 */
@@ -353,9 +424,15 @@ typedef struct ValuesContext_ ValuesContext;
 /** The execution context. **/
 
 typedef struct Context_ {
-  ThreadContext *           thrdptr;              /*+ Threading context +*/
-  IntRandContext *          randptr;              /*+ Random context    +*/
-  ValuesContext *           valuptr;              /*+ Values context    +*/
+  ThreadContext *           thrdptr;              /*+ Threading context                          +*/
+  IntRandContext *          randptr;              /*+ Random context                             +*/
+  ValuesContext *           valuptr;              /*+ Values context                             +*/
+  StatsContext *            statptr;              /*+ Statistics context, if any                 +*/
+  StatsRecord *             recoptr;              /*+ Record of current method call              +*/
+  ContextCache *            cachptr;              /*+ Cached data, if any                        +*/
+  ThreadTaskDescriptor *    taskptr;              /*+ Task scheduler worker, if any              +*/
+  ArenaContext *            arenptr;              /*+ Work memory arena of leader thread, if any +*/
+  ArenaContext *            arentab;              /*+ Arenas of task scheduler workers, if any   +*/
 } Context;
 
 /*+ The context splitting user function. +*/
@@ -370,6 +447,25 @@ typedef struct ContextSplit_ {
   void *                    paraptr;              /*+ Parameter data                                   +*/
 } ContextSplit;
 
+/*+ The data structure for passing arguments to the second task of a task pair. +*/
+
+typedef struct ContextTask_ {
+  ThreadTask                taskdat;              /*+ Task data for scheduler          +*/
+  Context                   contdat;              /*+ Context in which task will run   +*/
+  ContextSplitFunc          funcptr;              /*+ Pointer to user function to call +*/
+  void *                    paraptr;              /*+ Parameter data                   +*/
+} ContextTask;
+
+/*+ The data structure for passing arguments to the threads running independent sub-tasks. +*/
+
+typedef struct ContextMulti_ {
+  Context *                 contptr;              /*+ Initial context                         +*/
+  IntRandContext *          randtab;              /*+ Pseudo-random generators of sub-tasks   +*/
+  int                       tasknbr;              /*+ Number of sub-tasks                     +*/
+  ContextSplitFunc          funcptr;              /*+ Pointer to user function to call        +*/
+  void *                    paraptr;              /*+ Parameter data                          +*/
+} ContextMulti;
+
 /*
 **  Handling of files.
 */
@@ -460,14 +556,34 @@ int                         threadContextNbr    (ThreadContext * const);
 void                        threadLaunch        (ThreadContext * const, ThreadFunc const, void * const);
 void                        threadReduce        (const ThreadDescriptor * const, void * const, const size_t, ThreadReduceFunc const, const int, const void * const);
 void                        threadScan          (const ThreadDescriptor * const, void * const, const size_t, ThreadScanFunc const, const void * const);
+int                         threadTaskLaunch    (ThreadContext * const, ThreadTaskFunc const, void * const);
+void                        threadTaskSpawn     (ThreadTaskDescriptor * const, ThreadTask * const, ThreadTaskFunc const, void * const);
+void                        threadTaskWait      (ThreadTaskDescriptor * const, ThreadTask * const);
 
 void                        contextInit         (Context * const);
 void                        contextExit         (Context * const);
 int                         contextCommit       (Context * const);
 int                         contextRandomClone  (Context * const);
+int                         contextArenaInit    (Context * const);
+void                        contextArenaExit    (Context * const);
+void                        contextArenaInit2   (ArenaContext * const);
+void                        contextArenaExit2   (Context * const, ArenaContext * const);
+void *                      contextArenaAllocGroup (Context * const, void **, ...);
+void                        contextArenaFree    (Context * const, void * const);
+int                         contextStatsInit    (Context * const);
+void                        contextStatsExit    (Context * const);
+int                         contextStatsAdd     (Context * const, const StatsRecord * const);
+INT                         contextStatsNbr     (Context * const);
+const StatsRecord *         contextStatsData    (Context * const, const INT);
+void                        contextStatsPass    (Context * const, const INT, const double);
+void                        contextStatsBand    (Context * const, const double);
+void                        contextStatsArena   (Context * const, const INT, const INT);
+int                         contextStatsSave    (Context * const, FILE * const);
 int                         contextThreadInit2  (Context * const, const int, const int * const);
 int                         contextThreadInit   (Context * const);
+int                         contextThreadLaunchMulti (Context * const, const int, ContextSplitFunc const, void * const);
 int                         contextThreadLaunchSplit (Context * const, ContextSplitFunc const, void * const);
+int                         contextThreadLaunchTask (Context * const, ContextSplitFunc const, void * const);
 int                         contextValuesInit   (Context * const, void * const, const size_t, const int, const size_t, const int, const size_t);
 int                         contextValuesGetDbl (Context * const, const int, double * const);
 int                         contextValuesGetInt (Context * const, const int, INT * const);
@@ -0,0 +1,334 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_arena.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the work memory     **/
+/**                arenas of contexts, which serve the     **/
+/**                work arrays of strategy methods.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "common_arena.h"
+
+/*****************************************/
+/*                                       */
+/* These routines handle the work memory */
+/* arenas of contexts.                   */
+/*                                       */
+/*****************************************/
+
+/* Work memory arenas serve the short-lived
+** work arrays of strategy methods without
+** resorting to the system allocator, which
+** becomes a point of contention when many
+** threads run methods concurrently. An arena
+** is a stack of large chunks, from which
+** blocks are carved in sequence. Freeing a
+** block flags it, and all the flagged blocks
+** at the top of the stack are reclaimed at
+** once. Hence, blocks should be freed in
+** reverse order of their allocation, so that
+** space is recycled as soon as possible.
+** An arena must only be used by the thread
+** running the context to which it belongs,
+** and blocks must be freed within the same
+** context. Consequently, arena blocks must
+** not be handed over to data structures that
+** outlive the calling routine, nor be used
+** by the worker threads of a routine run by
+** way of contextThreadLaunch(). Blocks too
+** large to fit in chunks, as well as all
+** blocks when the context has no arena, are
+** allocated by the system.
+*/
+
+/* This routine initializes an empty arena.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextArenaInit2 (
+ArenaContext * const        arenptr)
+{
+  arenptr->chunptr = NULL;
+  arenptr->spreptr = NULL;
+  arenptr->allonbr =
+  arenptr->systnbr = 0;
+}
+
+/* This routine frees the chunks of the
+** given arena, and accounts its allocations
+** in the statistics of the given context,
+** if any.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextArenaExit2 (
+Context * const             contptr,
+ArenaContext * const        arenptr)
+{
+  ArenaChunk *        chunptr;
+  ArenaChunk *        chunnxt;
+
+#ifdef SCOTCH_DEBUG_CONTEXT1
+  if (arenptr->chunptr != NULL)
+    errorPrint ("contextArenaExit2: blocks not freed");
+#endif /* SCOTCH_DEBUG_CONTEXT1 */
+
+  for (chunptr = arenptr->chunptr; chunptr != NULL; chunptr = chunnxt) {
+    chunnxt = chunptr->prevptr;
+    memFree (chunptr);
+  }
+  if (arenptr->spreptr != NULL)
+    memFree (arenptr->spreptr);
+
+  contextStatsArena (contptr, arenptr->allonbr, arenptr->systnbr);
+}
+
+/* These routines allocate and free the
+** arena of the given context, which will
+** be used by its leader thread.
+** They return:
+** - 0   : if the arena is available.
+** - !0  : on error.
+*/
+
+int
+contextArenaInit (
+Context * const             contptr)
+{
+  ArenaContext *      arenptr;
+
+  if (contptr->arenptr != NULL)                   /* If arena already allocated */
+    return (0);
+
+  if ((arenptr = memAlloc (sizeof (ArenaContext))) == NULL) {
+    errorPrint ("contextArenaInit: out of memory");
+    return (1);
+  }
+  contextArenaInit2 (arenptr);
+  contptr->arenptr = arenptr;
+
+  return (0);
+}
+
+void
+contextArenaExit (
+Context * const             contptr)
+{
+  if (contptr->arenptr == NULL)                   /* If context has no arena */
+    return;
+
+  contextArenaExit2 (contptr, contptr->arenptr);
+  memFree (contptr->arenptr);
+  contptr->arenptr = NULL;
+}
+
+/* This routine allocates a block of the
+** given size, either from the given arena
+** or from the system.
+** It returns:
+** - !NULL  : pointer to the user area of the block.
+** - NULL   : on error.
+*/
+
+static
+void *
+contextArenaAlloc (
+ArenaContext * const        arenptr,
+size_t                      blocsiz)
+{
+  ArenaChunk *        chunptr;
+  ArenaBlock *        blokptr;
+
+#ifndef COMMON_MEMORY_CHECK                       /* Memory checking requires separate system blocks */
+  if ((arenptr != NULL) && (blocsiz <= ARENABLOKMAX)) {
+    blocsiz = (blocsiz + (sizeof (ArenaBlock) - 1)) & (~ (sizeof (ArenaBlock) - 1)); /* Keep next block aligned */
+
+    chunptr = arenptr->chunptr;
+    if ((chunptr == NULL) ||                      /* If block does not fit in current chunk */
+        ((chunptr->usedsiz + sizeof (ArenaBlock) + blocsiz) > ARENACHUNSIZE)) {
+      ArenaChunk *        chunnew;
+
+      if (arenptr->spreptr != NULL) {             /* If spare chunk available, re-use it */
+        chunnew = arenptr->spreptr;
+        arenptr->spreptr = NULL;
+      }
+      else {
+        if ((chunnew = memAlloc (ARENACHUNHEAD + ARENACHUNSIZE)) == NULL)
+          return (NULL);
+        arenptr->systnbr ++;
+      }
+      chunnew->prevptr = chunptr;                 /* Push new chunk on top of stack */
+      chunnew->usedsiz = 0;
+      chunnew->lastoff = ARENAOFFNONE;
+      arenptr->chunptr =
+      chunptr          = chunnew;
+    }
+
+    blokptr = arenaChunkBlock (chunptr, chunptr->usedsiz);
+    blokptr->prevoff  = chunptr->lastoff;
+    blokptr->flagval  = ARENABLOKUSED;
+    chunptr->lastoff  = chunptr->usedsiz;
+    chunptr->usedsiz += sizeof (ArenaBlock) + blocsiz;
+    arenptr->allonbr ++;
+
+    return ((void *) (blokptr + 1));
+  }
+#endif /* COMMON_MEMORY_CHECK */
+
+  if ((blokptr = memAlloc (sizeof (ArenaBlock) + blocsiz)) == NULL)
+    return (NULL);
+  blokptr->prevoff = ARENAOFFNONE;
+  blokptr->flagval = ARENABLOKSYST;
+  if (arenptr != NULL)
+    arenptr->systnbr ++;
+
+  return ((void *) (blokptr + 1));
+}
+
+/* This routine allocates a set of arrays in
+** a single block taken from the arena of the
+** given context, the address of which is
+** placed in the second argument. Arrays are
+** described as in memAllocGroup(). The block
+** must be freed by contextArenaFree(), called
+** within the same context.
+** It returns:
+** - !NULL  : pointer to block, all arrays allocated.
+** - NULL   : no array allocated; first block pointer is also set to NULL.
+*/
+
+void *
+contextArenaAllocGroup (
+Context * const             contptr,              /*+ Context owning the arena              +*/
+void **                     memptr,               /*+ Pointer to first argument to allocate +*/
+...)
+{
+  va_list             memlist;                    /* Argument list of the call              */
+  byte **             memloc;                     /* Pointer to pointer of current argument */
+  size_t              memoff;                     /* Offset value of argument               */
+  byte *              blkptr;                     /* Pointer to memory chunk                */
+
+  memoff = 0;
+  memloc = (byte **) memptr;                      /* Point to first memory argument */
+  va_start (memlist, memptr);                     /* Start argument parsing         */
+  while (memloc != NULL) {                        /* As long as not NULL pointer    */
+    memoff  = (memoff + (sizeof (double) - 1)) & (~ (sizeof (double) - 1));
+    memoff += va_arg (memlist, size_t);
+    memloc  = va_arg (memlist, byte **);
+  }
+  va_end (memlist);
+
+  if ((blkptr = (byte *) contextArenaAlloc (contptr->arenptr, memoff)) == NULL) { /* If cannot allocate */
+    *memptr = NULL;                               /* Set first pointer to NULL */
+    return (NULL);
+  }
+
+  memoff = 0;
+  memloc = (byte **) memptr;                      /* Point to first memory argument */
+  va_start (memlist, memptr);                     /* Restart argument parsing       */
+  while (memloc != NULL) {                        /* As long as not NULL pointer    */
+    memoff  = (memoff + (sizeof (double) - 1)) & (~ (sizeof (double) - 1)); /* Pad  */
+    *memloc = blkptr + memoff;                    /* Set argument address           */
+    memoff += va_arg (memlist, size_t);           /* Accumulate padded sizes        */
+    memloc  = va_arg (memlist, void *);           /* Get next argument pointer      */
+  }
+  va_end (memlist);
+
+  return ((void *) blkptr);
+}
+
+/* This routine frees a block allocated
+** by contextArenaAllocGroup(). Space is
+** reclaimed once all the blocks allocated
+** after it in the arena are freed too.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextArenaFree (
+Context * const             contptr,
+void * const                dataptr)
+{
+  ArenaContext *      arenptr;
+  ArenaChunk *        chunptr;
+  ArenaBlock *        blokptr;
+
+  blokptr = (ArenaBlock *) dataptr - 1;
+  if (blokptr->flagval == ARENABLOKSYST) {        /* If block allocated by the system */
+    memFree (blokptr);
+    return;
+  }
+#ifdef SCOTCH_DEBUG_CONTEXT2
+  if (blokptr->flagval != ARENABLOKUSED) {
+    errorPrint ("contextArenaFree: invalid block");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_CONTEXT2 */
+
+  blokptr->flagval = ARENABLOKFREE;               /* Flag block as freed */
+
+  arenptr = contptr->arenptr;
+  while ((chunptr = arenptr->chunptr) != NULL) {  /* Reclaim flagged blocks at top of stack */
+    while ((chunptr->lastoff != ARENAOFFNONE) &&
+           (arenaChunkBlock (chunptr, chunptr->lastoff)->flagval == ARENABLOKFREE)) {
+      chunptr->usedsiz = chunptr->lastoff;
+      chunptr->lastoff = arenaChunkBlock (chunptr, chunptr->lastoff)->prevoff;
+    }
+    if (chunptr->lastoff != ARENAOFFNONE)         /* If top block still in use, stop there */
+      break;
+
+    arenptr->chunptr = chunptr->prevptr;          /* Chunk is empty: pop it             */
+    if (arenptr->spreptr == NULL)                 /* Keep it as spare chunk if none yet */
+      arenptr->spreptr = chunptr;
+    else
+      memFree (chunptr);
+  }
+}
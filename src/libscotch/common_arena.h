@@ -0,0 +1,107 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_arena.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the context work memory arena       **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Size of the data area of arena chunks. +*/
+
+#define ARENACHUNSIZE               1048576
+
+/*+ Size of the largest block taken from
+    arena chunks. Larger blocks are directly
+    allocated by the system.                 +*/
+
+#define ARENABLOKMAX                (ARENACHUNSIZE / 8)
+
+/*+ Block states. +*/
+
+#define ARENABLOKUSED               0             /*+ Block in use, within a chunk   +*/
+#define ARENABLOKFREE               1             /*+ Block freed, not yet reclaimed +*/
+#define ARENABLOKSYST               2             /*+ Block allocated by the system  +*/
+
+#define ARENAOFFNONE                ((size_t) -1) /*+ No previous block in chunk     +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The block header, which precedes the user
+    area of every block. Its size is also the
+    alignment unit of blocks within chunks.   +*/
+
+typedef struct ArenaBlock_ {
+  size_t                    prevoff;              /*+ Offset of previous block in chunk, or ARENAOFFNONE +*/
+  size_t                    flagval;              /*+ Block state                                        +*/
+} ArenaBlock;
+
+/*+ The chunk header. Chunks are stacked, the
+    most recent one holding the most recent
+    blocks.                                    +*/
+
+typedef struct ArenaChunk_ {
+  struct ArenaChunk_ *      prevptr;              /*+ Previous chunk in stack, or NULL      +*/
+  size_t                    usedsiz;              /*+ Number of bytes used in data area     +*/
+  size_t                    lastoff;              /*+ Offset of last block, or ARENAOFFNONE +*/
+} ArenaChunk;
+
+/*+ Context work memory arena. The abstract type is defined in "common.h". +*/
+
+struct ArenaContext_ {
+  ArenaChunk *              chunptr;              /*+ Chunk holding most recent blocks, or NULL +*/
+  ArenaChunk *              spreptr;              /*+ Empty chunk kept for re-use, or NULL      +*/
+  INT                       allonbr;              /*+ Number of blocks taken from chunks        +*/
+  INT                       systnbr;              /*+ Number of system allocations              +*/
+};
+
+/*
+**  The macro definitions.
+*/
+
+#define ARENACHUNHEAD               ((sizeof (ArenaChunk) + sizeof (ArenaBlock) - 1) & (~ (sizeof (ArenaBlock) - 1))) /*+ Padded size of chunk header +*/
+#define arenaChunkData(c)           ((byte *) (c) + ARENACHUNHEAD)
+#define arenaChunkBlock(c,o)        ((ArenaBlock *) (arenaChunkData (c) + (o)))
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                context management routines.            **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -49,6 +49,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "common_arena.h"
 #include "common_thread.h"
 #include "common_thread_system.h"
 #include "common_values.h"
@@ -77,6 +78,12 @@ Context * const             contptr)
   contptr->thrdptr = NULL;                        /* Thread context not initialized yet       */
   contptr->randptr = &intranddat;                 /* Use global random generator by default   */
   contptr->valuptr = NULL;                        /* Allow user library to provide its values */
+  contptr->statptr = NULL;                        /* No statistics recorded by default        */
+  contptr->recoptr = NULL;                        /* No method call being recorded            */
+  contptr->cachptr = NULL;                        /* No cached data by default                */
+  contptr->taskptr = NULL;                        /* Not running within a task scheduler      */
+  contptr->arenptr = NULL;                        /* Arena will be allocated at commit time   */
+  contptr->arentab = NULL;                        /* No task scheduler worker arenas          */
 
   intRandInit (&intranddat);                      /* Make sure random context is initialized before cloning */
 }
@@ -101,6 +108,10 @@ Context * const             contptr)
       memFree (contptr->valuptr->dataptr);
     memFree (contptr->valuptr);
   }
+  contextArenaExit (contptr);                     /* Free work memory arena, if any */
+  contextStatsExit (contptr);                     /* Free statistics, if any        */
+  if (contptr->cachptr != NULL)                   /* If cached data present, free them */
+    contptr->cachptr->exitfunc (contptr->cachptr);
 
 #ifdef SCOTCH_DEBUG_CONTEXT1
   contptr->thrdptr = NULL;
@@ -129,6 +140,9 @@ Context * const             contptr)
   if (contptr->valuptr == NULL)                   /* If no values provided by user library */
     contptr->valuptr = &valudat;                  /* Set default data to avoid any crash   */
 
+  if (contptr->arenptr == NULL)                   /* If work memory arena not already allocated */
+    o |= contextArenaInit (contptr);
+
   return (o);
 }
 
@@ -278,6 +292,7 @@ void * const                paraptr)              /* Function parameters */
   ContextSplit              spltdat;              /* Data structure for passing arguments         */
   ThreadContext             thrdtab[2];           /* Thread contexts for both sub-contexts        */
   IntRandContext            randdat;              /* Pseudo-random context for second sub-context */
+  ArenaContext              arendat;              /* Work memory arena for second sub-context     */
   const int                 thrdnbr = contextThreadNbr (contptr);
 
   if (thrdnbr <= 1)                               /* If current context too small or inactive, nothing to do */
@@ -286,9 +301,21 @@ void * const                paraptr)              /* Function parameters */
   spltdat.conttab[0].thrdptr = &thrdtab[0];
   spltdat.conttab[0].randptr = contptr->randptr;  /* Re-use pseudo-random generator of initial context in sub-context 0 */
   spltdat.conttab[0].valuptr = contptr->valuptr;
+  spltdat.conttab[0].statptr = contptr->statptr;  /* Statistics are shared by all sub-contexts */
+  spltdat.conttab[0].recoptr = NULL;              /* Sub-contexts record their own calls       */
+  spltdat.conttab[0].cachptr = NULL;              /* Cached data are not shared                */
+  spltdat.conttab[0].taskptr = NULL;              /* Sub-contexts are not run as tasks         */
+  spltdat.conttab[0].arenptr = contptr->arenptr;  /* Sub-context 0 is run by the same leader   */
+  spltdat.conttab[0].arentab = NULL;
   spltdat.conttab[1].thrdptr = &thrdtab[1];
   spltdat.conttab[1].randptr = &randdat;          /* Set independent pseudo-random generator for sub-context 1 */
   spltdat.conttab[1].valuptr = contptr->valuptr;
+  spltdat.conttab[1].statptr = contptr->statptr;
+  spltdat.conttab[1].recoptr = NULL;
+  spltdat.conttab[1].cachptr = NULL;
+  spltdat.conttab[1].taskptr = NULL;
+  spltdat.conttab[1].arenptr = &arendat;
+  spltdat.conttab[1].arentab = NULL;
   spltdat.funcptr = funcptr;
   spltdat.paraptr = paraptr;
 
@@ -298,7 +325,242 @@ void * const                paraptr)              /* Function parameters */
   intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator from existing one */
   intRandSeed (&randdat, intRandVal2 (contptr->randptr));
 
+  contextArenaInit2 (&arendat);
+
   threadLaunch (contptr->thrdptr, (ThreadFunc) contextThreadLaunchSplit2, (void *) &spltdat); /* Launch all threads of initial context */
 
+  contextArenaExit2 (contptr, &arendat);
+
+  return (0);
+}
+
+/* These routines run the user-provided function
+** twice, for sub-task numbers 0 and 1, as two
+** concurrent tasks of a work-stealing task scheduler.
+** Unlike contextThreadLaunchSplit(), the set of
+** threads is not partitioned in advance: each
+** task runs on a single thread, and pending tasks
+** are stolen by idle threads, so that unbalanced
+** task trees keep all threads busy.
+** When the given context is not yet running within
+** a task scheduler, a new one is started across all
+** of its threads. Sub-task 0 is run by the calling
+** thread, with the pseudo-random generator of the
+** initial context, while sub-task 1 is given a new,
+** independent, pseudo-random generator. Hence, the
+** sequence of pseudo-random numbers used by each
+** task does not depend on task scheduling.
+** Tasks take their work arrays from the work
+** memory arena of the worker running them.
+** When only one thread is available, both
+** sub-tasks are run in sequence by the calling
+** thread, sub-task 1 being given a pseudo-random
+** generator initialized in the same way, so that
+** results do not depend on the number of threads.
+** Both tasks have completed on return.
+** It returns:
+** - 0  : if the tasks have been run.
+** - 1  : if the task scheduler could not be
+**        started.
+*/
+
+static
+void
+contextThreadLaunchTask5 (
+Context * const             contptr,              /*+ Single-threaded context +*/
+ContextSplitFunc const      funcptr,              /* Function to launch       */
+void * const                paraptr)              /* Function parameters      */
+{
+  Context                   contdat;              /* Context for second sub-task               */
+  IntRandContext            randdat;              /* Pseudo-random context for second sub-task */
+
+  contdat = *contptr;                             /* Sub-task 1 is run by the same thread */
+  contdat.randptr = &randdat;                     /* Set independent pseudo-random generator for sub-task 1 */
+  contdat.recoptr = NULL;
+  contdat.cachptr = NULL;                         /* Cached data are not shared by sub-tasks */
+
+  intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator as contextThreadLaunchTask2() does */
+  intRandSeed (&randdat, intRandVal2 (contptr->randptr));
+
+  funcptr (contptr,  0, paraptr);
+  funcptr (&contdat, 1, paraptr);
+}
+
+static
+void
+contextThreadLaunchTask3 (
+ThreadTaskDescriptor * restrict const descptr,    /*+ Descriptor of worker running the task +*/
+ContextTask * restrict const          taskptr)    /*+ Task data                             +*/
+{
+  taskptr->contdat.taskptr = descptr;             /* Spawn sub-tasks on behalf of current worker */
+  taskptr->contdat.arenptr = &taskptr->contdat.arentab[descptr->thrdnum]; /* Use arena of current worker */
+  taskptr->funcptr (&taskptr->contdat, 1, taskptr->paraptr);
+}
+
+static
+void
+contextThreadLaunchTask2 (
+Context * const             contptr,              /*+ Context of a running task +*/
+ContextSplitFunc const      funcptr,              /* Function to launch         */
+void * const                paraptr)              /* Function parameters        */
+{
+  ContextTask               taskdat;              /* Data structure for second sub-task        */
+  IntRandContext            randdat;              /* Pseudo-random context for second sub-task */
+
+  taskdat.contdat.thrdptr = contptr->thrdptr;     /* Tasks always run on a single thread */
+  taskdat.contdat.randptr = &randdat;             /* Set independent pseudo-random generator for sub-task 1 */
+  taskdat.contdat.valuptr = contptr->valuptr;
+  taskdat.contdat.statptr = contptr->statptr;
+  taskdat.contdat.recoptr = NULL;
+  taskdat.contdat.cachptr = NULL;                 /* Cached data are not shared by concurrent tasks */
+  taskdat.contdat.taskptr = NULL;                 /* Will be set by the worker running the task */
+  taskdat.contdat.arenptr = NULL;                 /* Idem                                       */
+  taskdat.contdat.arentab = contptr->arentab;
+  taskdat.funcptr = funcptr;
+  taskdat.paraptr = paraptr;
+
+  intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator from existing one */
+  intRandSeed (&randdat, intRandVal2 (contptr->randptr));
+
+  threadTaskSpawn (contptr->taskptr, &taskdat.taskdat, (ThreadTaskFunc) contextThreadLaunchTask3, (void *) &taskdat);
+  funcptr (contptr, 0, paraptr);                  /* Run sub-task 0 in current task    */
+  threadTaskWait (contptr->taskptr, &taskdat.taskdat); /* Run other tasks until sub-task 1 completes */
+}
+
+static
+void
+contextThreadLaunchTask4 (
+ThreadTaskDescriptor * restrict const descptr,    /*+ Descriptor of worker running the task +*/
+ContextSplit * restrict const         spltptr)    /*+ Root task data                        +*/
+{
+  Context             contdat;
+
+  contdat = spltptr->conttab[0];
+  contdat.thrdptr = &descptr->contptr->seqdat;    /* Root task runs on a single thread */
+  contdat.taskptr = descptr;
+  contdat.arenptr = &contdat.arentab[descptr->thrdnum];
+
+  contextThreadLaunchTask2 (&contdat, spltptr->funcptr, spltptr->paraptr);
+}
+
+int
+contextThreadLaunchTask (
+Context * const             contptr,
+ContextSplitFunc const      funcptr,              /* Function to launch  */
+void * const                paraptr)              /* Function parameters */
+{
+  ContextSplit              spltdat;              /* Data structure for passing arguments to root task */
+  ArenaContext *            arentab;              /* Work memory arenas of workers                     */
+  int                       thrdnum;
+  int                       o;
+
+  const int                 thrdnbr = contextThreadNbr (contptr);
+
+  if (contptr->taskptr != NULL) {                 /* If already running within a task scheduler */
+    contextThreadLaunchTask2 (contptr, funcptr, paraptr);
+    return (0);
+  }
+
+  if (thrdnbr <= 1) {                             /* If current context too small or inactive, run sub-tasks in sequence */
+    contextThreadLaunchTask5 (contptr, funcptr, paraptr);
+    return (0);
+  }
+
+  if ((arentab = memAlloc (thrdnbr * sizeof (ArenaContext))) == NULL) {
+    errorPrint ("contextThreadLaunchTask: out of memory");
+    return (1);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    contextArenaInit2 (&arentab[thrdnum]);
+
+  spltdat.conttab[0] = *contptr;                  /* Root task inherits features of initial context */
+  spltdat.conttab[0].arentab = arentab;           /* Except arenas, which depend on running worker  */
+  spltdat.funcptr    = funcptr;
+  spltdat.paraptr    = paraptr;
+
+  o = (threadTaskLaunch (contptr->thrdptr, (ThreadTaskFunc) contextThreadLaunchTask4, (void *) &spltdat) != 0) ? 1 : 0;
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    contextArenaExit2 (contptr, &arentab[thrdnum]);
+  memFree (arentab);
+
+  return (o);
+}
+
+/* These routines run the user-provided function
+** once for each of the given number of sub-tasks,
+** spreading them across the threads of the given
+** context. Each sub-task runs on a single thread,
+** with its own pseudo-random generator, spawned
+** from the one of the initial context according
+** to the sub-task number. Hence, the results of
+** the sub-tasks depend neither on the number of
+** threads nor on their scheduling.
+** All sub-tasks have completed on return.
+** It returns:
+** - 0   : if the sub-tasks have been run.
+** - !0  : on error.
+*/
+
+static
+void
+contextThreadLaunchMulti2 (
+ThreadDescriptor * restrict const descptr,        /*+ Thread descriptor in initial context +*/
+ContextMulti * restrict const     multptr)        /*+ Data structure for running sub-tasks +*/
+{
+  Context             contdat;
+  ThreadContext       thrddat;                    /* Single-thread context for sub-tasks */
+  ArenaContext        arendat;                    /* Work memory arena of thread         */
+  int                 tasknum;
+
+  const int           thrdnbr = threadNbr (descptr);
+
+  threadContextImport1 (&thrddat, 1);             /* Sub-tasks run on a single thread */
+  contextArenaInit2    (&arendat);
+
+  contdat.thrdptr = &thrddat;
+  contdat.valuptr = multptr->contptr->valuptr;
+  contdat.statptr = multptr->contptr->statptr;    /* Statistics are shared by all sub-tasks  */
+  contdat.recoptr = NULL;
+  contdat.cachptr = NULL;                         /* Cached data are not shared              */
+  contdat.taskptr = NULL;                         /* Sub-tasks do not spawn scheduler tasks  */
+  contdat.arenptr = (threadNum (descptr) == 0) ? multptr->contptr->arenptr : &arendat; /* Leader keeps arena of initial context */
+  contdat.arentab = NULL;
+
+  for (tasknum = threadNum (descptr); tasknum < multptr->tasknbr; tasknum += thrdnbr) {
+    contdat.randptr = &multptr->randtab[tasknum];
+    multptr->funcptr (&contdat, tasknum, multptr->paraptr);
+  }
+
+  contextArenaExit2 (multptr->contptr, &arendat);
+}
+
+int
+contextThreadLaunchMulti (
+Context * const             contptr,
+const int                   tasknbr,              /* Number of sub-tasks to run */
+ContextSplitFunc const      funcptr,              /* Function to launch         */
+void * const                paraptr)              /* Function parameters        */
+{
+  ContextMulti              multdat;              /* Data structure for passing arguments */
+  int                       tasknum;
+
+  if ((multdat.randtab = memAlloc (tasknbr * sizeof (IntRandContext))) == NULL) {
+    errorPrint ("contextThreadLaunchMulti: out of memory");
+    return (1);
+  }
+  for (tasknum = 0; tasknum < tasknbr; tasknum ++) /* Spawn generators in sub-task order */
+    intRandSpawn (contptr->randptr, tasknum, &multdat.randtab[tasknum]);
+  intRandVal2 (contptr->randptr);                 /* Advance initial generator so that next spawns differ */
+
+  multdat.contptr = contptr;
+  multdat.tasknbr = tasknbr;
+  multdat.funcptr = funcptr;
+  multdat.paraptr = paraptr;
+
+  threadLaunch (contptr->thrdptr, (ThreadFunc) contextThreadLaunchMulti2, (void *) &multdat);
+
+  memFree (multdat.randtab);
+
   return (0);
 }
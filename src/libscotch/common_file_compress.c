@@ -1,4 +1,4 @@
-/* Copyright 2008,2010,2015,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2010,2015,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 27 apr 2015     **/
 /**                                 to   : 14 jul 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,6 +68,9 @@
 #ifdef COMMON_FILE_COMPRESS_LZMA
 #include "lzma.h"
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#include "zstd.h"
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
 
 /*
 **  The static definitions.
@@ -91,6 +94,11 @@ static FileCompressTab      filetab[] = {
                                           { ".lzma", FILECOMPRESSTYPENOTIMPL },
                                           { ".xz",   FILECOMPRESSTYPENOTIMPL },
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+                                          { ".zst",  FILECOMPRESSTYPEZSTD    },
+#else /* COMMON_FILE_COMPRESS_ZSTD */
+                                          { ".zst",  FILECOMPRESSTYPENOTIMPL },
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
                                           { NULL,    FILECOMPRESSTYPENOTIMPL } };
 
 /*********************************/
@@ -183,6 +191,11 @@ FileCompress * const        compptr)
       fileCompressLzma (compptr);
       break;
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    case FILECOMPRESSTYPEZSTD :
+      fileCompressZstd (compptr);
+      break;
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
     default :
       errorPrint ("fileCompress2: method not implemented");
   }
@@ -412,3 +425,78 @@ FileCompress * const        compptr)
   fclose (compptr->oustptr);                      /* Do as zlib does */
 }
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+
+/* This routine compresses a stream in the
+** zstd format.
+** It returns:
+** - void  : in all cases. Compression stops
+**           immediately in case of error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+static
+void
+fileCompressZstd (
+FileCompress * const        compptr)
+{
+  ZSTD_CCtx *         encoptr;                    /* Encoder context       */
+  ZSTD_EndDirective   enmoval;                    /* Encoder mode value    */
+  byte *              obuftab;                    /* Encoder output buffer */
+  ssize_t             bytenbr;
+
+  if ((obuftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL) {
+    errorPrint ("fileCompressZstd: out of memory");
+    return;
+  }
+
+  if (((encoptr = ZSTD_createCCtx ()) == NULL) ||
+      (ZSTD_isError (ZSTD_CCtx_setParameter (encoptr, ZSTD_c_compressionLevel, 19)))) { /* Maximum non-ultra compression */
+    errorPrint ("fileCompressZstd: cannot start compression");
+    if (encoptr != NULL)
+      ZSTD_freeCCtx (encoptr);
+    memFree (obuftab);
+    return;
+  }
+
+  enmoval = ZSTD_e_continue;
+  do {
+    ZSTD_inBuffer       ibufdat;
+    size_t              enreval;
+
+    bytenbr = read (compptr->infdnum, compptr->bufftab, FILECOMPRESSDATASIZE); /* Read from pipe */
+    if (bytenbr < 0) {
+      errorPrint ("fileCompressZstd: cannot read");
+      break;
+    }
+    if (bytenbr == 0)
+      enmoval = ZSTD_e_end;                       /* If end of stream, request completion of encoding */
+    ibufdat.src  = compptr->bufftab;
+    ibufdat.size = bytenbr;
+    ibufdat.pos  = 0;
+
+    do {
+      ZSTD_outBuffer      obufdat;
+
+      obufdat.dst  = obuftab;
+      obufdat.size = FILECOMPRESSDATASIZE;
+      obufdat.pos  = 0;
+      enreval = ZSTD_compressStream2 (encoptr, &obufdat, &ibufdat, enmoval);
+      if (ZSTD_isError (enreval)) {
+        errorPrint ("fileCompressZstd: cannot compress");
+        bytenbr = -1;
+        break;
+      }
+      if (fwrite (obuftab, 1, obufdat.pos, compptr->oustptr) != obufdat.pos) {
+        errorPrint ("fileCompressZstd: cannot write");
+        bytenbr = -1;
+        break;
+      }
+    } while ((enmoval == ZSTD_e_end) ? (enreval != 0) : (ibufdat.pos < ibufdat.size)); /* Until input consumed or frame flushed */
+  } while (bytenbr > 0);
+
+  ZSTD_freeCCtx (encoptr);
+  memFree (obuftab);
+
+  fclose (compptr->oustptr);                      /* Do as zlib does */
+}
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
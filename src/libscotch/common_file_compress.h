@@ -1,4 +1,4 @@
-/* Copyright 2008,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 6.0  : from : 08 jul 2018     **/
 /**                                 to   : 14 jul 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 06 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -51,10 +51,27 @@
 **  The type and structure definitions.
 */
 
-/* Buffer size. */
+/* Buffer sizes. */
 
 #define FILECOMPRESSDATASIZE        (128 * 1024) /* Size of (de)compressing buffers */
 
+#define FILEDECOMPRESSSLICESIZE     (1024 * 1024) /* Compressed bytes per decompressing thread and window */
+#define FILEDECOMPRESSBLOCKSIZE     (1024 * 1024) /* Size of blocks produced by streaming decompression   */
+#define FILEDECOMPRESSRINGNBR       4             /* Number of decompressed blocks queued for writing     */
+#define FILEDECOMPRESSTHRDMAX       32            /* Maximum number of decompressing threads              */
+
+/* Return values of member decompression routines. */
+
+#define FILEDECOMPRESSCODEMORE      0             /* Needs more input or output space */
+#define FILEDECOMPRESSCODEEND       1             /* End of compressed member reached */
+#define FILEDECOMPRESSCODEERROR     2             /* Corrupted data                   */
+
+/* Status values of decompressing slices. */
+
+#define FILEDECOMPRESSSTATOK        0             /* Slice ended at a member boundary      */
+#define FILEDECOMPRESSSTATMORE      1             /* Window exhausted in middle of member  */
+#define FILEDECOMPRESSSTATERROR     2             /* Corrupted data, or not a member start */
+
 /* Available types of (de)compression. */
 
 typedef enum FileCompressType_ {
@@ -62,7 +79,8 @@ typedef enum FileCompressType_ {
   FILECOMPRESSTYPENONE    = 0,                    /* No compression */
   FILECOMPRESSTYPEBZ2,
   FILECOMPRESSTYPEGZ,
-  FILECOMPRESSTYPELZMA
+  FILECOMPRESSTYPELZMA,
+  FILECOMPRESSTYPEZSTD
 } FileCompressType;
 
 /* (De)compression type slot. */
@@ -88,6 +106,88 @@ typedef struct FileCompress_ {
 #endif /* COMMON_PTHREAD_FILE */
 } FileCompress;
 
+/*+ Member decompression method. Compressed
+    streams which are the concatenation of
+    independent members (gzip members, bzip2
+    streams, zstd frames) can be decompressed
+    in parallel, once member starts have been
+    guessed from their header signature.     +*/
+
+typedef struct FileDecompressMeth_ {
+  FileCompressType          typeval;              /*+ Type of decompression                              +*/
+  size_t                    headsiz;              /*+ Size of member header signature                    +*/
+  int                       garbval;              /*+ Flag set if trailing garbage is ignored            +*/
+  int                    (* headfunc) (const byte * const, const size_t); /*+ Member header check        +*/
+  void *                 (* initfunc) (void);     /*+ Create decoder                                     +*/
+  int                    (* codefunc) (void * const, const byte ** const, size_t * const, byte ** const, size_t * const); /*+ Decode +*/
+  void                   (* exitfunc) (void * const); /*+ Free decoder                                   +*/
+} FileDecompressMeth;
+
+/*+ Decompressed block ring slot. +*/
+
+typedef struct FileDecompressSlot_ {
+  byte *                    datatab;              /*+ Decompressed data, freed by writer +*/
+  size_t                    datanbr;              /*+ Number of bytes                    +*/
+} FileDecompressSlot;
+
+/*+ Bounded ring of decompressed blocks,
+    between the decompressing threads and
+    the thread writing to the pipe end.   +*/
+
+#ifdef COMMON_PTHREAD_FILE
+typedef struct FileDecompressRing_ {
+  FileDecompressSlot        slottab[FILEDECOMPRESSRINGNBR]; /*+ Array of slots                 +*/
+  int                       headidx;              /*+ Index of next slot to fill           +*/
+  int                       tailidx;              /*+ Index of next slot to write          +*/
+  int                       slotnbr;              /*+ Number of filled slots               +*/
+  int                       endval;               /*+ Flag set when no more blocks to come +*/
+  int                       errval;               /*+ Flag set on write error              +*/
+  int                       infdnum;              /*+ Pipe end to write to                 +*/
+  pthread_mutex_t           lockdat;              /*+ Lock on ring                         +*/
+  pthread_cond_t            conddat;              /*+ Condition on ring state change       +*/
+  pthread_t                 thrdval;              /*+ Writer thread ID                     +*/
+} FileDecompressRing;
+#endif /* COMMON_PTHREAD_FILE */
+
+/*+ Decompression slice. A slice starts at a
+    candidate member start in the window, and
+    ends at the first member boundary past the
+    start of the next slice.                   +*/
+
+typedef struct FileDecompressSlice_ {
+  const FileDecompressMeth * methptr;             /*+ Decompression method                       +*/
+  const byte *              wintab;               /*+ Window of compressed data                  +*/
+  size_t                    winnbr;               /*+ Number of bytes in window                  +*/
+  size_t                    begidx;               /*+ Start index of slice in window             +*/
+  size_t                    endidx;               /*+ Index from which slice may end             +*/
+  size_t                    membidx;              /*+ Index after last complete member           +*/
+  byte *                    outtab;               /*+ Decompressed data                          +*/
+  size_t                    outsiz;               /*+ Size of decompressed data array            +*/
+  size_t                    outnbr;               /*+ Number of bytes of complete members        +*/
+  int                       statval;              /*+ Slice status                               +*/
+#ifdef COMMON_PTHREAD_FILE
+  pthread_t                 thrdval;              /*+ Thread ID                                  +*/
+#endif /* COMMON_PTHREAD_FILE */
+} FileDecompressSlice;
+
+/*+ Member-parallel decompression data. +*/
+
+typedef struct FileDecompressData_ {
+  FileCompress *            compptr;              /*+ (De)compression structure           +*/
+  const FileDecompressMeth * methptr;             /*+ Decompression method                +*/
+  void *                    decoptr;              /*+ Decoder for streaming decompression +*/
+  byte *                    wintab;               /*+ Window of compressed data           +*/
+  size_t                    winsiz;               /*+ Size of window                      +*/
+  size_t                    winnbr;               /*+ Number of bytes in window           +*/
+  int                       eofval;               /*+ Flag set when end of stream reached +*/
+  int                       membval;              /*+ Flag set once a member decompressed +*/
+  int                       thrdnbr;              /*+ Number of decompressing threads     +*/
+  FileDecompressSlice *     slictab;              /*+ Array of slices                     +*/
+#ifdef COMMON_PTHREAD_FILE
+  FileDecompressRing *      ringptr;              /*+ Block ring, if any                  +*/
+#endif /* COMMON_PTHREAD_FILE */
+} FileDecompressData;
+
 /*
 **  The function prototypes.
 */
@@ -97,7 +197,10 @@ typedef struct FileCompress_ {
 static void                 fileCompressBz2     (FileCompress * const  dataptr);
 #endif /* SCOTCH_COMMON_FILE_COMPRESS */
 #ifdef SCOTCH_COMMON_FILE_DECOMPRESS
-static void                 fileDecompressBz2   (FileCompress * const  dataptr);
+static int                  fileDecompressBz2Head (const byte * const, const size_t);
+static void *               fileDecompressBz2Init (void);
+static int                  fileDecompressBz2Code (void * const, const byte ** const, size_t * const, byte ** const, size_t * const);
+static void                 fileDecompressBz2Exit (void * const);
 #endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
 #endif /* COMMON_FILE_COMPRESS_Bz2 */
 #ifdef COMMON_FILE_COMPRESS_GZ
@@ -105,7 +208,10 @@ static void                 fileDecompressBz2   (FileCompress * const  dataptr);
 static void                 fileCompressGz      (FileCompress * const  dataptr);
 #endif /* SCOTCH_COMMON_FILE_COMPRESS */
 #ifdef SCOTCH_COMMON_FILE_DECOMPRESS
-static void                 fileDecompressGz    (FileCompress * const  dataptr);
+static int                  fileDecompressGzHead (const byte * const, const size_t);
+static void *               fileDecompressGzInit (void);
+static int                  fileDecompressGzCode (void * const, const byte ** const, size_t * const, byte ** const, size_t * const);
+static void                 fileDecompressGzExit (void * const);
 #endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
 #endif /* COMMON_FILE_COMPRESS_GZ */
 #ifdef COMMON_FILE_COMPRESS_LZMA
@@ -116,6 +222,31 @@ static void                 fileCompressLzma    (FileCompress * const  dataptr);
 static void                 fileDecompressLzma  (FileCompress * const  dataptr);
 #endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#ifdef SCOTCH_COMMON_FILE_COMPRESS
+static void                 fileCompressZstd    (FileCompress * const  dataptr);
+#endif /* SCOTCH_COMMON_FILE_COMPRESS */
+#ifdef SCOTCH_COMMON_FILE_DECOMPRESS
+static int                  fileDecompressZstdHead (const byte * const, const size_t);
+static void *               fileDecompressZstdInit (void);
+static int                  fileDecompressZstdCode (void * const, const byte ** const, size_t * const, byte ** const, size_t * const);
+static void                 fileDecompressZstdExit (void * const);
+#endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+
+#ifdef SCOTCH_COMMON_FILE_DECOMPRESS
+static int                  fileDecompressThreadNbr (void);
+static int                  fileDecompressWrite (const int, const byte *, size_t);
+static void                 fileDecompressCopy  (FileCompress * const);
+static int                  fileDecompressPush  (FileDecompressData * restrict const, byte * const, const size_t);
+static int                  fileDecompressGarbage (const FileDecompressData * restrict const, const byte * const, const size_t);
+static void *               fileDecompressSlice (FileDecompressSlice * restrict const);
+static int                  fileDecompressStream (FileDecompressData * restrict const, const int);
+static void                 fileDecompressMult  (FileCompress * const, const FileDecompressMeth * const);
+#ifdef COMMON_PTHREAD_FILE
+static void *               fileDecompressRingWrite (FileDecompressRing * restrict const);
+#endif /* COMMON_PTHREAD_FILE */
+#endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
 
 int                         fileCompress        (File * const, const int);
 void                        fileCompressExit    (File * const);
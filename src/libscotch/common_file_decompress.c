@@ -1,4 +1,4 @@
-/* Copyright 2008,2010,2015,2018,2020,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2010,2015,2018,2020,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 27 apr 2015     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +59,7 @@
 #include "common.h"
 #include "common_file.h"
 #include "common_file_compress.h"
+#include "common_thread_system.h"
 #ifdef COMMON_FILE_COMPRESS_BZ2
 #include "bzlib.h"
 #endif /* COMMON_FILE_COMPRESS_BZ2 */
@@ -68,6 +69,9 @@
 #ifdef COMMON_FILE_COMPRESS_LZMA
 #include "lzma.h"
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#include "zstd.h"
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
 
 /*
 **  The static definitions.
@@ -91,8 +95,25 @@ static FileCompressTab      filetab[] = {
                                           { ".lzma", FILECOMPRESSTYPENOTIMPL },
                                           { ".xz",   FILECOMPRESSTYPENOTIMPL },
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+                                          { ".zst",  FILECOMPRESSTYPEZSTD    },
+#else /* COMMON_FILE_COMPRESS_ZSTD */
+                                          { ".zst",  FILECOMPRESSTYPENOTIMPL },
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
                                           { NULL,    FILECOMPRESSTYPENOTIMPL } };
 
+static const FileDecompressMeth filemethtab[] = {
+#ifdef COMMON_FILE_COMPRESS_BZ2
+                                          { FILECOMPRESSTYPEBZ2,  10, 0, fileDecompressBz2Head,  fileDecompressBz2Init,  fileDecompressBz2Code,  fileDecompressBz2Exit  },
+#endif /* COMMON_FILE_COMPRESS_BZ2 */
+#ifdef COMMON_FILE_COMPRESS_GZ
+                                          { FILECOMPRESSTYPEGZ,   10, 1, fileDecompressGzHead,   fileDecompressGzInit,   fileDecompressGzCode,   fileDecompressGzExit   },
+#endif /* COMMON_FILE_COMPRESS_GZ */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+                                          { FILECOMPRESSTYPEZSTD, 5,  0, fileDecompressZstdHead, fileDecompressZstdInit, fileDecompressZstdCode, fileDecompressZstdExit },
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+                                          { FILECOMPRESSTYPENONE, 0,  0, NULL,                   NULL,                   NULL,                   NULL                   } };
+
 /*********************************/
 /*                               */
 /* Basic routines for filenames. */
@@ -134,6 +155,9 @@ const char * const          nameptr)              /*+ Name string +*/
 ** performed by an auxiliary thread. Else, a child process
 ** will be fork()'ed, and after completion this process
 ** will remain a zombie until the main process terminates.
+** As with gzdopen(), streams to be decompressed with gzip
+** which do not start with the gzip magic number are
+** passed through as is.
 ** It returns:
 ** - !NULL  : stream holding decompressed data.
 ** - NULL   : on error.
@@ -144,24 +168,37 @@ void *                                            /* (void *) to comply to the P
 fileDecompress2 (
 FileCompress * const        compptr)
 {
-  switch (compptr->typeval) {
-#ifdef COMMON_FILE_COMPRESS_BZ2
-    case FILECOMPRESSTYPEBZ2 :
-      fileDecompressBz2 (compptr);
+  int                 methnum;
+
+  for (methnum = 0; filemethtab[methnum].typeval != FILECOMPRESSTYPENONE; methnum ++) {
+    if (filemethtab[methnum].typeval == compptr->typeval)
       break;
-#endif /* COMMON_FILE_COMPRESS_BZ2 */
+  }
 #ifdef COMMON_FILE_COMPRESS_GZ
-    case FILECOMPRESSTYPEGZ :
-      fileDecompressGz (compptr);
-      break;
+  if (compptr->typeval == FILECOMPRESSTYPEGZ) {   /* As gzdopen() did, pass through data which is not gzip-compressed */
+    int                 charval;
+
+    charval = getc (compptr->oustptr);
+    if (charval != EOF)
+      ungetc (charval, compptr->oustptr);
+    if (charval != 0x1F)                          /* If no gzip magic number */
+      methnum = -1;
+  }
 #endif /* COMMON_FILE_COMPRESS_GZ */
+  if (methnum < 0)
+    fileDecompressCopy (compptr);
+  else if (filemethtab[methnum].typeval != FILECOMPRESSTYPENONE) /* If member-based method found */
+    fileDecompressMult (compptr, &filemethtab[methnum]);
+  else {
+    switch (compptr->typeval) {
 #ifdef COMMON_FILE_COMPRESS_LZMA
-    case FILECOMPRESSTYPELZMA :
-      fileDecompressLzma (compptr);
-      break;
+      case FILECOMPRESSTYPELZMA :
+        fileDecompressLzma (compptr);
+        break;
 #endif /* COMMON_FILE_COMPRESS_LZMA */
-    default :
-      errorPrint ("fileDecompress2: method not implemented");
+      default :
+        errorPrint ("fileDecompress2: method not implemented");
+    }
   }
 
   close   (compptr->infdnum);                     /* Close writer's end */
@@ -244,101 +281,917 @@ const FileCompressType      typeval)              /*+ (De)compression algorithm
   return (0);
 }
 
-/* This routine decompresses a stream compressed
-** in the bzip2 format.
+
+/*****************************************/
+/*                                       */
+/* Member-parallel decompression engine. */
+/*                                       */
+/*****************************************/
+
+/* This routine returns the number of threads
+** to be used for decompressing a stream. It is
+** the number of cores, unless prescribed by the
+** SCOTCH_PTHREAD_NUMBER environment variable.
 ** It returns:
-** - void  : in all cases. Decompression stops
-**           immediately in case of error.
+** - !0  : number of decompressing threads.
+*/
+
+static
+int
+fileDecompressThreadNbr ()
+{
+#ifdef COMMON_PTHREAD_FILE
+  int                 thrdnbr;
+
+  thrdnbr = envGetInt ("SCOTCH_PTHREAD_NUMBER", -1);
+  if (thrdnbr < 1)
+    thrdnbr = threadSystemCoreNbr ();
+  if (thrdnbr > FILEDECOMPRESSTHRDMAX)
+    thrdnbr = FILEDECOMPRESSTHRDMAX;
+
+  return ((thrdnbr < 1) ? 1 : thrdnbr);
+#else /* COMMON_PTHREAD_FILE */
+  return (1);                                     /* Decompression performed by a child process */
+#endif /* COMMON_PTHREAD_FILE */
+}
+
+/* This routine writes the whole contents of
+** the given buffer to the given pipe end.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+fileDecompressWrite (
+const int                   infdnum,
+const byte *                datatab,
+size_t                      datanbr)
+{
+  while (datanbr > 0) {
+    ssize_t             bytenbr;
+
+    if ((bytenbr = write (infdnum, datatab, datanbr)) <= 0)
+      return (1);
+    datatab += bytenbr;
+    datanbr -= bytenbr;
+  }
+
+  return (0);
+}
+
+/* This routine copies the rest of the
+** compressed stream as is to the pipe end,
+** for data which is not compressed.
+** It returns:
+** - void  : in all cases.
 */
 
-#ifdef COMMON_FILE_COMPRESS_BZ2
 static
 void
-fileDecompressBz2 (
+fileDecompressCopy (
 FileCompress * const        compptr)
 {
-  BZFILE *            decoptr;
-  int                 bytenbr;
-  int                 flagval;
+  size_t              bytenbr;
 
-  if (FILECOMPRESSDATASIZE < (BZ_MAX_UNUSED)) {
-    errorPrint ("fileDecompressBz2: cannot start decompression (1)");
-    return;
+  while ((bytenbr = fread (compptr->bufftab, 1, FILECOMPRESSDATASIZE, compptr->oustptr)) > 0) {
+    if (fileDecompressWrite (compptr->infdnum, compptr->bufftab, bytenbr) != 0) {
+      errorPrint ("fileDecompressCopy: cannot write");
+      return;
+    }
   }
-  if ((decoptr = BZ2_bzReadOpen (&flagval, compptr->oustptr, 0, 0, NULL, 0)) == NULL) {
-    errorPrint ("fileDecompressBz2: cannot start decompression (2)");
-    BZ2_bzReadClose (&flagval, decoptr);
-    return;
+  if (ferror (compptr->oustptr))
+    errorPrint ("fileDecompressCopy: cannot read");
+}
+
+/* This routine is the writer thread of the
+** decompressed block ring. It writes blocks
+** to the pipe end in the order in which they
+** were queued, and frees them.
+** It returns:
+** - NULL  : in all cases.
+*/
+
+#ifdef COMMON_PTHREAD_FILE
+static
+void *                                            /* (void *) to comply to the Posix pthread API */
+fileDecompressRingWrite (
+FileDecompressRing * restrict const ringptr)
+{
+  while (1) {
+    FileDecompressSlot  slotdat;
+    int                 errval;
+
+    pthread_mutex_lock (&ringptr->lockdat);
+    while ((ringptr->slotnbr == 0) && (ringptr->endval == 0))
+      pthread_cond_wait (&ringptr->conddat, &ringptr->lockdat);
+    if (ringptr->slotnbr == 0) {                  /* If end reached and ring empty */
+      pthread_mutex_unlock (&ringptr->lockdat);
+      break;
+    }
+    slotdat = ringptr->slottab[ringptr->tailidx];
+    errval  = ringptr->errval;
+    pthread_mutex_unlock (&ringptr->lockdat);
+
+    if ((errval == 0) &&                          /* Once an error occurred, only drain ring */
+        (fileDecompressWrite (ringptr->infdnum, slotdat.datatab, slotdat.datanbr) != 0)) {
+      errorPrint ("fileDecompressRingWrite: cannot write");
+      errval = 1;
+    }
+    memFree (slotdat.datatab);
+
+    pthread_mutex_lock (&ringptr->lockdat);
+    ringptr->tailidx = (ringptr->tailidx + 1) % FILEDECOMPRESSRINGNBR;
+    ringptr->slotnbr --;
+    ringptr->errval |= errval;
+    pthread_cond_broadcast (&ringptr->conddat);   /* Wake-up producer if waiting for a free slot */
+    pthread_mutex_unlock   (&ringptr->lockdat);
   }
 
-  while ((bytenbr = BZ2_bzRead (&flagval, decoptr, compptr->bufftab, FILECOMPRESSDATASIZE), flagval) >= BZ_OK) { /* If BZ_OK or BZ_STREAM_END */
-    if (write (compptr->infdnum, compptr->bufftab, bytenbr) != bytenbr) {
-      errorPrint ("fileDecompressBz2: cannot write");
-      flagval = BZ_STREAM_END;                    /* Avoid other error message */
+  return (NULL);
+}
+#endif /* COMMON_PTHREAD_FILE */
+
+/* This routine hands a block of decompressed
+** data over to the writer. The block is freed
+** by the writer, in all cases. When there is
+** no ring, the block is written directly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+fileDecompressPush (
+FileDecompressData * restrict const dataptr,
+byte * const                datatab,
+const size_t                datanbr)
+{
+#ifdef COMMON_PTHREAD_FILE
+  FileDecompressRing * restrict ringptr;
+
+  ringptr = dataptr->ringptr;
+  if (ringptr != NULL) {
+    int                 errval;
+
+    pthread_mutex_lock (&ringptr->lockdat);
+    while ((ringptr->slotnbr >= FILEDECOMPRESSRINGNBR) && (ringptr->errval == 0))
+      pthread_cond_wait (&ringptr->conddat, &ringptr->lockdat);
+    errval = ringptr->errval;
+    if (errval == 0) {
+      ringptr->slottab[ringptr->headidx].datatab = datatab;
+      ringptr->slottab[ringptr->headidx].datanbr = datanbr;
+      ringptr->headidx = (ringptr->headidx + 1) % FILEDECOMPRESSRINGNBR;
+      ringptr->slotnbr ++;
+      pthread_cond_broadcast (&ringptr->conddat); /* Wake-up writer */
+    }
+    pthread_mutex_unlock (&ringptr->lockdat);
+
+    if (errval != 0)                              /* Writer already reported the error */
+      memFree (datatab);
+    return (errval);
+  }
+#endif /* COMMON_PTHREAD_FILE */
+
+  if (fileDecompressWrite (dataptr->compptr->infdnum, datatab, datanbr) != 0) {
+    errorPrint ("fileDecompressPush: cannot write");
+    memFree    (datatab);
+    return     (1);
+  }
+  memFree (datatab);
+
+  return (0);
+}
+
+/* This routine tells whether data located at
+** a member boundary, which cannot be decoded,
+** can be considered as trailing garbage and
+** ignored, as zlib does for gzip streams.
+** It returns:
+** - 0   : data must be considered as an error.
+** - !0  : data can be ignored.
+*/
+
+static
+int
+fileDecompressGarbage (
+const FileDecompressData * restrict const dataptr,
+const byte * const          dataptr2,
+const size_t                datanbr)
+{
+  return ((dataptr->methptr->garbval != 0) &&     /* If method ignores trailing garbage */
+          (dataptr->membval != 0)          &&     /* And at least one member read       */
+          (dataptr->methptr->headfunc (dataptr2, datanbr) == 0)); /* And not a member   */
+}
+
+/* This routine decompresses a slice of the
+** window of compressed data. Decompression
+** starts at the beginning of the slice, which
+** is assumed to be a member start, and stops at
+** the first member boundary located at or after
+** the end index of the slice, or when the window
+** is exhausted. Only the data of complete members
+** is accounted for in the output count.
+** It returns:
+** - NULL  : in all cases; the slice status tells
+**           how decompression ended.
+*/
+
+static
+void *                                            /* (void *) to comply to the Posix pthread API */
+fileDecompressSlice (
+FileDecompressSlice * restrict const slicptr)
+{
+  const FileDecompressMeth * restrict methptr;
+  void *              decoptr;
+  const byte *        inptr;
+  size_t              innbr;
+  size_t              outnbr;
+
+  methptr = slicptr->methptr;
+  slicptr->membidx = slicptr->begidx;
+  slicptr->outnbr  = 0;
+  slicptr->statval = FILEDECOMPRESSSTATERROR;     /* Assume failure */
+
+  if ((decoptr = methptr->initfunc ()) == NULL)
+    return (NULL);
+
+  inptr  = slicptr->wintab + slicptr->begidx;
+  innbr  = slicptr->winnbr - slicptr->begidx;
+  outnbr = 0;
+  while (1) {
+    byte *              ouptr;
+    size_t              ounbr;
+    int                 codeval;
+
+    if (outnbr >= slicptr->outsiz) {              /* If output array full, double its size */
+      byte *              outtmp;
+
+      if ((outtmp = memRealloc (slicptr->outtab, slicptr->outsiz * 2)) == NULL) {
+        errorPrint ("fileDecompressSlice: out of memory");
+        break;
+      }
+      slicptr->outtab  = outtmp;
+      slicptr->outsiz *= 2;
+    }
+
+    ouptr   = slicptr->outtab + outnbr;
+    ounbr   = slicptr->outsiz - outnbr;
+    codeval = methptr->codefunc (decoptr, &inptr, &innbr, &ouptr, &ounbr);
+    outnbr  = ouptr - slicptr->outtab;
+
+    if (codeval == FILEDECOMPRESSCODEERROR)       /* Corrupted data or false member start */
+      break;
+    if (codeval == FILEDECOMPRESSCODEEND) {       /* If member complete, record boundary */
+      slicptr->membidx = inptr - slicptr->wintab;
+      slicptr->outnbr  = outnbr;
+      if ((slicptr->membidx >= slicptr->endidx) || (innbr == 0)) { /* If end of slice reached */
+        slicptr->statval = (slicptr->membidx >= slicptr->endidx) ? FILEDECOMPRESSSTATOK : FILEDECOMPRESSSTATMORE;
+        break;
+      }
+    }
+    else if ((innbr == 0) && (ounbr > 0)) {       /* If window exhausted in middle of member */
+      slicptr->statval = FILEDECOMPRESSSTATMORE;
       break;
     }
-    if (flagval == BZ_STREAM_END) {               /* If end of compressed stream */
-      void *              byunptr;
-      int                 byunnbr;
+  }
+
+  methptr->exitfunc (decoptr);
+
+  return (NULL);
+}
+
+/* This routine decompresses the stream
+** sequentially, starting from the beginning
+** of the window, and refilling it from the
+** stream as needed. Decompressed data is
+** handed over in blocks of fixed size.
+** If the stop flag is set, decompression stops
+** at the end of the first member, and the
+** remaining compressed data is kept at the
+** beginning of the window.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+fileDecompressStream (
+FileDecompressData * restrict const dataptr,
+const int                   stopval)
+{
+  const FileDecompressMeth * restrict methptr;
+  const byte *        inptr;
+  size_t              innbr;
+  const byte *        membptr;                    /* Start of current member in window, if still there */
+  int                 bndrval;                    /* Flag set if at member boundary                    */
+  byte *              outtab;
+  size_t              outnbr;
+  int                 o;
+
+  methptr = dataptr->methptr;
+  if ((outtab = memAlloc (FILEDECOMPRESSBLOCKSIZE)) == NULL) {
+    errorPrint ("fileDecompressStream: out of memory");
+    return (1);
+  }
+
+  inptr   = dataptr->wintab;
+  innbr   = dataptr->winnbr;
+  membptr = inptr;
+  bndrval = 1;
+  outnbr  = 0;
+  o       = 0;
+  while (1) {
+    byte *              ouptr;
+    size_t              ounbr;
+    int                 codeval;
 
-      BZ2_bzReadGetUnused (&flagval, decoptr, &byunptr, &byunnbr); /* Get remaining chars in stream */
-      if ((byunnbr == 0) && (feof (compptr->oustptr) != 0)) { /* If end of decompressed stream too  */
-        flagval = BZ_STREAM_END;
+    if (innbr == 0) {                             /* If window exhausted */
+      if (dataptr->eofval != 0) {                 /* If end of stream    */
+        if ((bndrval == 0) &&                     /* If stream ends in middle of member */
+            ((membptr == NULL) || (fileDecompressGarbage (dataptr, membptr, (dataptr->wintab + dataptr->winnbr) - membptr) == 0))) {
+          errorPrint ("fileDecompressStream: unexpected end of stream");
+          o = 1;
+        }
         break;
       }
-      memMov (compptr->bufftab, byunptr, byunnbr);
-      BZ2_bzReadClose (&flagval, decoptr);
-      if ((decoptr = BZ2_bzReadOpen (&flagval, compptr->oustptr, 0, 0, compptr->bufftab, byunnbr)) == NULL) {
-        errorPrint ("fileDecompressBz2: cannot start decompression (3)");
-        flagval = BZ_STREAM_END;
+      dataptr->winnbr = fread (dataptr->wintab, 1, dataptr->winsiz, dataptr->compptr->oustptr);
+      if (dataptr->winnbr < dataptr->winsiz) {
+        if (ferror (dataptr->compptr->oustptr)) {
+          errorPrint ("fileDecompressStream: cannot read");
+          o = 1;
+          break;
+        }
+        dataptr->eofval = 1;
+      }
+      inptr   = dataptr->wintab;
+      innbr   = dataptr->winnbr;
+      membptr = NULL;                             /* Member start, if any, is no longer in window */
+      continue;
+    }
+
+    ouptr   = outtab + outnbr;
+    ounbr   = FILEDECOMPRESSBLOCKSIZE - outnbr;
+    codeval = methptr->codefunc (dataptr->decoptr, &inptr, &innbr, &ouptr, &ounbr);
+    outnbr  = ouptr - outtab;
+
+    if (codeval == FILEDECOMPRESSCODEERROR) {
+      if ((membptr == NULL) ||
+          (fileDecompressGarbage (dataptr, membptr, (dataptr->wintab + dataptr->winnbr) - membptr) == 0)) {
+        errorPrint ("fileDecompressStream: cannot decompress");
+        o = 1;
+      }
+      innbr           = 0;                        /* Discard remaining data */
+      dataptr->eofval = 1;
+      break;
+    }
+
+    if (outnbr >= FILEDECOMPRESSBLOCKSIZE) {      /* If output block full, hand it over */
+      o = fileDecompressPush (dataptr, outtab, outnbr);
+      outtab = NULL;
+      if ((o != 0) ||
+          ((outtab = memAlloc (FILEDECOMPRESSBLOCKSIZE)) == NULL)) {
+        if (o == 0)
+          errorPrint ("fileDecompressStream: out of memory");
+        o = 1;
         break;
       }
+      outnbr = 0;
+    }
+
+    if (codeval == FILEDECOMPRESSCODEEND) {       /* If end of member reached */
+      dataptr->membval = 1;
+      membptr = inptr;
+      bndrval = 1;
+      if (stopval != 0)
+        break;
     }
+    else
+      bndrval = 0;
   }
-  if (flagval != BZ_STREAM_END)
-    errorPrint ("fileDecompressBz2: cannot read");
 
-  BZ2_bzReadClose (&flagval, decoptr);
-  fclose (compptr->oustptr);                      /* Do as zlib does */
+  if (outtab != NULL) {
+    if ((o == 0) && (outnbr > 0))
+      o = fileDecompressPush (dataptr, outtab, outnbr);
+    else
+      memFree (outtab);
+  }
+
+  memMov (dataptr->wintab, inptr, innbr);         /* Keep remaining compressed data at beginning of window */
+  dataptr->winnbr = innbr;
+
+  return (o);
 }
-#endif /* COMMON_FILE_COMPRESS_BZ2 */
 
-/* This routine decompresses a stream compressed
-** in the gzip format.
+/* This routine decompresses a stream made of
+** independent members. Windows of compressed
+** data are read from the stream and split
+** into slices at places which look like member
+** starts; slices are decompressed in parallel
+** and the data of the slices which chain from
+** the beginning of the window is handed over
+** in order to the writer thread, through a
+** bounded ring of blocks. False member starts
+** are discarded, as the slice which contains
+** them overlaps the next one. When no member
+** boundary can be found within the window,
+** decompression falls back to streaming mode
+** until the end of the current member.
 ** It returns:
 ** - void  : in all cases. Decompression stops
 **           immediately in case of error.
 */
 
-#ifdef COMMON_FILE_COMPRESS_GZ
 static
 void
-fileDecompressGz (
-FileCompress * const        compptr)
+fileDecompressMult (
+FileCompress * const        compptr,
+const FileDecompressMeth * const methptr)
 {
-  gzFile              decoptr;
-  int                 bytenbr;
+  FileDecompressData  datadat;
+#ifdef COMMON_PTHREAD_FILE
+  FileDecompressRing  ringdat;
+  int                 thrdtab[FILEDECOMPRESSTHRDMAX]; /* Flags set for slices run by spawned threads */
+#endif /* COMMON_PTHREAD_FILE */
+  int                 slicnum;
+  int                 o;
+
+  datadat.compptr = compptr;
+  datadat.methptr = methptr;
+  datadat.thrdnbr = fileDecompressThreadNbr ();
+  datadat.winsiz  = (size_t) datadat.thrdnbr * FILEDECOMPRESSSLICESIZE;
+  datadat.winnbr  = 0;
+  datadat.eofval  = 0;
+  datadat.membval = 0;
+#ifdef COMMON_PTHREAD_FILE
+  datadat.ringptr = NULL;
+#endif /* COMMON_PTHREAD_FILE */
 
-  if ((decoptr = gzdopen (fileno (compptr->oustptr), "rb")) == NULL) {
-    errorPrint ("fileDecompressGz: cannot start decompression");
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.wintab,  (size_t) datadat.winsiz,
+                     &datadat.slictab, (size_t) (datadat.thrdnbr * sizeof (FileDecompressSlice)), NULL) == NULL) {
+    errorPrint ("fileDecompressMult: out of memory");
+    return;
+  }
+  if ((datadat.decoptr = methptr->initfunc ()) == NULL) {
+    errorPrint ("fileDecompressMult: cannot start decompression");
+    memFree    (datadat.wintab);                  /* Free group leader */
     return;
   }
 
-  while ((bytenbr = gzread (decoptr, compptr->bufftab, FILECOMPRESSDATASIZE)) > 0) {
-    if (write (compptr->infdnum, compptr->bufftab, bytenbr) != bytenbr) {
-      errorPrint ("fileDecompressGz: cannot write");
-      break;
+#ifdef COMMON_PTHREAD_FILE
+  if (datadat.thrdnbr > 1) {                      /* Decouple decompressing threads from pipe writer */
+    ringdat.headidx = 0;
+    ringdat.tailidx = 0;
+    ringdat.slotnbr = 0;
+    ringdat.endval  = 0;
+    ringdat.errval  = 0;
+    ringdat.infdnum = compptr->infdnum;
+    pthread_mutex_init (&ringdat.lockdat, NULL);
+    pthread_cond_init  (&ringdat.conddat, NULL);
+    if (pthread_create (&ringdat.thrdval, NULL, (void * (*) (void *)) fileDecompressRingWrite, (void *) &ringdat) == 0)
+      datadat.ringptr = &ringdat;
+    else {                                        /* Write from current thread if writer cannot be created */
+      pthread_cond_destroy  (&ringdat.conddat);
+      pthread_mutex_destroy (&ringdat.lockdat);
     }
   }
-  if (bytenbr < 0)
-    errorPrint ("fileDecompressGz: cannot read");
+#endif /* COMMON_PTHREAD_FILE */
+
+  if (datadat.thrdnbr <= 1)                       /* If no parallelism, decompress sequentially */
+    o = fileDecompressStream (&datadat, 0);
+  else {
+    o = 0;
+    while (o == 0) {
+      size_t              bytenbr;
+      size_t              posidx;
+      int                 slicnbr;
+
+      if (datadat.eofval == 0) {                  /* Fill window from stream */
+        bytenbr = fread (datadat.wintab + datadat.winnbr, 1, datadat.winsiz - datadat.winnbr, compptr->oustptr);
+        if (bytenbr < (datadat.winsiz - datadat.winnbr)) {
+          if (ferror (compptr->oustptr)) {
+            errorPrint ("fileDecompressMult: cannot read");
+            o = 1;
+            break;
+          }
+          datadat.eofval = 1;
+        }
+        datadat.winnbr += bytenbr;
+      }
+      if (datadat.winnbr == 0)                    /* If all data processed */
+        break;
+
+      datadat.slictab[0].begidx = 0;              /* Window always starts at a member boundary */
+      for (slicnbr = 1; slicnbr < datadat.thrdnbr; slicnbr ++) { /* Look for candidate member starts */
+        size_t              candidx;
+
+        candidx = ((size_t) slicnbr * datadat.winnbr) / datadat.thrdnbr;
+        if (candidx <= datadat.slictab[slicnbr - 1].begidx)
+          candidx = datadat.slictab[slicnbr - 1].begidx + 1;
+        for ( ; candidx + methptr->headsiz <= datadat.winnbr; candidx ++) {
+          if (methptr->headfunc (datadat.wintab + candidx, datadat.winnbr - candidx) != 0)
+            break;
+        }
+        if (candidx + methptr->headsiz > datadat.winnbr) /* If no more candidate found */
+          break;
+        datadat.slictab[slicnbr].begidx = candidx;
+      }
+
+      if (slicnbr <= 1) {                         /* If no candidate, decompress current member sequentially */
+        o = fileDecompressStream (&datadat, 1);
+        continue;
+      }
+
+      for (slicnum = 0; slicnum < slicnbr; slicnum ++) {
+        FileDecompressSlice * restrict slicptr;
+
+        slicptr = &datadat.slictab[slicnum];
+        slicptr->methptr = methptr;
+        slicptr->wintab  = datadat.wintab;
+        slicptr->winnbr  = datadat.winnbr;
+        slicptr->endidx  = (slicnum < (slicnbr - 1)) ? datadat.slictab[slicnum + 1].begidx : datadat.winnbr;
+        slicptr->outsiz  = 4 * (slicptr->endidx - slicptr->begidx) + FILECOMPRESSDATASIZE; /* Initial guess of decompression ratio */
+        if ((slicptr->outtab = memAlloc (slicptr->outsiz)) == NULL) {
+          errorPrint ("fileDecompressMult: out of memory");
+          o = 1;
+          break;
+        }
+      }
+      if (o != 0) {
+        while (-- slicnum >= 0)
+          memFree (datadat.slictab[slicnum].outtab);
+        break;
+      }
+
+#ifdef COMMON_PTHREAD_FILE
+      for (slicnum = 1; slicnum < slicnbr; slicnum ++) { /* Launch slave slices */
+        thrdtab[slicnum] = (pthread_create (&datadat.slictab[slicnum].thrdval, NULL, (void * (*) (void *)) fileDecompressSlice, (void *) &datadat.slictab[slicnum]) == 0);
+        if (thrdtab[slicnum] == 0)                /* Run slice in current thread if thread cannot be created */
+          fileDecompressSlice (&datadat.slictab[slicnum]);
+      }
+      fileDecompressSlice (&datadat.slictab[0]);
+      for (slicnum = 1; slicnum < slicnbr; slicnum ++) {
+        if (thrdtab[slicnum] != 0)
+          pthread_join (datadat.slictab[slicnum].thrdval, NULL);
+      }
+#else /* COMMON_PTHREAD_FILE */
+      for (slicnum = 0; slicnum < slicnbr; slicnum ++)
+        fileDecompressSlice (&datadat.slictab[slicnum]);
+#endif /* COMMON_PTHREAD_FILE */
+
+      for (slicnum = 0, posidx = 0; slicnum < slicnbr; slicnum ++) { /* Chain valid slices from window start */
+        FileDecompressSlice * restrict slicptr;
+
+        slicptr = &datadat.slictab[slicnum];
+        if (slicptr->begidx != posidx)            /* If slice does not start at a member boundary */
+          break;
+
+        if (slicptr->outnbr > 0) {
+          datadat.membval = 1;
+          o = fileDecompressPush (&datadat, slicptr->outtab, slicptr->outnbr); /* Block freed by writer */
+        }
+        else
+          memFree (slicptr->outtab);
+        slicptr->outtab = NULL;
+        posidx = slicptr->membidx;
+
+        if (o != 0)
+          break;
+        if (slicptr->statval != FILEDECOMPRESSSTATOK) {
+          if (slicptr->statval == FILEDECOMPRESSSTATERROR) { /* If a true member start could not be decoded */
+            if (fileDecompressGarbage (&datadat, datadat.wintab + posidx, datadat.winnbr - posidx) == 0) {
+              errorPrint ("fileDecompressMult: cannot decompress");
+              o = 1;
+            }
+            posidx         = datadat.winnbr;      /* Discard remaining data */
+            datadat.eofval = 1;
+          }
+          break;
+        }
+        while ((slicnum < (slicnbr - 1)) && (datadat.slictab[slicnum + 1].begidx < posidx)) { /* Skip slices of false member starts */
+          slicnum ++;
+          memFree (datadat.slictab[slicnum].outtab);
+          datadat.slictab[slicnum].outtab = NULL;
+        }
+      }
+      for ( ; slicnum < slicnbr; slicnum ++) {    /* Free data of slices that could not be chained */
+        if (datadat.slictab[slicnum].outtab != NULL)
+          memFree (datadat.slictab[slicnum].outtab);
+      }
+      if (o != 0)
+        break;
+
+      if (posidx == 0) {                          /* If member larger than window */
+        if (datadat.eofval != 0) {
+          errorPrint ("fileDecompressMult: unexpected end of stream");
+          o = 1;
+          break;
+        }
+        o = fileDecompressStream (&datadat, 1);
+        continue;
+      }
+
+      memMov (datadat.wintab, datadat.wintab + posidx, datadat.winnbr - posidx); /* Keep remaining data for next window */
+      datadat.winnbr -= posidx;
+    }
+  }
+
+#ifdef COMMON_PTHREAD_FILE
+  if (datadat.ringptr != NULL) {
+    pthread_mutex_lock (&ringdat.lockdat);
+    ringdat.endval = 1;
+    pthread_cond_broadcast (&ringdat.conddat);
+    pthread_mutex_unlock   (&ringdat.lockdat);
+    pthread_join (ringdat.thrdval, NULL);         /* Wait until all blocks written */
+    pthread_cond_destroy  (&ringdat.conddat);
+    pthread_mutex_destroy (&ringdat.lockdat);
+  }
+#endif /* COMMON_PTHREAD_FILE */
+
+  methptr->exitfunc (datadat.decoptr);
+  memFree (datadat.wintab);                       /* Free group leader */
+
+  fclose (compptr->oustptr);                      /* Do as zlib does */
+}
+
+/*********************************/
+/*                               */
+/* Member decompression methods. */
+/*                               */
+/*********************************/
+
+/* These routines handle the decompression of
+** bzip2 streams. A bzip2 file may be made of
+** several concatenated streams, as produced
+** by parallel bzip2 compressors.
+** The header routine returns:
+** - 0   : if data cannot be a member start.
+** - !0  : if data may be a member start.
+** The code routine returns:
+** - FILEDECOMPRESSCODEMORE   : on progress.
+** - FILEDECOMPRESSCODEEND    : at end of member.
+** - FILEDECOMPRESSCODEERROR  : on error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_BZ2
+static
+int
+fileDecompressBz2Head (
+const byte * const          dataptr,
+const size_t                datanbr)
+{
+  return ((datanbr >= 10) &&                      /* Stream header followed by block magic number */
+          (dataptr[0] == 'B') && (dataptr[1] == 'Z') && (dataptr[2] == 'h') &&
+          (dataptr[3] >= '1') && (dataptr[3] <= '9') &&
+          (dataptr[4] == 0x31) && (dataptr[5] == 0x41) && (dataptr[6] == 0x59) &&
+          (dataptr[7] == 0x26) && (dataptr[8] == 0x53) && (dataptr[9] == 0x59));
+}
+
+static
+void *
+fileDecompressBz2Init ()
+{
+  bz_stream *         decoptr;
+
+  if ((decoptr = memAlloc (sizeof (bz_stream))) == NULL)
+    return (NULL);
+  memSet (decoptr, 0, sizeof (bz_stream));        /* Use default allocation routines */
+  if (BZ2_bzDecompressInit (decoptr, 0, 0) != BZ_OK) {
+    memFree (decoptr);
+    return  (NULL);
+  }
+
+  return ((void *) decoptr);
+}
+
+static
+int
+fileDecompressBz2Code (
+void * const                dataptr,
+const byte ** const         inptr,
+size_t * const              innbr,
+byte ** const               ouptr,
+size_t * const              ounbr)
+{
+  bz_stream * const   decoptr = (bz_stream *) dataptr;
+  unsigned int        inmax;
+  unsigned int        oumax;
+  int                 bzreval;
+
+  inmax = (*innbr > UINT_MAX) ? UINT_MAX : (unsigned int) *innbr;
+  oumax = (*ounbr > UINT_MAX) ? UINT_MAX : (unsigned int) *ounbr;
+  decoptr->next_in   = (char *) *inptr;
+  decoptr->avail_in  = inmax;
+  decoptr->next_out  = (char *) *ouptr;
+  decoptr->avail_out = oumax;
+
+  bzreval = BZ2_bzDecompress (decoptr);
+
+  *inptr += inmax - decoptr->avail_in;
+  *innbr -= inmax - decoptr->avail_in;
+  *ouptr += oumax - decoptr->avail_out;
+  *ounbr -= oumax - decoptr->avail_out;
+
+  if (bzreval == BZ_STREAM_END) {                 /* Prepare for next stream */
+    BZ2_bzDecompressEnd (decoptr);
+    memSet (decoptr, 0, sizeof (bz_stream));
+    return ((BZ2_bzDecompressInit (decoptr, 0, 0) == BZ_OK) ? FILEDECOMPRESSCODEEND : FILEDECOMPRESSCODEERROR);
+  }
 
-  gzclose (decoptr);
+  return ((bzreval == BZ_OK) ? FILEDECOMPRESSCODEMORE : FILEDECOMPRESSCODEERROR);
+}
+
+static
+void
+fileDecompressBz2Exit (
+void * const                dataptr)
+{
+  BZ2_bzDecompressEnd ((bz_stream *) dataptr);
+  memFree (dataptr);
+}
+#endif /* COMMON_FILE_COMPRESS_BZ2 */
+
+/* These routines handle the decompression of
+** gzip streams. A gzip file may be made of
+** several concatenated members, as produced
+** by block-based compressors such as bgzip.
+** The header routine returns:
+** - 0   : if data cannot be a member start.
+** - !0  : if data may be a member start.
+** The code routine returns:
+** - FILEDECOMPRESSCODEMORE   : on progress.
+** - FILEDECOMPRESSCODEEND    : at end of member.
+** - FILEDECOMPRESSCODEERROR  : on error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_GZ
+static
+int
+fileDecompressGzHead (
+const byte * const          dataptr,
+const size_t                datanbr)
+{
+  return ((datanbr >= 10) &&                      /* Magic number, deflate method, no reserved flags */
+          (dataptr[0] == 0x1F) && (dataptr[1] == 0x8B) && (dataptr[2] == 0x08) &&
+          ((dataptr[3] & 0xE0) == 0) &&
+          ((dataptr[8] == 0) || (dataptr[8] == 2) || (dataptr[8] == 4)) && /* Extra flags */
+          ((dataptr[9] <= 13) || (dataptr[9] == 255))); /* Operating system */
+}
+
+static
+void *
+fileDecompressGzInit ()
+{
+  z_stream *          decoptr;
+
+  if ((decoptr = memAlloc (sizeof (z_stream))) == NULL)
+    return (NULL);
+  memSet (decoptr, 0, sizeof (z_stream));         /* Use default allocation routines */
+  if (inflateInit2 (decoptr, 15 + 16) != Z_OK) {  /* Decode gzip format only */
+    memFree (decoptr);
+    return  (NULL);
+  }
+
+  return ((void *) decoptr);
+}
+
+static
+int
+fileDecompressGzCode (
+void * const                dataptr,
+const byte ** const         inptr,
+size_t * const              innbr,
+byte ** const               ouptr,
+size_t * const              ounbr)
+{
+  z_stream * const    decoptr = (z_stream *) dataptr;
+  uInt                inmax;
+  uInt                oumax;
+  int                 zreval;
+
+  inmax = (*innbr > UINT_MAX) ? UINT_MAX : (uInt) *innbr;
+  oumax = (*ounbr > UINT_MAX) ? UINT_MAX : (uInt) *ounbr;
+  decoptr->next_in   = (Bytef *) *inptr;
+  decoptr->avail_in  = inmax;
+  decoptr->next_out  = (Bytef *) *ouptr;
+  decoptr->avail_out = oumax;
+
+  zreval = inflate (decoptr, Z_NO_FLUSH);
+
+  *inptr += inmax - decoptr->avail_in;
+  *innbr -= inmax - decoptr->avail_in;
+  *ouptr += oumax - decoptr->avail_out;
+  *ounbr -= oumax - decoptr->avail_out;
+
+  if (zreval == Z_STREAM_END)                     /* Prepare for next member */
+    return ((inflateReset (decoptr) == Z_OK) ? FILEDECOMPRESSCODEEND : FILEDECOMPRESSCODEERROR);
+
+  return (((zreval == Z_OK) || (zreval == Z_BUF_ERROR)) ? FILEDECOMPRESSCODEMORE : FILEDECOMPRESSCODEERROR);
+}
+
+static
+void
+fileDecompressGzExit (
+void * const                dataptr)
+{
+  inflateEnd ((z_stream *) dataptr);
+  memFree (dataptr);
 }
 #endif /* COMMON_FILE_COMPRESS_GZ */
 
+/* These routines handle the decompression of
+** zstd streams. A zstd file may be made of
+** several concatenated frames, as produced
+** by parallel zstd compressors.
+** The header routine returns:
+** - 0   : if data cannot be a member start.
+** - !0  : if data may be a member start.
+** The code routine returns:
+** - FILEDECOMPRESSCODEMORE   : on progress.
+** - FILEDECOMPRESSCODEEND    : at end of member.
+** - FILEDECOMPRESSCODEERROR  : on error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+static
+int
+fileDecompressZstdHead (
+const byte * const          dataptr,
+const size_t                datanbr)
+{
+  return ((datanbr >= 5) &&                       /* Little-endian magic number, no reserved flag */
+          (dataptr[0] == 0x28) && (dataptr[1] == 0xB5) && (dataptr[2] == 0x2F) && (dataptr[3] == 0xFD) &&
+          ((dataptr[4] & 0x08) == 0));
+}
+
+static
+void *
+fileDecompressZstdInit ()
+{
+  ZSTD_DStream *      decoptr;
+
+  if ((decoptr = ZSTD_createDStream ()) == NULL)
+    return (NULL);
+  if (ZSTD_isError (ZSTD_initDStream (decoptr))) {
+    ZSTD_freeDStream (decoptr);
+    return (NULL);
+  }
+
+  return ((void *) decoptr);
+}
+
+static
+int
+fileDecompressZstdCode (
+void * const                dataptr,
+const byte ** const         inptr,
+size_t * const              innbr,
+byte ** const               ouptr,
+size_t * const              ounbr)
+{
+  ZSTD_inBuffer       indat;
+  ZSTD_outBuffer      oudat;
+  size_t              zsreval;
+
+  indat.src  = *inptr;
+  indat.size = *innbr;
+  indat.pos  = 0;
+  oudat.dst  = *ouptr;
+  oudat.size = *ounbr;
+  oudat.pos  = 0;
+
+  zsreval = ZSTD_decompressStream ((ZSTD_DStream *) dataptr, &oudat, &indat);
+
+  *inptr += indat.pos;
+  *innbr -= indat.pos;
+  *ouptr += oudat.pos;
+  *ounbr -= oudat.pos;
+
+  if (ZSTD_isError (zsreval))
+    return (FILEDECOMPRESSCODEERROR);
+
+  return ((zsreval == 0) ? FILEDECOMPRESSCODEEND : FILEDECOMPRESSCODEMORE); /* Zero when frame fully decoded and flushed */
+}
+
+static
+void
+fileDecompressZstdExit (
+void * const                dataptr)
+{
+  ZSTD_freeDStream ((ZSTD_DStream *) dataptr);
+}
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+
 /* This routine decompresses a stream compressed
-** in the lzma format.
+** in the lzma format. When threads are available
+** and liblzma is recent enough, the multi-threaded
+** decoder is used, which decompresses in parallel
+** the blocks of streams produced by multi-threaded
+** xz compressors.
 ** It returns:
 ** - void  : in all cases. Decompression stops
 **           immediately in case of error.
@@ -354,13 +1207,29 @@ FileCompress * const        compptr)
   lzma_action         deacval;                    /* Decoder action value  */
   lzma_ret            dereval;                    /* Decoder return value  */
   byte *              obuftab;                    /* Decoder output buffer */
+#if ((defined COMMON_PTHREAD_FILE) && (LZMA_VERSION >= 50040002))
+  lzma_mt             mtdedat;                    /* Multi-threaded decoder options */
+#endif /* ((defined COMMON_PTHREAD_FILE) && (LZMA_VERSION >= 50040002)) */
 
   if ((obuftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL) {
     errorPrint ("fileDecompressLzma: out of memory");
     return;
   }
 
+#if ((defined COMMON_PTHREAD_FILE) && (LZMA_VERSION >= 50040002)) /* Multi-threaded decoder stable since liblzma 5.4.0 */
+  memSet (&mtdedat, 0, sizeof (lzma_mt));
+  mtdedat.flags              = LZMA_CONCATENATED;
+  mtdedat.threads            = (uint32_t) fileDecompressThreadNbr ();
+  mtdedat.memlimit_threading = lzma_physmem () / 4; /* Same default as xz; decoder falls back to one thread beyond it */
+  mtdedat.memlimit_stop      = UINT64_MAX;
+  if (mtdedat.memlimit_threading == 0)            /* If amount of memory unknown */
+    mtdedat.memlimit_threading = UINT64_MAX;
+
+  if (((mtdedat.threads >  1) && (lzma_stream_decoder_mt (&decodat, &mtdedat) != LZMA_OK)) ||
+      ((mtdedat.threads <= 1) && (lzma_stream_decoder (&decodat, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK))) {
+#else /* ((defined COMMON_PTHREAD_FILE) && (LZMA_VERSION >= 50040002)) */
   if (lzma_stream_decoder (&decodat, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+#endif /* ((defined COMMON_PTHREAD_FILE) && (LZMA_VERSION >= 50040002)) */
     errorPrint ("fileDecompressLzma: cannot start decompression");
     memFree    (obuftab);
     return;
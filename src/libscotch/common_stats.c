@@ -0,0 +1,388 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_stats.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the context         **/
+/**                statistics management routines, which   **/
+/**                record the behavior of strategy         **/
+/**                methods.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "common_arena.h"
+#include "common_stats.h"
+
+/****************************************/
+/*                                      */
+/* These routines handle the statistics */
+/* features of contexts.                */
+/*                                      */
+/****************************************/
+
+/* This routine enables the recording of
+** statistics in the given context. Calling
+** it on a context that already records
+** statistics discards previous records.
+** It returns:
+** - 0   : if statistics are being recorded.
+** - !0  : on error.
+*/
+
+int
+contextStatsInit (
+Context * const             contptr)
+{
+  StatsContext *      statptr;
+
+  if (contptr->arenptr != NULL) {                 /* Arena allocations are counted from now on */
+    contptr->arenptr->allonbr =
+    contptr->arenptr->systnbr = 0;
+  }
+
+  if (contptr->statptr != NULL) {                 /* If statistics already enabled, reset them */
+    contptr->statptr->reconbr  =
+    contptr->statptr->arenanbr =
+    contptr->statptr->systnbr  = 0;
+    return (0);
+  }
+
+  if ((statptr = memAlloc (sizeof (StatsContext))) == NULL) {
+    errorPrint ("contextStatsInit: out of memory");
+    return (1);
+  }
+#ifdef COMMON_PTHREAD
+  pthread_mutex_init (&statptr->lockdat, NULL);
+#endif /* COMMON_PTHREAD */
+  statptr->recotab  = NULL;
+  statptr->reconbr  =
+  statptr->recosiz  =
+  statptr->arenanbr =
+  statptr->systnbr  = 0;
+
+  contptr->statptr = statptr;
+
+  return (0);
+}
+
+/* This routine stops the recording of
+** statistics and frees the statistics
+** structure of the given context.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextStatsExit (
+Context * const             contptr)
+{
+  StatsContext *      statptr;
+
+  if ((statptr = contptr->statptr) == NULL)       /* If no statistics recorded */
+    return;
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_destroy (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  if (statptr->recotab != NULL)
+    memFree (statptr->recotab);
+  memFree (statptr);
+
+  contptr->statptr = NULL;
+}
+
+/* This routine appends a record to the
+** statistics of the given context. It
+** can be called concurrently by threads
+** sharing the same statistics.
+** It returns:
+** - 0   : if record has been added.
+** - !0  : on error.
+*/
+
+int
+contextStatsAdd (
+Context * const             contptr,
+const StatsRecord * const   recoptr)
+{
+  StatsContext * restrict const statptr = contptr->statptr;
+  int                           o;
+
+  o = 0;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  if (statptr->reconbr >= statptr->recosiz) {     /* If record array is full, double its size */
+    StatsRecord *       recotmp;
+    INT                 recosiz;
+
+    recosiz = (statptr->recosiz == 0) ? STATSRECOSIZE : (statptr->recosiz * 2);
+    if ((recotmp = memRealloc (statptr->recotab, recosiz * sizeof (StatsRecord))) == NULL) {
+      errorPrint ("contextStatsAdd: out of memory");
+      o = 1;
+    }
+    else {
+      statptr->recotab = recotmp;
+      statptr->recosiz = recosiz;
+    }
+  }
+  if (o == 0)
+    statptr->recotab[statptr->reconbr ++] = *recoptr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+
+  return (o);
+}
+
+/* This routine lets an iterative method
+** record, in the statistics record of its
+** current call, the number of iterations it
+** performed and the time they took. It
+** does nothing when statistics are not
+** recorded.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextStatsPass (
+Context * const             contptr,
+const INT                   passnbr,
+const double                passtim)
+{
+  StatsRecord * restrict const  recoptr = contptr->recoptr;
+
+  if (recoptr == NULL)                            /* If current call not recorded */
+    return;
+
+  recoptr->passnbr = passnbr;
+  recoptr->passtim = passtim;
+}
+
+/* This routine lets a band method record,
+** in the statistics record of its current
+** call, the time spent extracting the band
+** graph, apart from the time spent in the
+** strategy applied to it. It does nothing
+** when statistics are not recorded.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextStatsBand (
+Context * const             contptr,
+const double                bandtim)
+{
+  StatsRecord * restrict const  recoptr = contptr->recoptr;
+
+  if (recoptr == NULL)                            /* If current call not recorded */
+    return;
+
+  recoptr->bandtim = bandtim;
+}
+
+/* This routine accounts the allocations
+** of a work memory arena which is no longer
+** used in the statistics of the given
+** context, if any. It can be called
+** concurrently by threads sharing the
+** same statistics.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+contextStatsArena (
+Context * const             contptr,
+const INT                   allonbr,
+const INT                   systnbr)
+{
+  StatsContext * restrict const statptr = contptr->statptr;
+
+  if (statptr == NULL)                            /* If no statistics recorded */
+    return;
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  statptr->arenanbr += allonbr;
+  statptr->systnbr  += systnbr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+}
+
+/* These routines give access to the
+** statistics records of the given context.
+** They return:
+** - the number of records, or a pointer to
+**   the given record, in all cases.
+*/
+
+INT
+contextStatsNbr (
+Context * const             contptr)
+{
+  return ((contptr->statptr != NULL) ? contptr->statptr->reconbr : 0);
+}
+
+const StatsRecord *
+contextStatsData (
+Context * const             contptr,
+const INT                   reconum)
+{
+  return (&contptr->statptr->recotab[reconum]);
+}
+
+/* This routine saves the statistics of the
+** given context in JSON format: a summary
+** per strategy method, followed by the list
+** of all method calls in order of completion.
+** Negative cut or imbalance values, which
+** mean that the quantity does not apply to
+** the strategy class, are saved as null.
+** Calls of iterative methods also hold
+** the number of iterations and the number
+** of arcs processed per second by them,
+** and calls of band methods the time spent
+** extracting the band graph. The number of
+** work arrays served by the work memory
+** arenas of the context and of its sub-
+** contexts is given last, along with the
+** number of system allocations they made.
+** It returns:
+** - 0   : if statistics have been saved.
+** - !0  : on error.
+*/
+
+int
+contextStatsSave (
+Context * const             contptr,
+FILE * const                stream)
+{
+  StatsMethod *       methtab;
+  INT                 methnbr;
+  INT                 methnum;
+  INT                 reconbr;
+  INT                 reconum;
+  INT                 arenanbr;
+  INT                 systnbr;
+  int                 o;
+
+  const StatsRecord * restrict const  recotab = (contptr->statptr != NULL) ? contptr->statptr->recotab : NULL;
+
+  reconbr = contextStatsNbr (contptr);
+  if ((methtab = memAlloc ((reconbr + 1) * sizeof (StatsMethod))) == NULL) { /* TRICK: "+ 1" for empty statistics */
+    errorPrint ("contextStatsSave: out of memory");
+    return (1);
+  }
+
+  for (reconum = methnbr = 0; reconum < reconbr; reconum ++) { /* Compute per-method summary */
+    for (methnum = 0; methnum < methnbr; methnum ++) {
+      if ((methtab[methnum].methptr == recotab[reconum].methptr) &&
+          (methtab[methnum].clasptr == recotab[reconum].clasptr))
+        break;
+    }
+    if (methnum == methnbr) {                     /* If new method found */
+      methtab[methnum].clasptr = recotab[reconum].clasptr;
+      methtab[methnum].methptr = recotab[reconum].methptr;
+      methtab[methnum].callnbr = 0;
+      methtab[methnum].timeval = 0.0;
+      methnbr ++;
+    }
+    methtab[methnum].callnbr ++;
+    methtab[methnum].timeval += recotab[reconum].timeval;
+  }
+
+  o = (fprintf (stream, "{\n  \"methods\": [") < 0);
+  for (methnum = 0; methnum < methnbr; methnum ++)
+    o |= (fprintf (stream, "%s\n    { \"class\": \"%s\", \"method\": \"%s\", \"calls\": " INTSTRING ", \"time\": %g }",
+                   (methnum == 0) ? "" : ",",
+                   methtab[methnum].clasptr, methtab[methnum].methptr,
+                   (INT) methtab[methnum].callnbr, methtab[methnum].timeval) < 0);
+  o |= (fprintf (stream, "%s],\n  \"calls\": [", (methnbr > 0) ? "\n  " : "") < 0);
+  for (reconum = 0; reconum < reconbr; reconum ++) {
+    const StatsRecord * restrict  recoptr;
+    int                           i;
+
+    recoptr = &recotab[reconum];
+    o |= (fprintf (stream, "%s\n    { \"class\": \"%s\", \"method\": \"%s\", \"level\": " INTSTRING ", \"vertices\": " INTSTRING ", \"edges\": " INTSTRING ", \"time\": %g",
+                   (reconum == 0) ? "" : ",",
+                   recoptr->clasptr, recoptr->methptr,
+                   (INT) recoptr->levlnum, (INT) recoptr->vertnbr, (INT) recoptr->edgenbr, recoptr->timeval) < 0);
+    for (i = 0; i < 2; i ++) {                    /* Cut before and after call */
+      o |= (fprintf (stream, (i == 0) ? ", \"cut\": [" : ", ") < 0);
+      o |= ((recoptr->cutvtab[i] < 0.0) ? fprintf (stream, "null") : fprintf (stream, "%.17g", recoptr->cutvtab[i])) < 0;
+    }
+    for (i = 0; i < 2; i ++) {                    /* Imbalance before and after call */
+      o |= (fprintf (stream, (i == 0) ? "], \"imbalance\": [" : ", ") < 0);
+      o |= ((recoptr->imbvtab[i] < 0.0) ? fprintf (stream, "null") : fprintf (stream, "%g", recoptr->imbvtab[i])) < 0;
+    }
+    o |= (fprintf (stream, "]") < 0);
+    if (recoptr->passnbr >= 0)                    /* If iterative method, give throughput of iterations */
+      o |= (fprintf (stream, ", \"passes\": " INTSTRING ", \"edgerate\": %g",
+                     (INT) recoptr->passnbr,
+                     (recoptr->passtim > 0.0) ? ((double) recoptr->edgenbr * (double) recoptr->passnbr / recoptr->passtim) : 0.0) < 0);
+    if (recoptr->bandtim >= 0.0)                  /* If band method, give time spent building band graph */
+      o |= (fprintf (stream, ", \"bandtime\": %g", recoptr->bandtim) < 0);
+    o |= (fprintf (stream, " }") < 0);
+  }
+  arenanbr = (contptr->statptr != NULL) ? contptr->statptr->arenanbr : 0;
+  systnbr  = (contptr->statptr != NULL) ? contptr->statptr->systnbr  : 0;
+  if (contptr->arenptr != NULL) {                 /* Add allocations of arena still in use */
+    arenanbr += contptr->arenptr->allonbr;
+    systnbr  += contptr->arenptr->systnbr;
+  }
+  o |= (fprintf (stream, "%s],\n  \"memory\": { \"arena\": " INTSTRING ", \"system\": " INTSTRING " }\n}\n",
+                 (reconbr > 0) ? "\n  " : "", (INT) arenanbr, (INT) systnbr) < 0);
+
+  memFree (methtab);
+
+  if (o != 0)
+    errorPrint ("contextStatsSave: bad output");
+
+  return (o);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2012-2015,2018,2019,2021,2022,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012-2015,2018,2019,2021,2022,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 04 jul 2012     **/
 /**                                 to   : 27 apr 2015     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 13 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -631,6 +631,274 @@ const int                   thrdnum)              /*+ Number of thread in its ou
     threadContextBarrier (contptr);
 }
 
+/******************************************/
+/*                                        */
+/* Work-stealing task scheduler routines. */
+/*                                        */
+/******************************************/
+
+/* The task scheduler runs fork-join task trees
+** across all threads of a thread context. Every
+** worker thread owns a queue of pending tasks.
+** The owner pushes and pops tasks at the end of
+** its queue, while idle workers steal the oldest,
+** hence largest, tasks from the beginning of the
+** queues of other workers. A thread waiting for
+** the completion of a task keeps running pending
+** tasks in the meantime, so that no thread stays
+** idle as long as some work is available.
+** Since tasks are expected to be coarse-grained,
+** all queues are protected by a single lock.
+*/
+
+/* This routine, to be called with the scheduler
+** lock held, extracts a task to run from the queue
+** of the given worker or, if this queue is empty,
+** steals the oldest task of another worker.
+** It returns:
+** - !NULL  : pointer to the task to run.
+** - NULL   : if no task is pending.
+*/
+
+static
+ThreadTask *
+threadTaskGet (
+ThreadTaskContext * const   contptr,
+const int                   thrdnum)
+{
+  ThreadTaskQueue *   queuptr;
+  int                 thrdtmp;
+
+  if (contptr->tasknbr <= 0)                      /* If no task pending anywhere */
+    return (NULL);
+
+  queuptr = &contptr->quetab[thrdnum];
+  if (queuptr->tasknnd <= queuptr->tasknum) {     /* If local queue is empty */
+    for (thrdtmp = 1; thrdtmp < contptr->thrdnbr; thrdtmp ++) { /* Look for a victim, starting from next thread */
+      queuptr = &contptr->quetab[(thrdnum + thrdtmp) % contptr->thrdnbr];
+      if (queuptr->tasknnd > queuptr->tasknum)    /* If victim has pending tasks */
+        break;
+    }
+#ifdef COMMON_DEBUG
+    if (thrdtmp >= contptr->thrdnbr) {
+      errorPrint ("threadTaskGet: internal error");
+      return (NULL);
+    }
+#endif /* COMMON_DEBUG */
+    contptr->tasknbr --;
+    return (queuptr->tasktab[queuptr->tasknum ++]); /* Steal oldest task */
+  }
+
+  contptr->tasknbr --;
+  return (queuptr->tasktab[-- queuptr->tasknnd]); /* Pop newest local task */
+}
+
+/* This routine runs the given task on behalf
+** of the given worker, and flags its completion.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskRun (
+ThreadTaskDescriptor * const  descptr,
+ThreadTask * const            taskptr)
+{
+  ThreadTaskContext * const contptr = descptr->contptr;
+
+  taskptr->funcptr (descptr, taskptr->paraptr);   /* Run task */
+
+  pthread_mutex_lock (&contptr->lockdat);
+  taskptr->flagval = 1;                           /* Task has completed         */
+  pthread_cond_broadcast (&contptr->conddat);     /* Wake-up any waiting thread */
+  pthread_mutex_unlock (&contptr->lockdat);
+}
+
+/* This routine is run by all the threads of the
+** thread context hosting the task scheduler. The
+** master thread runs the root task, while all other
+** threads look for pending tasks to run until the
+** root task has completed.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskLaunch2 (
+ThreadDescriptor * const    thrdptr,
+ThreadTaskContext * const   contptr)
+{
+  ThreadTaskDescriptor  descdat;
+  ThreadTask *          taskptr;
+
+  descdat.contptr = contptr;
+  descdat.thrdnum = threadNum (thrdptr);
+
+  if (descdat.thrdnum == 0) {                     /* If master thread, run root task */
+    contptr->funcptr (&descdat, contptr->paraptr);
+
+    pthread_mutex_lock (&contptr->lockdat);
+    contptr->flagval = 1;                         /* All tasks have completed */
+    pthread_cond_broadcast (&contptr->conddat);   /* Release idle workers     */
+    pthread_mutex_unlock (&contptr->lockdat);
+    return;
+  }
+
+  pthread_mutex_lock (&contptr->lockdat);
+  while (contptr->flagval == 0) {                 /* As long as root task is running */
+    if ((taskptr = threadTaskGet (contptr, descdat.thrdnum)) != NULL) {
+      pthread_mutex_unlock (&contptr->lockdat);
+      threadTaskRun (&descdat, taskptr);
+      pthread_mutex_lock (&contptr->lockdat);
+    }
+    else
+      pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
+  }
+  pthread_mutex_unlock (&contptr->lockdat);
+}
+
+/* This routine, called by the master thread,
+** starts a task scheduler across all threads of
+** the given thread context, and runs the given
+** root task within it. Tasks spawned by the root
+** task and its descendants can be run by any of
+** the threads. It returns once the root task has
+** completed, since every task is expected to wait
+** for the completion of the tasks it spawned.
+** It returns:
+** - 0   : if the root task has been run.
+** - !0  : on error.
+*/
+
+int
+threadTaskLaunch (
+ThreadContext * const       thrdptr,
+ThreadTaskFunc const        funcptr,              /* Root task function  */
+void * const                paraptr)              /* Root task parameter */
+{
+  ThreadTaskContext   contdat;
+  int                 thrdnum;
+
+  const int           thrdnbr = thrdptr->thrdnbr;
+
+  if ((contdat.quetab = memAlloc (thrdnbr * sizeof (ThreadTaskQueue))) == NULL) {
+    errorPrint ("threadTaskLaunch: out of memory");
+    return (1);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Queue arrays will be allocated on demand */
+    contdat.quetab[thrdnum].tasktab = NULL;
+    contdat.quetab[thrdnum].taskmax =
+    contdat.quetab[thrdnum].tasknum =
+    contdat.quetab[thrdnum].tasknnd = 0;
+  }
+  contdat.thrdnbr = thrdnbr;
+  contdat.tasknbr = 0;
+  contdat.flagval = 0;
+  contdat.funcptr = funcptr;
+  contdat.paraptr = paraptr;
+  threadContextImport1 (&contdat.seqdat, 1);      /* Tasks run on a single thread */
+  pthread_mutex_init (&contdat.lockdat, NULL);
+  pthread_cond_init  (&contdat.conddat, NULL);
+
+  threadLaunch (thrdptr, (ThreadFunc) threadTaskLaunch2, (void *) &contdat);
+
+  pthread_cond_destroy  (&contdat.conddat);
+  pthread_mutex_destroy (&contdat.lockdat);
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (contdat.quetab[thrdnum].tasktab != NULL)
+      memFree (contdat.quetab[thrdnum].tasktab);
+  }
+  memFree (contdat.quetab);
+
+  return (0);
+}
+
+/* This routine makes the given task available
+** for execution by any thread of the scheduler.
+** The task structure must remain valid until the
+** spawning thread has waited for its completion
+** by way of threadTaskWait(). If the task cannot
+** be queued, it is run immediately.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskSpawn (
+ThreadTaskDescriptor * const  descptr,
+ThreadTask * const            taskptr,
+ThreadTaskFunc const          funcptr,            /* Task function  */
+void * const                  paraptr)            /* Task parameter */
+{
+  ThreadTaskQueue *   queuptr;
+
+  ThreadTaskContext * const contptr = descptr->contptr;
+
+  taskptr->funcptr = funcptr;
+  taskptr->paraptr = paraptr;
+  taskptr->flagval = 0;
+
+  pthread_mutex_lock (&contptr->lockdat);
+
+  queuptr = &contptr->quetab[descptr->thrdnum];
+  if (queuptr->tasknum >= queuptr->tasknnd)       /* If queue is empty, reset it */
+    queuptr->tasknum =
+    queuptr->tasknnd = 0;
+  if (queuptr->tasknnd >= queuptr->taskmax) {     /* If no room left at end of queue */
+    ThreadTask **       tasktab;
+    int                 taskmax;
+
+    taskmax = queuptr->taskmax + (queuptr->taskmax >> 1) + 16; /* Compute new size of queue */
+    if ((tasktab = memRealloc (queuptr->tasktab, taskmax * sizeof (ThreadTask *))) == NULL) {
+      pthread_mutex_unlock (&contptr->lockdat);
+      threadTaskRun (descptr, taskptr);           /* Run task immediately if it cannot be queued */
+      return;
+    }
+    queuptr->tasktab = tasktab;
+    queuptr->taskmax = taskmax;
+  }
+  queuptr->tasktab[queuptr->tasknnd ++] = taskptr;
+  contptr->tasknbr ++;
+  pthread_cond_broadcast (&contptr->conddat);     /* Wake-up idle workers */
+
+  pthread_mutex_unlock (&contptr->lockdat);
+}
+
+/* This routine waits for the completion of the
+** given task, previously spawned by the same
+** thread. While the task is not completed, the
+** thread runs pending tasks, starting with the
+** most recent ones of its own queue, which
+** include the awaited task if it has not been
+** stolen by another thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskWait (
+ThreadTaskDescriptor * const  descptr,
+ThreadTask * const            taskptr)
+{
+  ThreadTask *        tkexptr;                    /* Pointer to task to execute */
+
+  ThreadTaskContext * const contptr = descptr->contptr;
+
+  pthread_mutex_lock (&contptr->lockdat);
+  while (taskptr->flagval == 0) {                 /* As long as awaited task not completed */
+    if ((tkexptr = threadTaskGet (contptr, descptr->thrdnum)) != NULL) {
+      pthread_mutex_unlock (&contptr->lockdat);
+      threadTaskRun (descptr, tkexptr);
+      pthread_mutex_lock (&contptr->lockdat);
+    }
+    else
+      pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
+  }
+  pthread_mutex_unlock (&contptr->lockdat);
+}
+
 #endif /* COMMON_PTHREAD */
 
 /**********************************/
@@ -759,6 +1027,65 @@ const int                   thrdnum)              /*+ Number of thread in its ou
 {
 }
 
+/*
+**
+*/
+
+int
+threadTaskLaunch (
+ThreadContext * const       thrdptr,
+ThreadTaskFunc const        funcptr,              /* Root task function  */
+void * const                paraptr)              /* Root task parameter */
+{
+  ThreadTaskContext     contdat;
+  ThreadTaskDescriptor  descdat;
+
+  contdat.quetab  = NULL;                         /* No queues, as tasks are run immediately */
+  contdat.thrdnbr = 1;
+  contdat.tasknbr = 0;
+  contdat.flagval = 0;
+  contdat.funcptr = funcptr;
+  contdat.paraptr = paraptr;
+  threadContextImport1 (&contdat.seqdat, 1);
+
+  descdat.contptr = &contdat;
+  descdat.thrdnum = 0;
+
+  funcptr (&descdat, paraptr);                    /* Run root task alone */
+
+  return (0);
+}
+
+/*
+**
+*/
+
+void
+threadTaskSpawn (
+ThreadTaskDescriptor * const  descptr,
+ThreadTask * const            taskptr,
+ThreadTaskFunc const          funcptr,            /* Task function  */
+void * const                  paraptr)            /* Task parameter */
+{
+  taskptr->funcptr = funcptr;
+  taskptr->paraptr = paraptr;
+
+  funcptr (descptr, paraptr);                     /* Run task immediately */
+
+  taskptr->flagval = 1;
+}
+
+/*
+**
+*/
+
+void
+threadTaskWait (
+ThreadTaskDescriptor * const  descptr,
+ThreadTask * const            taskptr)
+{
+}
+
 #endif /* COMMON_PTHREAD */
 
 /*****************************/
@@ -1,4 +1,4 @@
-/* Copyright 2018,2019,2021,2022,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2019,2021,2022,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                routines.                               **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 05 jun 2018     **/
-/**                                 to   : 06 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -87,6 +87,31 @@ struct ThreadContext_ {
 #endif /* COMMON_PTHREAD */
 };
 
+/*+ Per-worker queue of pending tasks. +*/
+
+typedef struct ThreadTaskQueue_ {
+  ThreadTask **                 tasktab;          /*+ Array of pointers to pending tasks  +*/
+  int                           taskmax;          /*+ Size of task array                  +*/
+  int                           tasknum;          /*+ Index of oldest pending task        +*/
+  int                           tasknnd;          /*+ Index after newest pending task     +*/
+} ThreadTaskQueue;
+
+/*+ Work-stealing task scheduler context. The abstract type is defined in "common.h". +*/
+
+struct ThreadTaskContext_ {
+  ThreadContext                 seqdat;           /*+ Sequential context for running tasks +*/
+  ThreadTaskQueue *             quetab;           /*+ Array of per-worker task queues      +*/
+  int                           thrdnbr;          /*+ Number of worker threads             +*/
+  int                           tasknbr;          /*+ Overall number of pending tasks      +*/
+  int                           flagval;          /*+ Set once root task has completed     +*/
+  ThreadTaskFunc                funcptr;          /*+ Root task function                   +*/
+  void *                        paraptr;          /*+ Root task parameter                  +*/
+#ifdef COMMON_PTHREAD
+  pthread_mutex_t               lockdat;          /*+ Lock for updating queues             +*/
+  pthread_cond_t                conddat;          /*+ Wakeup condition for idle workers    +*/
+#endif /* COMMON_PTHREAD */
+};
+
 /*
 **  The function prototypes.
 */
@@ -101,5 +126,9 @@ static int                  threadProcessCoreNbr (ThreadContext * const);
 static int                  threadProcessCoreNum (ThreadContext * const, int);
 static void                 threadProcessStateRestore (ThreadContext * const);
 static void                 threadProcessStateSave (ThreadContext * const);
+
+static ThreadTask *         threadTaskGet       (ThreadTaskContext * const, const int);
+static void                 threadTaskRun       (ThreadTaskDescriptor * const, ThreadTask * const);
+static void                 threadTaskLaunch2   (ThreadDescriptor * const, ThreadTaskContext * const);
 #endif /* COMMON_PTHREAD */
 #endif /* SCOTCH_COMMON_THREAD */
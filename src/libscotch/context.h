@@ -1,4 +1,4 @@
-/* Copyright 2018,2019,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2019,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                routines.                               **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 08 oct 2021     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +59,7 @@
 typedef enum {
   CONTEXTOPTIONNUMDETERMINISTIC,
   CONTEXTOPTIONNUMRANDOMFIXEDSEED,
+  CONTEXTOPTIONNUMMEMORYBUDGET,
   CONTEXTOPTIONNUMNBR
 } ContextOptionNum;
 
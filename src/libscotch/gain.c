@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 20 aug 2020     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -67,6 +67,7 @@
 #include "common.h"
 #include "gain.h"
 
+
 /* #define SCOTCH_DEBUG_GAIN3 */
 
 /*
@@ -90,6 +91,8 @@ static GainLink             gainLinkDummy;        /*+ Dummy link space for fast
 
 #ifdef SCOTCH_DEBUG_GAIN3
 
+#ifndef SCOTCH_GAIN_ARRAY
+
 static
 int
 gainTablCheck2 (
@@ -132,11 +135,57 @@ GainEntr * const            entrptr)
   return (0);
 }
 
+#else /* SCOTCH_GAIN_ARRAY */
+
+static
+int
+gainTablCheck (
+GainEntr * const            entrptr)
+{
+  INT                 linknum;
+  INT                 linknbr;
+
+  if ((entrptr->linknnd < 0) ||
+      (entrptr->linknnd > entrptr->linkmax)) {
+    errorPrint ("gainTablCheck: invalid link array size");
+    return (1);
+  }
+  if ((entrptr->linknnd > 0) &&                   /* Last slot must always hold a link */
+      (entrptr->linktab[entrptr->linknnd - 1] == NULL)) {
+    errorPrint ("gainTablCheck: bad last link");
+    return (1);
+  }
+
+  for (linknum = linknbr = 0; linknum < entrptr->linknnd; linknum ++) {
+    const GainLink *    linkptr;
+
+    linkptr = entrptr->linktab[linknum];
+    if (linkptr == NULL)                          /* Skip holes left by removed links */
+      continue;
+    if ((linkptr->tabl != entrptr) ||
+        (linkptr->linknum != linknum)) {
+      errorPrint ("gainTablCheck: bad link array");
+      return (1);
+    }
+    linknbr ++;
+  }
+  if (linknbr != entrptr->linknbr) {
+    errorPrint ("gainTablCheck: invalid number of links");
+    return (1);
+  }
+
+  return (0);
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
+
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
 /* This routine allocates and initializes
 ** a gain table structure with the proper
-** number of subbits.
+** number of subbits. The table is taken
+** from the work memory arena of the given
+** context, within which it must be freed.
 ** It returns:
 ** - !NULL  : pointer to the gain table;
 ** - NULL   : on error.
@@ -145,7 +194,8 @@ GainEntr * const            entrptr)
 GainTabl *
 gainTablInit (
 const INT                   gainmax,
-const INT                   subbits)
+const INT                   subbits,
+Context * const             contptr)
 {
   GainEntr *          entrptr;
   GainTabl *          tablptr;
@@ -154,7 +204,8 @@ const INT                   subbits)
   if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing           */
     totsize = ((sizeof (INT) << 3) - subbits) << (subbits + 1); /* Allocate gain table */
 
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
+    if (contextArenaAllocGroup (contptr, (void **) (void *)
+                                &tablptr, (size_t) (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr)), NULL) == NULL)
       return (NULL);
 
     tablptr->tablAdd = gainTablAddLog;
@@ -165,7 +216,8 @@ const INT                   subbits)
   else {                                          /* Linear indexing     */
     totsize = 2 * GAIN_LINMAX;                    /* Allocate gain table */
 
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
+    if (contextArenaAllocGroup (contptr, (void **) (void *)
+                                &tablptr, (size_t) (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr)), NULL) == NULL)
       return (NULL);
 
     tablptr->tablAdd = gainTablAddLin;
@@ -180,8 +232,16 @@ const INT                   subbits)
   tablptr->tmax    = tablptr->tabk;
 
   for (entrptr  = tablptr->tabk;                  /* Initialize gain table entries */
-       entrptr <= tablptr->tend; entrptr ++)
+       entrptr <= tablptr->tend; entrptr ++) {
+#ifndef SCOTCH_GAIN_ARRAY
     entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
+#else /* SCOTCH_GAIN_ARRAY */
+    entrptr->linktab = NULL;                      /* Link arrays are allocated on demand */
+    entrptr->linknbr =
+    entrptr->linknnd =
+    entrptr->linkmax = 0;
+#endif /* SCOTCH_GAIN_ARRAY */
+  }
 
   return (tablptr);
 }
@@ -193,9 +253,20 @@ const INT                   subbits)
 
 void
 gainTablExit (
-GainTabl * const         tablptr)
+GainTabl * const            tablptr,
+Context * const             contptr)
 {
-  memFree (tablptr);                              /* Free table structure itself */
+#ifdef SCOTCH_GAIN_ARRAY
+  GainEntr *          entrptr;
+
+  for (entrptr  = tablptr->tabk;                  /* Free link arrays of all entries */
+       entrptr <= tablptr->tend; entrptr ++) {
+    if (entrptr->linktab != NULL)
+      memFree (entrptr->linktab);
+  }
+#endif /* SCOTCH_GAIN_ARRAY */
+
+  contextArenaFree (contptr, tablptr);            /* Free table structure itself */
 }
 
 /* This routine flushes the contents of
@@ -211,13 +282,93 @@ GainTabl * const            tablptr)
   GainEntr *          entrptr;
 
   for (entrptr  = tablptr->tmin;                  /* Flush only used area */
-       entrptr <= tablptr->tmax; entrptr ++)
+       entrptr <= tablptr->tmax; entrptr ++) {
+#ifndef SCOTCH_GAIN_ARRAY
     entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
+#else /* SCOTCH_GAIN_ARRAY */
+    entrptr->linknbr =                            /* Keep link array for further use */
+    entrptr->linknnd = 0;
+#endif /* SCOTCH_GAIN_ARRAY */
+  }
 
   tablptr->tmin = tablptr->tend;                  /* Entries of extremal gain */
   tablptr->tmax = tablptr->tabk;
 }
 
+/* This routine squeezes out the holes left
+** by removed links in the link array of the
+** given gain table entry, preserving the
+** order of the remaining links.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+#ifdef SCOTCH_GAIN_ARRAY
+
+static
+void
+gainTablPack (
+GainEntr * const            entrptr)              /*+ Pointer to gain entry +*/
+{
+  GainLink ** const   linktab = entrptr->linktab;
+  INT                 linknum;
+  INT                 linknew;
+
+  for (linknum = linknew = 0; linknum < entrptr->linknnd; linknum ++) {
+    if (linktab[linknum] != NULL) {
+      linktab[linknew] = linktab[linknum];
+      linktab[linknew]->linknum = linknew;
+      linknew ++;
+    }
+  }
+  entrptr->linknnd = linknew;
+}
+
+/* This routine appends a link to the link
+** array of the given gain table entry. When
+** the array is full, it is packed, and it is
+** enlarged only if it is still at least half
+** full. If the array cannot be enlarged, the
+** link is left unchained, so that it will
+** never be selected.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+gainTablAddEntr (
+GainEntr * const            entrptr,              /*+ Pointer to gain entry  +*/
+GainLink * const            linkptr)              /*+ Pointer to link to add +*/
+{
+  linkptr->next = &gainLinkDummy;                 /* Flag link as chained for callers testing it */
+  linkptr->tabl = entrptr;                        /* Set table position                          */
+
+  if (entrptr->linknnd >= entrptr->linkmax) {     /* If link array is full */
+    gainTablPack (entrptr);
+
+    if (entrptr->linknnd >= (entrptr->linkmax / 2)) { /* If not enough room recovered, enlarge array */
+      GainLink **         linktab;
+      INT                 linkmax;
+
+      linkmax = (entrptr->linkmax <= 0) ? GAIN_ARRAYMIN : (entrptr->linkmax * 2);
+      if ((linktab = (GainLink **) memRealloc (entrptr->linktab, linkmax * sizeof (GainLink *))) == NULL) {
+        errorPrint ("gainTablAddEntr: out of memory");
+        linkptr->linknum = -1;                    /* Link will be ignored by subsequent deletion */
+        return;
+      }
+      entrptr->linktab = linktab;
+      entrptr->linkmax = linkmax;
+    }
+  }
+
+  linkptr->linknum = entrptr->linknnd;            /* Append link to entry array */
+  entrptr->linktab[entrptr->linknnd ++] = linkptr;
+  entrptr->linknbr ++;
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /* This routine adds a vertex to the table
 ** and table gain indicated in the vertex
 ** fields.
@@ -232,7 +383,9 @@ GainLink * const            linkptr,              /*+ Pointer to entry to add +*
 const INT                   gain)                 /*+ Gain value              +*/
 {
   GainEntr *          entrptr;                    /* Pointer to gain entry   */
+#ifndef SCOTCH_GAIN_ARRAY
   GainLink *          headptr;                    /* Pointer to head of list */
+#endif /* SCOTCH_GAIN_ARRAY */
 
 #ifdef SCOTCH_DEBUG_GAIN2
   if (tablptr->tablAdd != gainTablAddLin) {
@@ -252,12 +405,16 @@ const INT                   gain)                 /*+ Gain value              +*
   if (entrptr > tablptr->tmax)
     tablptr->tmax = entrptr;
 
+#ifndef SCOTCH_GAIN_ARRAY
   headptr = (GainLink *) entrptr;                 /* TRICK: assume gain entry is a link */
   linkptr->tabl       = entrptr;                  /* Set table position                 */
   headptr->next->prev = linkptr;                  /* Link vertex in gain list: TRICK    */
   linkptr->prev       = headptr;
   linkptr->next       = headptr->next;
   headptr->next       = linkptr;
+#else /* SCOTCH_GAIN_ARRAY */
+  gainTablAddEntr (entrptr, linkptr);
+#endif /* SCOTCH_GAIN_ARRAY */
 }
 
 /* This routine adds a vertex to the table
@@ -299,28 +456,40 @@ const INT                   gain)                 /*+ Gain value              +*
     tablptr->tmax = entrptr;
 
 #ifdef SCOTCH_DEBUG_GAIN3
+#ifndef SCOTCH_GAIN_ARRAY
   if ((entrptr->next != &gainLinkDummy) &&
       (entrptr->next->prev != (GainLink *) entrptr)) {
     errorPrint ("gainTablAddLog: bad first element");
     return;
   }
+#endif /* SCOTCH_GAIN_ARRAY */
   if (gainTablCheck (entrptr) != 0)
     errorPrint ("gainTablAddLog: bad chaining");
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
+#ifndef SCOTCH_GAIN_ARRAY
   entrptr->next->prev = linkptr;                  /* Link vertex in gain list: TRICK */
   linkptr->prev       = (GainLink *) entrptr;
   linkptr->next       = entrptr->next;
   linkptr->tabl       = entrptr;                  /* Set table position */
   entrptr->next       = linkptr;
+#else /* SCOTCH_GAIN_ARRAY */
+  gainTablAddEntr (entrptr, linkptr);
+#endif /* SCOTCH_GAIN_ARRAY */
 }
 
 /* This routine removes a link
-** from the table.
+** from the table. In array mode, the
+** slot of the removed link is left empty,
+** so that links of equal gain are scanned
+** in the same order as with linked lists,
+** and links which are not chained in the
+** table are left untouched.
 ** It returns:
 ** - VOID  : in all cases.
 */
 
+#ifndef SCOTCH_GAIN_ARRAY
 #ifdef SCOTCH_DEBUG_GAIN1                         /* Compiled only in debug mode */
 void
 gainTablDel (
@@ -345,6 +514,52 @@ GainLink * const            linkptr)              /*+ Pointer to link to delete
 }
 #endif /* SCOTCH_DEBUG_GAIN1 */
 
+#else /* SCOTCH_GAIN_ARRAY */
+
+void
+gainTablDel (
+GainTabl * const            tablptr,
+GainLink * const            linkptr)              /*+ Pointer to link to delete +*/
+{
+  GainEntr *          entrptr;
+  INT                 linknum;
+
+  linknum = linkptr->linknum;
+  if ((linkptr->next != &gainLinkDummy) ||        /* If link is not chained (e.g. self-linked root vertex) */
+      (linknum < 0))                              /* Or has already been removed, nothing to do           */
+    return;
+
+  entrptr = linkptr->tabl;
+#ifdef SCOTCH_DEBUG_GAIN3
+  if (gainTablCheck (entrptr) != 0) {
+    errorPrint ("gainTablDel: bad chaining");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+#ifdef SCOTCH_DEBUG_GAIN1
+  if ((linknum >= entrptr->linknnd) ||
+      (entrptr->linktab[linknum] != linkptr)) {
+    errorPrint ("gainTablDel: link not in table");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN1 */
+
+  entrptr->linktab[linknum] = NULL;               /* Leave hole, so as to preserve link order */
+  entrptr->linknbr --;
+  linkptr->linknum = -1;                          /* Link is no longer chained */
+
+  if (linknum == (entrptr->linknnd - 1)) {        /* If last link removed, trim trailing holes */
+    INT                 linknnd;
+
+    for (linknnd = linknum; (linknnd > 0) && (entrptr->linktab[linknnd - 1] == NULL); linknnd --) ;
+    entrptr->linknnd = linknnd;
+  }
+  else if (entrptr->linknnd > (2 * entrptr->linknbr)) /* If more holes than links, pack array */
+    gainTablPack (entrptr);
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /* This routine returns the link of best
 ** gain in the table structure.
 ** It returns:
@@ -352,6 +567,8 @@ GainLink * const            linkptr)              /*+ Pointer to link to delete
 ** - NULL   : if no such vertex available.
 */
 
+#ifndef SCOTCH_GAIN_ARRAY
+
 GainLink *
 gainTablFrst (
 GainTabl * const            tablptr)
@@ -387,6 +604,34 @@ GainTabl * const            tablptr)
   return (NULL);
 }
 
+#else /* SCOTCH_GAIN_ARRAY */
+
+GainLink *
+gainTablFrst (
+GainTabl * const            tablptr)
+{
+  GainEntr *          entrptr;
+
+  for (entrptr = tablptr->tmin; entrptr <= tablptr->tend; entrptr ++) {
+    if (entrptr->linknbr > 0) {                   /* If found non-empty slot */
+      tablptr->tmin = entrptr;                    /* Record its position     */
+#ifdef SCOTCH_DEBUG_GAIN3
+      if (gainTablCheck (entrptr) != 0) {
+        errorPrint ("gainTablFrst: bad chaining");
+        return     (NULL);
+      }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+      return (entrptr->linktab[entrptr->linknnd - 1]); /* Most recently added link first, as for lists */
+    }
+  }
+  tablptr->tmin = tablptr->tend;                  /* Set table as empty */
+  tablptr->tmax = tablptr->tabk;
+
+  return (NULL);
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /* This routine returns the next best vertex
 ** following the given vertex.
 ** It returns:
@@ -394,6 +639,8 @@ GainTabl * const            tablptr)
 ** - NULL   : if no such vertex available.
 */
 
+#ifndef SCOTCH_GAIN_ARRAY
+
 GainLink *
 gainTablNext (
 GainTabl * const            tablptr,
@@ -427,6 +674,39 @@ const GainLink * const      linkptr)
   return (NULL);
 }
 
+#else /* SCOTCH_GAIN_ARRAY */
+
+GainLink *
+gainTablNext (
+GainTabl * const            tablptr,
+const GainLink * const      linkptr)
+{
+  GainEntr *          entrptr;
+  INT                 linknum;
+
+  for (linknum = linkptr->linknum - 1; linknum >= 0; linknum --) { /* Search remaining links of current entry */
+    if (linkptr->tabl->linktab[linknum] != NULL)
+      return (linkptr->tabl->linktab[linknum]);
+  }
+
+  for (entrptr = linkptr->tabl + 1;
+       entrptr < tablptr->tend; entrptr ++) {
+    if (entrptr->linknbr > 0) {
+#ifdef SCOTCH_DEBUG_GAIN3
+      if (gainTablCheck (entrptr) != 0) {
+        errorPrint ("gainTablNext: bad chaining");
+        return     (NULL);
+      }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+      return (entrptr->linktab[entrptr->linknnd - 1]);
+    }
+  }
+
+  return (NULL);
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /* This routine recomputes all the pointer
 ** addresses of the given gain table when the
 ** memory area that contains gain links has
@@ -444,6 +724,7 @@ const ptrdiff_t             addrdlt)
 
   for (entrptr  = tablptr->tmin;                  /* For all active gain table entries */
        entrptr <= tablptr->tmax; entrptr ++) {
+#ifndef SCOTCH_GAIN_ARRAY
     GainLink *          linkptr;
     GainLink *          prevptr;
 
@@ -464,6 +745,16 @@ const ptrdiff_t             addrdlt)
       errorPrint ("gainTablMove: bad first element");
       return;
     }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+#else /* SCOTCH_GAIN_ARRAY */
+    INT                 linknum;
+
+    for (linknum = 0; linknum < entrptr->linknnd; linknum ++) { /* Skew all link pointers of entry array */
+      if (entrptr->linktab[linknum] != NULL)
+        entrptr->linktab[linknum] = (GainLink *) ((byte *) entrptr->linktab[linknum] + addrdlt);
+    }
+#endif /* SCOTCH_GAIN_ARRAY */
+#ifdef SCOTCH_DEBUG_GAIN3
     if (gainTablCheck (entrptr) != 0)
       errorPrint ("gainTablMove: bad chaining");
 #endif /* SCOTCH_DEBUG_GAIN3 */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2018,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2018,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 20 aug 2020     **/
 /**                # Version 7.0  : from : 18 jan 2023     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -63,6 +63,8 @@
 
 #define GAIN_LINMAX              1024
 
+#define GAIN_ARRAYMIN            16               /*+ Initial size of entry link arrays +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -75,13 +77,29 @@ typedef struct GainLink_ {
   struct GainLink_ *        next;                 /*+ Pointer to next element: FIRST +*/
   struct GainLink_ *        prev;                 /*+ Pointer to previous element    +*/
   struct GainEntr_ *        tabl;                 /*+ Index into the gain table      +*/
+#ifdef SCOTCH_GAIN_ARRAY
+  INT                       linknum;              /*+ Index of link in entry array   +*/
+#endif /* SCOTCH_GAIN_ARRAY */
 } GainLink;
 
-/* Gain table entry structure. */
+/* Gain table entry structure. In array mode, the
+   links of each entry are stored as a contiguous
+   array of pointers, in insertion order. Removed
+   links leave holes, which are squeezed out when
+   they outnumber the remaining links.            */
 
+#ifndef SCOTCH_GAIN_ARRAY
 typedef struct GainEntr_ {
   GainLink *                next;                 /*+ Pointer to first element: FIRST +*/
 } GainEntr;
+#else /* SCOTCH_GAIN_ARRAY */
+typedef struct GainEntr_ {
+  GainLink **               linktab;              /*+ Array of pointers to links; NULL if hole +*/
+  INT                       linknbr;              /*+ Number of links in entry                 +*/
+  INT                       linknnd;              /*+ Index after last used slot of array      +*/
+  INT                       linkmax;              /*+ Size of link pointer array               +*/
+} GainEntr;
+#endif /* SCOTCH_GAIN_ARRAY */
 
 /* The gain table structure, built from table entries.
    For trick reasons, the pointer to the first entry
@@ -103,8 +121,8 @@ typedef struct GainTabl_ {
 **  The function prototypes.
 */
 
-GainTabl *                  gainTablInit        (const INT, const INT);
-void                        gainTablExit        (GainTabl * const);
+GainTabl *                  gainTablInit        (const INT, const INT, Context * const);
+void                        gainTablExit        (GainTabl * const, Context * const);
 void                        gainTablFree        (GainTabl * const);
 void                        gainTablAddLin      (GainTabl * const, GainLink * const, const INT);
 void                        gainTablAddLog      (GainTabl * const, GainLink * const, const INT);
@@ -112,10 +130,18 @@ void                        gainTablDel         (GainTabl * const, GainLink * co
 GainLink *                  gainTablFrst        (GainTabl * const);
 GainLink *                  gainTablNext        (GainTabl * const, const GainLink * const);
 void                        gainTablMove        (GainTabl * const, const ptrdiff_t);
+#ifdef SCOTCH_GAIN
+#ifdef SCOTCH_GAIN_ARRAY
+static void                 gainTablPack        (GainEntr * const);
+static void                 gainTablAddEntr     (GainEntr * const, GainLink * const);
+#endif /* SCOTCH_GAIN_ARRAY */
+#endif /* SCOTCH_GAIN */
 #ifdef SCOTCH_DEBUG_GAIN3
 #ifdef SCOTCH_GAIN
 static int                  gainTablCheck       (GainEntr * const);
+#ifndef SCOTCH_GAIN_ARRAY
 static int                  gainTablCheck2      (GainEntr * const, GainLink * const);
+#endif /* SCOTCH_GAIN_ARRAY */
 #endif /* SCOTCH_GAIN */
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
@@ -125,7 +151,7 @@ static int                  gainTablCheck2      (GainEntr * const, GainLink * co
 
 #define gainTablEmpty(tabl)         ((tabl)->tmin == (tabl)->tend)
 #define gainTablAdd(tabl,link,gain) ((tabl)->tablAdd  ((tabl), (link), (gain)))
-#if ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1))
+#if ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1) && (! defined SCOTCH_GAIN_ARRAY))
 #define gainTablDel(tabl,link)      (((GainLink *) (link))->next->prev = ((GainLink *) (link))->prev, \
                                      ((GainLink *) (link))->prev->next = ((GainLink *) (link))->next)
-#endif /* ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1)) */
+#endif /* ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1) && (! defined SCOTCH_GAIN_ARRAY)) */
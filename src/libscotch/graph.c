@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2014,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2014,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 sep 2012     **/
 /**                                 to   : 09 aug 2014     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -118,6 +118,14 @@ void
 graphFree (
 Graph * const               grafptr)
 {
+  if ((grafptr->flagval & (GRAPHEDGEPACK | GRAPHFREEEDGE)) == (GRAPHEDGEPACK | GRAPHFREEEDGE)) /* If packed edge array must be freed */
+    memFree (grafptr->packptr);                   /* Free it, along with grouped edge loads, if any                                  */
+
+  if ((grafptr->flagval & (GRAPHFREEMMAP | GRAPHFREEVERT)) == (GRAPHFREEMMAP | GRAPHFREEVERT)) { /* If graph arrays are mapped */
+    graphUnmapBgrf (grafptr);                     /* Unmap them all at once                                                 */
+    grafptr->flagval &= ~(GRAPHFREEEDGE | GRAPHFREEVERT | GRAPHFREEOTHR); /* Mapped arrays must not be freed afterwards */
+  }
+
   if (((grafptr->flagval & GRAPHFREEEDGE) != 0) && /* If edgetab must be freed */
       (grafptr->edgetax != NULL))                 /* And if it exists          */
     memFree (grafptr->edgetax + grafptr->baseval); /* Free it                  */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014-2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 10 may 2019     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 18 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,9 +85,11 @@
 #define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHFREEMMAP               0x0040        /*+ Unmap instead of free     +*/
+#define GRAPHEDGEPACK               0x0080        /*+ Edge array is packed      +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x00FF        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0100        /*+ Value above which bits not used by plain graph routines +*/
 
 #define GRAPHIONOLOADVERT           1             /*+ Remove vertex loads on loading +*/
 #define GRAPHIONOLOADEDGE           2             /*+ Remove edge loads on loading   +*/
@@ -123,6 +125,24 @@ typedef struct VertList_ {
 
 typedef unsigned int GraphFlag;                   /*+ Graph property flags +*/
 
+/*+ The packed edge array structure. The
+    neighbors of every vertex are stored in
+    their original order, as variable-length
+    unsigned integers coding the zig-zag-encoded
+    difference between each neighbor and the
+    previous one (the vertex itself, for the first
+    neighbor). Values are stored seven bits per
+    byte, least significant bits first, the most
+    significant bit of each byte being set when
+    more bytes follow.                              +*/
+
+typedef struct GraphPack_ {
+  Gnum *                    bytetax;              /*+ Index of first packed byte of each vertex [based] +*/
+  byte *                    bytetab;              /*+ Packed neighbor array                             +*/
+  Gnum                      bytenbr;              /*+ Number of bytes in packed neighbor array          +*/
+  Gnum *                    edlotax;              /*+ Edge load array, if moved into packed group       +*/
+} GraphPack;
+
 /*+ The graph structure. +*/
 
 typedef struct Graph_ {
@@ -138,11 +158,25 @@ typedef struct Graph_ {
   Gnum *                    vlbltax;              /*+ Vertex label (from file)                  +*/
   Gnum                      edgenbr;              /*+ Number of edges (arcs) in graph           +*/
   Gnum *                    edgetax;              /*+ Edge array [based]                        +*/
+  GraphPack *               packptr;              /*+ Packed edge array, if edgetax is NULL     +*/
   Gnum *                    edlotax;              /*+ Edge load array (if present)              +*/
   Gnum                      edlosum;              /*+ Sum of edge (in fact arc) loads           +*/
   Gnum                      degrmax;              /*+ Maximum degree                            +*/
 } Graph;
 
+/*+ The edge cursor structure, which allows
+    one to traverse the neighbors of a vertex
+    whether the edge array is packed or not.  +*/
+
+typedef struct GraphCursor_ {
+  Gnum                      edgenum;              /*+ Current edge index                       +*/
+  Gnum                      edgennd;              /*+ After-last edge index                    +*/
+  Gnum                      vertend;              /*+ Current end vertex                       +*/
+  const Gnum *              edgetax;              /*+ Plain edge array, or NULL if packed      +*/
+  const byte *              byteptr;              /*+ Pointer to next packed neighbor, if any  +*/
+  Gunum                     diffval;              /*+ Zig-zag-encoded difference with previous +*/
+} GraphCursor;
+
 /*
 **  The function prototypes.
 */
@@ -160,7 +194,7 @@ int                         graphInit           (Graph * const);
 void                        graphExit           (Graph * const);
 void                        graphFree           (Graph * const);
 Gnum                        graphBase           (Graph * const, const Gnum);
-int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const);
+int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const, Context * restrict const);
 int                         graphCheck          (const Graph *);
 int                         graphClone          (const Graph *, Graph *);
 Gnum                        graphDiamPV         (const Graph * restrict const, Context * restrict const);
@@ -168,10 +202,20 @@ Gnum                        graphIelo           (const Graph * const, Gnum * con
 int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const);
 int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
 int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphFlag);
+int                         graphLoad1          (Graph * restrict const, FILE * const, const Gnum, const GraphFlag, char * const, Gnum * const);
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+int                         graphLoadBgrf       (Graph * restrict const, FILE * const, const Gnum, const GraphFlag);
+int                         graphLoadThread     (Graph * restrict const, FILE * const, const Gnum, const GraphFlag, Context * restrict const);
+int                         graphPack           (Graph * restrict const);
+Gunum                       graphPackRead       (const byte ** const);
 int                         graphSave           (const Graph * const, FILE * const);
+int                         graphSaveBgrf       (const Graph * const, FILE * const);
+void                        graphUnmapBgrf      (Graph * const);
+int                         graphUnpack         (Graph * restrict const);
 
 #ifdef SCOTCH_GEOM_H
+int                         graphGeomLoadBgrf   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomSaveBgrf   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomSaveChac   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadHabo   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
@@ -180,3 +224,22 @@ int                         graphGeomSaveMmkt   (const Graph * restrict const, c
 int                         graphGeomLoadScot   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomSaveScot   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 #endif /* SCOTCH_GEOM_H */
+
+/*
+**  The macro definitions.
+*/
+
+#define GRAPHPACKDECODE(d)          (((d) >> 1) ^ ((Gunum) 0 - ((d) & 1))) /*+ Decode zig-zag value into two's complement difference +*/
+#define GRAPHPACKENCODE(d)          (((Gunum) (d) << 1) ^ (((d) < 0) ? ~((Gunum) 0) : 0)) /*+ Encode signed difference as zig-zag value +*/
+
+#define graphCursorInit(c,g,v)      ((c)->edgenum = (g)->verttax[v] - 1,                  \
+                                     (c)->edgennd = (g)->vendtax[v],                      \
+                                     (c)->vertend = (v),                                  \
+                                     (c)->edgetax = (g)->edgetax,                         \
+                                     (c)->byteptr = (((g)->flagval & GRAPHEDGEPACK) != 0) \
+                                                    ? ((g)->packptr->bytetab + (g)->packptr->bytetax[v]) : NULL)
+#define graphCursorNext(c)          ((++ (c)->edgenum < (c)->edgennd) &&                  \
+                                     (((c)->edgetax != NULL)                              \
+                                      ? ((c)->vertend = (c)->edgetax[(c)->edgenum], 1)    \
+                                      : ((c)->diffval = (*(c)->byteptr < 0x80) ? (Gunum) *((c)->byteptr ++) : graphPackRead (&(c)->byteptr), \
+                                         (c)->vertend = (Gnum) ((Gunum) (c)->vertend + GRAPHPACKDECODE ((c)->diffval)), 1)))
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,11 +42,20 @@
 /**   DATES      : # Version 6.0  : from : 05 jan 2010     **/
 /**                                 to   : 22 sep 2011     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code derives from the code of    **/
 /**                  dgraph_band.c in version 5.1.         **/
 /**                                                        **/
+/**                # The threaded version grows the band   **/
+/**                  level by level. Every vertex of the   **/
+/**                  next level is given to the vertex of  **/
+/**                  the current level that has the lowest **/
+/**                  queue index, so that the numbering of **/
+/**                  band vertices is the same as the one  **/
+/**                  of the sequential version, whatever   **/
+/**                  the number of threads.                **/
+/**                                                        **/
 /************************************************************/
 
 /*
@@ -56,6 +65,7 @@
 #include "module.h"
 #include "common.h"
 #include "graph.h"
+#include "graph_band.h"
 
 /**********************************/
 /*                                */
@@ -63,8 +73,216 @@
 /*                                */
 /**********************************/
 
+#ifndef GRAPHBANDNOTHREAD
+static
+void
+graphBandScan (
+GraphBandThread * restrict const  blocptr,        /* Pointer to local block  */
+GraphBandThread * restrict const  bremptr,        /* Pointer to remote block */
+const int                         srcpval,        /* Source phase value      */
+const int                         dstpval,        /* Destination phase value */
+const void * const                globptr)        /* Unused                  */
+{
+  if (bremptr != NULL) {
+    blocptr->queunnd[dstpval] = blocptr->queunnd[srcpval] + bremptr->queunnd[srcpval];
+    blocptr->bandnnd[dstpval] = blocptr->bandnnd[srcpval] + bremptr->bandnnd[srcpval];
+  }
+  else {
+    blocptr->queunnd[dstpval] = blocptr->queunnd[srcpval];
+    blocptr->bandnnd[dstpval] = blocptr->bandnnd[srcpval];
+  }
+}
+
+/* This routine grows the band graph around
+** the frontier vertices, level by level, in
+** the same order as the sequential version.
+** Within each level, threads first claim the
+** unvisited neighbors of their share of the
+** level, and compute for each of them the
+** lowest queue index of its neighbors in the
+** level. Then, each thread counts and, after
+** a scan, enqueues and numbers the vertices
+** it is the discoverer of.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphBand2 (
+ThreadDescriptor * restrict const descptr,
+GraphBandData * restrict const    dataptr)
+{
+  Gnum                      vertbas;              /* Start index of vertex range               */
+  Gnum                      vertnnd;              /* End index of vertex range                 */
+  Gnum                      queuheadidx;          /* Index of head of queue                    */
+  Gnum                      queutailidx;          /* Index of tail of queue                    */
+  Gnum                      queubas;              /* Start index of queue sub-array of thread  */
+  Gnum                      queunnd;              /* End index of queue sub-array of thread    */
+  Gnum                      queunum;
+  Gnum                      queuidx;              /* Index at which to enqueue next vertex     */
+  Gnum                      queunbr;              /* Number of vertices enqueued by thread     */
+  Gnum                      bandvertbas;          /* Band number of first vertex of next level */
+  Gnum                      bandvertnum;
+  Gnum                      bandvertnbr;          /* Number of band vertices numbered by thread */
+  Gnum                      bandedgenbr;
+  Gnum                      bandvfixnbr;
+  Gnum                      distval;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  const int                           thrdlst = thrdnbr - 1;
+  GraphBandThread * restrict const    thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const        grafptr = dataptr->grafptr;
+  const Gnum * restrict const         verttax = grafptr->verttax;
+  const Gnum * restrict const         vendtax = grafptr->vendtax;
+  const Gnum * restrict const         pfixtax = dataptr->pfixtax;
+  Gnum * restrict const               queutab = dataptr->queutab;
+  Gnum * restrict const               vnumtax = dataptr->vnumtax;
+  Gnum * restrict const               qpostax = dataptr->qpostax;
+  volatile int * restrict const       locktax = dataptr->locktax;
+
+  vertbas = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum); /* Reset flag arrays in parallel */
+  vertnnd = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum + 1);
+  memSet (vnumtax + vertbas, ~0, (vertnnd - vertbas) * sizeof (Gnum));
+  memSet ((void *) (locktax + vertbas), 0, (vertnnd - vertbas) * sizeof (int));
+
+  queubas = DATASCAN (dataptr->queunbr, thrdnbr, thrdnum); /* Number frontier vertices in parallel */
+  queunnd = DATASCAN (dataptr->queunbr, thrdnbr, thrdnum + 1);
+  for (queunum = queubas, bandvertnbr = 0; queunum < queunnd; queunum ++) {
+    if ((pfixtax == NULL) || (pfixtax[queutab[queunum]] == -1)) /* If frontier vertex is not fixed */
+      bandvertnbr ++;
+  }
+  thrdptr->queunnd[0] = queunnd - queubas;
+  thrdptr->bandnnd[0] = bandvertnbr;
+  threadScan (descptr, (void *) thrdptr, sizeof (GraphBandThread), (ThreadScanFunc) graphBandScan, NULL); /* Also acts as barrier for flag arrays */
+
+  bandvertnum = grafptr->baseval + thrdptr->bandnnd[0] - bandvertnbr;
+  bandedgenbr =
+  bandvfixnbr = 0;
+  for (queunum = queubas; queunum < queunnd; queunum ++) {
+    Gnum              vertnum;
+
+    vertnum = queutab[queunum];
+    if ((pfixtax != NULL) && (pfixtax[vertnum] != -1)) { /* It is a fixed vertex */
+      vnumtax[vertnum] = -2;                      /* Set vertex as fixed         */
+      bandvfixnbr ++;
+    }
+    else
+      vnumtax[vertnum] = bandvertnum ++;          /* Keep frontier vertex in band */
+    bandedgenbr += vendtax[vertnum] - verttax[vertnum]; /* Account for its edges  */
+  }
+  bandvertbas = grafptr->baseval + dataptr->thrdtab[thrdlst].bandnnd[0];
+  queuheadidx = 0;                                /* No queued vertex read yet                  */
+  queutailidx = dataptr->queunbr;                 /* All frontier vertices are already in queue */
+
+  for (distval = 0; ++ distval <= dataptr->distmax; ) {
+    if (thrdnum == 0)
+      dataptr->bandvertlvlnum = bandvertbas;      /* Save start index of current level, based */
+    if (queuheadidx >= queutailidx)               /* If no vertices left to expand, band is complete */
+      break;
+
+    queubas = queuheadidx + DATASCAN (queutailidx - queuheadidx, thrdnbr, thrdnum); /* Compute bounds of level sub-array */
+    queunnd = queuheadidx + DATASCAN (queutailidx - queuheadidx, thrdnbr, thrdnum + 1);
+    for (queunum = queubas; queunum < queunnd; queunum ++) /* Record queue indices of vertices of current level */
+      qpostax[queutab[queunum]] = queunum;
+
+    threadBarrier (descptr);                      /* Numbering of previous level and queue indices are known */
+
+    for (queunum = queubas; queunum < queunnd; queunum ++) { /* Claim vertices of next level */
+      GraphCursor       cursdat;
+
+      for (graphCursorInit (&cursdat, grafptr, queutab[queunum]); graphCursorNext (&cursdat); ) {
+        GraphCursor       cenddat;
+        Gnum              vertend;
+        Gnum              qposmin;
+
+        vertend = cursdat.vertend;
+        if ((vnumtax[vertend] != ~0) ||           /* If end vertex already in band           */
+            (__sync_lock_test_and_set (&locktax[vertend], 1) != 0)) /* Or already claimed */
+          continue;
+
+        qposmin = queunum;                        /* Find lowest queue index of its neighbors in current level */
+        for (graphCursorInit (&cenddat, grafptr, vertend); graphCursorNext (&cenddat); ) {
+          Gnum              vertngb;
+
+          vertngb = cenddat.vertend;
+          if ((vnumtax[vertngb] != ~0) &&         /* Only vertices of current level can be in band */
+              (qpostax[vertngb] < qposmin))
+            qposmin = qpostax[vertngb];
+        }
+        qpostax[vertend] = qposmin;               /* Record discoverer of end vertex */
+      }
+    }
+
+    threadBarrier (descptr);                      /* Discoverers of all vertices of next level are known */
+
+    for (queunum = queubas, queunbr = bandvertnbr = 0; queunum < queunnd; queunum ++) { /* Count vertices discovered by thread */
+      GraphCursor       cursdat;
+
+      for (graphCursorInit (&cursdat, grafptr, queutab[queunum]); graphCursorNext (&cursdat); ) {
+        Gnum              vertend;
+
+        vertend = cursdat.vertend;
+        if ((qpostax[vertend] == queunum) &&      /* If vertex discovered by current vertex */
+            (vnumtax[vertend] == ~0)      &&
+            (locktax[vertend] != 0)) {            /* And not already counted through a multiple arc */
+          locktax[vertend] = 0;
+          queunbr ++;
+          if ((pfixtax == NULL) || (pfixtax[vertend] == -1))
+            bandvertnbr ++;
+        }
+      }
+    }
+    thrdptr->queunnd[0] = queunbr;
+    thrdptr->bandnnd[0] = bandvertnbr;
+    threadScan (descptr, (void *) thrdptr, sizeof (GraphBandThread), (ThreadScanFunc) graphBandScan, NULL);
+
+    queuidx     = queutailidx + thrdptr->queunnd[0] - queunbr; /* Get start indices of thread sub-arrays */
+    bandvertnum = bandvertbas + thrdptr->bandnnd[0] - bandvertnbr;
+    for (queunum = queubas; queunum < queunnd; queunum ++) { /* Enqueue vertices in sequential order */
+      GraphCursor       cursdat;
+
+      for (graphCursorInit (&cursdat, grafptr, queutab[queunum]); graphCursorNext (&cursdat); ) {
+        Gnum              vertend;
+
+        vertend = cursdat.vertend;
+        if ((qpostax[vertend] != queunum) ||      /* If vertex not discovered by current vertex */
+            (vnumtax[vertend] != ~0))             /* Or already enqueued through a multiple arc */
+          continue;
+
+        if ((pfixtax != NULL) && (pfixtax[vertend] != -1)) { /* If fixed vertex */
+          vnumtax[vertend] = -2;                  /* Set vertex as fixed        */
+          bandvfixnbr ++;
+        }
+        else
+          vnumtax[vertend] = bandvertnum ++;      /* Enqueue vertex label */
+
+        bandedgenbr += vendtax[vertend] - verttax[vertend]; /* Account for its edges */
+        queutab[queuidx ++] = vertend;            /* Enqueue vertex for next pass    */
+      }
+    }
+
+    queuheadidx  = queutailidx;                   /* Prepare queue for next sweep */
+    queutailidx += dataptr->thrdtab[thrdlst].queunnd[0];
+    bandvertbas += dataptr->thrdtab[thrdlst].bandnnd[0];
+
+    threadBarrier (descptr);                      /* Scan results no longer needed and numbering complete */
+  }
+
+  thrdptr->bandedgenbr = bandedgenbr;
+  thrdptr->bandvfixnbr = bandvfixnbr;
+  if (thrdnum == 0)
+    dataptr->bandvertnnd = bandvertbas;
+}
+#endif /* GRAPHBANDNOTHREAD */
+
 /* This routine computes an index array
 ** of given width around the current separator.
+** When enough threads and frontier vertices
+** are available, the band is grown by all the
+** threads of the given context, yielding the
+** same numbering as the sequential version.
 ** It returns:
 ** - 0   : if the index array could be computed.
 ** - !0  : on error.
@@ -81,7 +299,8 @@ Gnum * restrict const             bandvertlvlptr, /*+ Pointer to based start ind
 Gnum * restrict const             bandvertptr,    /*+ Pointer to bandvertnbr                                   +*/
 Gnum * restrict const             bandedgeptr,    /*+ Pointer to bandedgenbr                                   +*/
 const Gnum * restrict const       pfixtax,        /*+ Fixed partition array                                    +*/
-Gnum * restrict const             bandvfixptr)    /*+ Pointer to bandvfixnbr                                   +*/
+Gnum * restrict const             bandvfixptr,    /*+ Pointer to bandvfixnbr                                   +*/
+Context * restrict const          contptr)        /*+ Execution context                                        +*/
 {
   Gnum                    queunum;
   Gnum * restrict         vnumtax;                /* Index array for vertices kept in band graph */
@@ -95,13 +314,58 @@ Gnum * restrict const             bandvfixptr)    /*+ Pointer to bandvfixnbr
 
   const Gnum * restrict const verttax = grafptr->verttax;
   const Gnum * restrict const vendtax = grafptr->vendtax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
 
   if ((vnumtax = memAlloc (grafptr->vertnbr * sizeof (Gnum))) == NULL) {
     errorPrint ("graphBand: out of memory (1)");
     return     (1);
   }
 
+#ifndef GRAPHBANDNOTHREAD
+  if ((queunbr >= GRAPHBANDTHRDMIN) &&            /* If band worth being grown by several threads */
+      (contextThreadNbr (contptr) > 1)) {
+    GraphBandData       datadat;
+    int                 thrdnbr;
+    int                 thrdnum;
+
+    thrdnbr = contextThreadNbr (contptr);
+    if (memAllocGroup ((void **) (void *)
+                       &datadat.thrdtab, (size_t) (thrdnbr          * sizeof (GraphBandThread)),
+                       &datadat.qpostax, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                       &datadat.locktax, (size_t) (grafptr->vertnbr * sizeof (int)), NULL) == NULL) {
+      errorPrint ("graphBand: out of memory (2)");
+      memFree    (vnumtax);
+      return     (1);
+    }
+    datadat.grafptr = grafptr;
+    datadat.pfixtax = pfixtax;
+    datadat.queutab = queutab;
+    datadat.queunbr = queunbr;
+    datadat.distmax = distmax;
+    datadat.vnumtax = vnumtax - grafptr->baseval;
+    datadat.qpostax -= grafptr->baseval;
+    datadat.locktax -= grafptr->baseval;
+    datadat.bandvertlvlnum = grafptr->baseval;
+
+    contextThreadLaunch (contptr, (ThreadFunc) graphBand2, (void *) &datadat);
+
+    for (thrdnum = 0, bandedgenbr = bandvfixnbr = 0; thrdnum < thrdnbr; thrdnum ++) {
+      bandedgenbr += datadat.thrdtab[thrdnum].bandedgenbr;
+      bandvfixnbr += datadat.thrdtab[thrdnum].bandvfixnbr;
+    }
+    *bandvertlvlptr = datadat.bandvertlvlnum;
+    bandvertnum     = datadat.bandvertnnd;
+
+    memFree (datadat.thrdtab);                    /* Free group leader */
+
+    *vnumptr     = vnumtax - grafptr->baseval;
+    *bandvfixptr = bandvfixnbr;
+    *bandvertptr = bandvertnum - grafptr->baseval;
+    *bandedgeptr = bandedgenbr;
+
+    return (0);
+  }
+#endif /* GRAPHBANDNOTHREAD */
+
   bandvertlvlnum =                                /* Start index of last level is start index */
   bandvertnum    = grafptr->baseval;              /* Reset number of band vertices            */
   bandedgenbr    =
@@ -132,13 +396,13 @@ Gnum * restrict const             bandvfixptr)    /*+ Pointer to bandvfixnbr
 
     for (queunextidx = queutailidx; queuheadidx < queutailidx; ) { /* For all vertices in queue */
       Gnum              vertnum;
-      Gnum              edgenum;
+      GraphCursor       cursdat;                  /* Cursor on neighbors of vertex */
 
       vertnum = queutab[queuheadidx ++];          /* Dequeue vertex */
-      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); ) {
         Gnum              vertend;
 
-        vertend = edgetax[edgenum];
+        vertend = cursdat.vertend;
         if (vnumtax[vertend] != ~0)               /* If end vertex has already been processed */
           continue;                               /* Skip to next vertex                      */
 
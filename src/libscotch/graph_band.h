@@ -0,0 +1,88 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_band.h                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the band graph vertex numbering     **/
+/**                routine.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined GRAPHBANDNOTHREAD)
+#define GRAPHBANDNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined GRAPHBANDNOTHREAD) */
+
+/*+ Minimum number of frontier vertices
+    for the band to be grown by several
+    threads.                             +*/
+
+#define GRAPHBANDTHRDMIN            1024
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphBandThread_ {
+  Gnum                      queunnd[2];           /*+ After-last queue index of level sub-array; [2] for scan  +*/
+  Gnum                      bandnnd[2];           /*+ After-last band vertex number of sub-array; [2] for scan +*/
+  Gnum                      bandedgenbr;          /*+ Sum of degrees of vertices enqueued by thread            +*/
+  Gnum                      bandvfixnbr;          /*+ Number of fixed vertices enqueued by thread              +*/
+} GraphBandThread;
+
+/*+ The thread-independent data block. +*/
+
+typedef struct GraphBandData_ {
+  const Graph *             grafptr;              /*+ Graph to work on                               +*/
+  const Gnum *              pfixtax;              /*+ Fixed partition array, if any                  +*/
+  Gnum *                    queutab;              /*+ Queue array                                    +*/
+  Gnum                      queunbr;              /*+ Number of frontier vertices                    +*/
+  Gnum                      distmax;              /*+ Maximum distance from frontier vertices        +*/
+  Gnum *                    vnumtax;              /*+ Band vertex number array                       +*/
+  Gnum *                    qpostax;              /*+ Queue index of vertex, or of its discoverer    +*/
+  volatile int *            locktax;              /*+ Flag array for claiming vertices of next level +*/
+  Gnum                      bandvertlvlnum;       /*+ Based start number of vertices of last level   +*/
+  Gnum                      bandvertnnd;          /*+ Based after-last band vertex number            +*/
+  GraphBandThread *         thrdtab;              /*+ Array of thread-specific data                  +*/
+} GraphBandData;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2012,2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2012,2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 27 jun 2011     **/
 /**                                 to   : 23 feb 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,14 +92,13 @@ const Graph * const         grafptr)
   Gnum                velosum;                    /* Sum of vertex loads      */
   Gnum                edlosum;                    /* Sum of edge loads        */
   Gnum                edgenbr;                    /* Number of edges (arcs)   */
-  Gnum                edgenum;                    /* Number of current edge   */
+  GraphCursor         cursdat;                    /* Cursor on current edge   */
   Gnum                degrmax;                    /* Maximum degree           */
 
   const Gnum                  baseval = grafptr->baseval; /* Fast accesses */
   const Gnum * restrict const verttax = grafptr->verttax;
   const Gnum * restrict const vendtax = grafptr->vendtax;
   const Gnum * restrict const velotax = grafptr->velotax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
   const Gnum * restrict const edlotax = grafptr->edlotax;
 
   if ((grafptr->vertnbr < 0) ||
@@ -112,6 +111,20 @@ const Graph * const         grafptr)
     errorPrint ("graphCheck: invalid edge numbers");
     return (1);
   }
+  if ((grafptr->flagval & GRAPHEDGEPACK) != 0) {  /* If edge array is packed */
+    if ((grafptr->edgetax != NULL) ||
+        (grafptr->packptr == NULL)) {
+      errorPrint ("graphCheck: invalid packed edge array");
+      return (1);
+    }
+    for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+      if ((grafptr->packptr->bytetax[vertnum] < 0) ||
+          (grafptr->packptr->bytetax[vertnum] > grafptr->packptr->bytenbr)) {
+        errorPrint ("graphCheck: invalid packed edge index array");
+        return (1);
+      }
+    }
+  }
 
   degrmax =
   edgenbr = 0;
@@ -131,11 +144,13 @@ const Graph * const         grafptr)
       degrmax = degrval;
     edgenbr += degrval;
 
-    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
-      Gnum                vertend;                /* Number of end vertex      */
-      Gnum                edgeend;                /* Number of end vertex edge */
+    for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); ) {
+      GraphCursor         cursend;                /* Cursor on edges of end vertex */
+      Gnum                vertend;                /* Number of end vertex          */
+      Gnum                edgenum;                /* Number of current edge        */
 
-      vertend = edgetax[edgenum];
+      vertend = cursdat.vertend;
+      edgenum = cursdat.edgenum;
       if (edlotax != NULL) {
         Gnum                edlotmp;
 
@@ -155,18 +170,15 @@ const Graph * const         grafptr)
         errorPrint ("graphCheck: loops not allowed");
         return (1);
       }
-      for (edgeend = verttax[vertend];            /* Search for matching arc */
-           (edgeend < vendtax[vertend]) && (edgetax[edgeend] != vertnum);
-           edgeend ++) ;
-      if ((edgeend >= vendtax[vertend]) ||
-          ((edlotax != NULL) && (edlotax[edgenum] != edlotax[edgeend]))) {
+      for (graphCursorInit (&cursend, grafptr, vertend); /* Search for matching arc */
+           graphCursorNext (&cursend) && (cursend.vertend != vertnum); ) ;
+      if ((cursend.edgenum >= vendtax[vertend]) ||
+          ((edlotax != NULL) && (edlotax[edgenum] != edlotax[cursend.edgenum]))) {
         errorPrint ("graphCheck: arc data do not match");
         return (1);
       }
-      for (edgeend ++;                            /* Search for duplicate arcs */
-           (edgeend < vendtax[vertend]) && (edgetax[edgeend] != vertnum);
-           edgeend ++) ;
-      if (edgeend < vendtax[vertend]) {
+      while (graphCursorNext (&cursend) && (cursend.vertend != vertnum)) ; /* Search for duplicate arcs */
+      if (cursend.edgenum < vendtax[vertend]) {
         errorPrint ("graphCheck: duplicate arc");
         return (1);
       }
@@ -1,4 +1,4 @@
-/* Copyright 2016,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2016,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 22 feb 2016     **/
 /**                                 to   : 22 feb 2018     **/
 /**                # Version 7.0  : from : 04 aug 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -168,7 +168,18 @@ Graph * restrict const          clngrafptr)
   clngrafptr->edgenbr = orggrafptr->edgenbr;
 
   clngrafptr->edgetax = datatab - baseval;        /* Manage edgetab */
-  memCpy (datatab, orggrafptr->edgetax + baseval, edgesiz * sizeof (Gnum));
+  if ((orggrafptr->flagval & GRAPHEDGEPACK) != 0) { /* If edge array is packed, clone it as a plain array */
+    Gnum                vertnum;
+
+    for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+      GraphCursor         cursdat;
+
+      for (graphCursorInit (&cursdat, orggrafptr, vertnum); graphCursorNext (&cursdat); )
+        clngrafptr->edgetax[cursdat.edgenum] = cursdat.vertend;
+    }
+  }
+  else
+    memCpy (datatab, orggrafptr->edgetax + baseval, edgesiz * sizeof (Gnum));
 
   if (orggrafptr->edlotax != NULL) {              /* Manage edlotab */
     datatab += edgesiz;
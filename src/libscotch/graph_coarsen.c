@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 29 apr 2019     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,13 +92,6 @@
 #include "graph_coarsen_edge.c"
 #undef GRAPHCOARSENEDGENAME
 
-#ifndef GRAPHCOARSENNOTHREAD                      /* Only relevant when threads are enabled */
-#define GRAPHCOARSENEDGENAME        graphCoarsenEdgeCt
-#define GRAPHCOARSENEDGECOUNT                     /* Local coarse edge count routine */
-#include "graph_coarsen_edge.c"
-#undef GRAPHCOARSENEDGENAME
-#undef GRAPHCOARSENEDGECOUNT
-#endif /* GRAPHCOARSENNOTHREAD */
 
 /***************************/
 /*                         */
@@ -121,7 +114,7 @@ GraphCoarsenThread * restrict const tlocptr,      /* Pointer to local thread blo
 GraphCoarsenThread * restrict const tremptr,      /* Pointer to remote thread block */
 const void * const                  globptr)      /* Unused                         */
 {
-  tlocptr->coaredgebas += tremptr->coaredgebas;   /* Sum number of local edges     */
+  tlocptr->coaredgenbr += tremptr->coaredgenbr;   /* Sum number of local edges     */
   tlocptr->coaredloadj += tremptr->coaredloadj;   /* Sum edge load sum adjustments */
   if (tremptr->coardegrmax > tlocptr->coardegrmax) /* Take maximum of degrees      */
     tlocptr->coardegrmax = tremptr->coardegrmax;
@@ -143,6 +136,88 @@ const void * const          globptr)              /* Unused                  */
 {
   tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
 }
+
+/* This routine compacts the edge sub-arrays
+** which have been built by all threads at
+** upper-bound positions in the coarse edge
+** array. Each thread copies its sub-array
+** into a new, exactly sized, edge array. If
+** this array cannot be allocated, thread 0
+** compacts all sub-arrays in place.
+** It returns:
+** - void: in all cases.
+*/
+
+static
+void
+graphCoarsenPack (
+ThreadDescriptor * restrict const descptr,
+GraphCoarsenData * restrict const coarptr)
+{
+  Gnum                coaredgenbr;                /* Global number of coarse edges         */
+  Gnum                coaredgenew;                /* Start of local edges in compact array */
+  Gnum                coaredgedlt;                /* Shift of local coarse edge indices    */
+  Gnum                coarvertnum;
+  Gnum                coarvertnnd;
+
+  const int                           thrdnbr     = threadNbr (descptr);
+  const int                           thrdnum     = threadNum (descptr);
+  GraphCoarsenThread * restrict const thrdtab     = coarptr->thrdtab;
+  Graph * const                       coargrafptr = coarptr->coargrafptr;
+  Gnum * restrict const               coarverttax = coargrafptr->verttax;
+  const Gnum                          baseval     = coargrafptr->baseval;
+
+  coaredgenbr = thrdtab[0].coaredgenbr;           /* Reduced global number of edges known to all threads after reduction barrier */
+  if (thrdnum == 0) {
+    if ((coarptr->coaredgetab = memAlloc (coaredgenbr * 2 * sizeof (Gnum))) == NULL) { /* "* 2" for edlotab */
+      Gnum                coaredgetmp;
+      int                 thrdtmp;
+
+      for (thrdtmp = 1, coaredgetmp = thrdtab[0].scantab[0] + baseval; /* Compact sub-arrays in place, in ascending order */
+           thrdtmp < thrdnbr; thrdtmp ++) {
+        Gnum                coaredgesiz;          /* Number of local edges of given thread */
+
+        coaredgesiz = thrdtab[thrdtmp].scantab[0] - thrdtab[thrdtmp - 1].scantab[0];
+        coaredgedlt = coaredgetmp - thrdtab[thrdtmp].coaredgebas;
+        memMov (coargrafptr->edgetax + coaredgetmp, coargrafptr->edgetax + thrdtab[thrdtmp].coaredgebas, coaredgesiz * sizeof (Gnum));
+        memMov (coargrafptr->edlotax + coaredgetmp, coargrafptr->edlotax + thrdtab[thrdtmp].coaredgebas, coaredgesiz * sizeof (Gnum));
+        for (coarvertnum = thrdtab[thrdtmp].coarvertbas, coarvertnnd = thrdtab[thrdtmp].coarvertnnd;
+             coarvertnum < coarvertnnd; coarvertnum ++)
+          coarverttax[coarvertnum] += coaredgedlt;
+        coaredgetmp += coaredgesiz;
+      }
+    }
+  }
+
+  threadBarrier (descptr);                        /* Make new edge array known to all threads */
+
+  if (coarptr->coaredgetab != NULL) {             /* If new edge array allocated */
+    Gnum                coaredgesiz;              /* Number of local edges       */
+    Gnum * restrict     coaredgetax;
+    Gnum * restrict     coaredlotax;
+
+    coaredgetax = coarptr->coaredgetab - baseval;
+    coaredlotax = coaredgetax + coaredgenbr;
+    coaredgenew = (thrdnum > 0) ? thrdtab[thrdnum - 1].scantab[0] : 0;
+    coaredgesiz = thrdtab[thrdnum].scantab[0] - coaredgenew;
+    coaredgenew += baseval;
+    coaredgedlt  = coaredgenew - thrdtab[thrdnum].coaredgebas;
+
+    memCpy (coaredgetax + coaredgenew, coargrafptr->edgetax + thrdtab[thrdnum].coaredgebas, coaredgesiz * sizeof (Gnum));
+    memCpy (coaredlotax + coaredgenew, coargrafptr->edlotax + thrdtab[thrdnum].coaredgebas, coaredgesiz * sizeof (Gnum));
+    for (coarvertnum = thrdtab[thrdnum].coarvertbas, coarvertnnd = thrdtab[thrdnum].coarvertnnd;
+         coarvertnum < coarvertnnd; coarvertnum ++)
+      coarverttax[coarvertnum] += coaredgedlt;
+
+    threadBarrier (descptr);                      /* Old edge array no longer accessed */
+
+    if (thrdnum == 0) {
+      memFree (coargrafptr->edgetax + baseval);   /* Free upper-bound edge array; edlotab is part of it */
+      coargrafptr->edgetax = coaredgetax;
+      coargrafptr->edlotax = coaredlotax;
+    }
+  }
+}
 #endif /* GRAPHCOARSENNOTHREAD */
 
 /* This routine is the threaded core of the building
@@ -386,7 +461,7 @@ GraphCoarsenData * restrict const coarptr)
     if (coarptr->retuval != 0)                    /* After barrier, in case memory allocation failed */
       return;
 
-    if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) { /* If willing to have faster a non-compact graph */
+    {                                             /* Compute upper bound on number of local coarse edges */
       Gnum                coarvertnnd;
       Gnum                coarvertnum;
       Gnum                coaredgenbr;
@@ -408,11 +483,6 @@ GraphCoarsenData * restrict const coarptr)
       }
       thrdptr->coaredgebas = coaredgenbr;         /* Save upper bound on local number of coarse edges for scan */
     }
-    else {
-      thrdptr->coaredgebas = 0;                   /* No coarse edges accounted for yet                                */
-      graphCoarsenEdgeCt (coarptr, thrdptr);      /* Count number of coarse local edges in thrdptr->coaredgebas       */
-      memSet (thrdptr->coarhashtab, ~0, coarhashnbr * sizeof (GraphCoarsenHash)); /* Re-initialize (local) hash table */
-    }
     thrdptr->scantab[0] = thrdptr->coaredgebas;
     threadScan (descptr, &thrdptr->scantab[0], sizeof (GraphCoarsenThread), (ThreadScanFunc) graphCoarsenScan, NULL); /* Compute scan on coarse edge indices */
 #ifdef SCOTCH_DEBUG_GRAPH2
@@ -420,8 +490,7 @@ GraphCoarsenData * restrict const coarptr)
       errorPrint ("graphCoarsen3: internal error (3)");
       return;
     }
-    if (((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) &&
-	(thrdnum == (thrdnbr - 1)) &&
+    if ((thrdnum == (thrdnbr - 1)) &&
         (thrdptr->scantab[0] != finegrafptr->edgenbr)) {
       errorPrint ("graphCoarsen3: internal error (4)");
       return;
@@ -445,31 +514,43 @@ GraphCoarsenData * restrict const coarptr)
 
   memFree (thrdptr->coarhashtab);                 /* Free local hash table */
 
-  thrdptr->coaredgebas -= coaredgebas;            /* Compute accurate number of local edges */
+  thrdptr->coaredgenbr = thrdptr->coaredgebas - coaredgebas; /* Compute accurate number of local edges */
+  thrdptr->coaredgebas = coaredgebas;             /* Restore start of local edge sub-array      */
 
 #ifndef GRAPHCOARSENNOTHREAD
-  if (thrdnbr > 1)
-    threadReduce (descptr, thrdptr, sizeof (GraphCoarsenThread), (ThreadReduceFunc) graphCoarsenReduce, 0, NULL); /* Sum edloadj and get maximum of degrmax */
+  if (thrdnbr > 1) {
+    if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) == 0) { /* If graph is to be compacted */
+      thrdptr->scantab[0] = thrdptr->coaredgenbr;
+      threadScan (descptr, &thrdptr->scantab[0], sizeof (GraphCoarsenThread), (ThreadScanFunc) graphCoarsenScan, NULL); /* Compute end indices of local edges in compact array */
+    }
+
+    threadReduce (descptr, thrdptr, sizeof (GraphCoarsenThread), (ThreadReduceFunc) graphCoarsenReduce, 0, NULL); /* Sum edgenbr and edloadj, and get maximum of degrmax */
+
+    if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) == 0) /* If graph is to be compacted */
+      graphCoarsenPack (descptr, coarptr);        /* Move local edges to their final place   */
+  }
 
   if (thrdnum == 0)
 #endif /* GRAPHCOARSENNOTHREAD */
   {
-    coargrafptr->edgenbr = thrdptr->coaredgebas;
+    coargrafptr->edgenbr = thrdptr->coaredgenbr;
     coargrafptr->edlosum = thrdptr->coaredloadj + finegrafptr->edlosum;
     coargrafptr->degrmax = thrdptr->coardegrmax;
 #ifndef GRAPHCOARSENNOTHREAD
     if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) == 0) /* If graph is compact */
 #endif /* GRAPHCOARSENNOTHREAD */
     {
-      size_t              coaredlooft;
-      byte *              coaredgetab;
-
       coargrafptr->verttax[coargrafptr->vertnnd] = coargrafptr->edgenbr + finegrafptr->baseval; /* Mark end of edge array */
 
-      coaredlooft = (byte *) coargrafptr->edlotax - (byte *) coargrafptr->edgetax;
-      coaredgetab = memRealloc (coargrafptr->edgetax + baseval, coaredlooft + (coargrafptr->edgenbr * sizeof (Gnum)));
-      coargrafptr->edgetax = (Gnum *) coaredgetab - baseval;
-      coargrafptr->edlotax = (Gnum *) (coaredgetab + coaredlooft) - baseval;
+      if (coarptr->coaredgetab == NULL) {         /* If edge array not already reallocated by threads */
+        size_t              coaredlooft;
+        byte *              coaredgetab;
+
+        coaredlooft = (byte *) coargrafptr->edlotax - (byte *) coargrafptr->edgetax;
+        coaredgetab = memRealloc (coargrafptr->edgetax + baseval, coaredlooft + (coargrafptr->edgenbr * sizeof (Gnum)));
+        coargrafptr->edgetax = (Gnum *) coaredgetab - baseval;
+        coargrafptr->edlotax = (Gnum *) (coaredgetab + coaredlooft) - baseval;
+      }
     }
   }
 
@@ -523,6 +604,7 @@ GraphCoarsenData * restrict const     coarptr)
 #endif /* GRAPHCOARSENNOTHREAD */
     coarptr->flagval &= ~GRAPHCOARSENNOCOMPACT;   /* Non-compact graphs always imply more than one thread */
 
+  coarptr->fineclustax = NULL;                    /* Assume no clustering arrays              */
   if ((coarptr->flagval & GRAPHCOARSENUSEMATE) == 0) { /* If mating array not provided          */
     if (graphMatchInit (coarptr, thrdnbr) != 0)   /* Initialize global data needed for matching */
       return (2);
@@ -533,15 +615,20 @@ GraphCoarsenData * restrict const     coarptr)
 
   if ((coarptr->thrdtab = memAlloc (thrdnbr * sizeof (GraphCoarsenThread))) == NULL) {
     errorPrint ("graphCoarsen2: out of memory (2)");
+    if (coarptr->fineclustax != NULL)
+      memFree (coarptr->fineclustax + baseval);
     if (finematetab != NULL)
       memFree (finematetab);
     return (2);
   }
-  coarptr->retuval = 0;                           /* Assume no error */
+  coarptr->coaredgetab = NULL;                    /* No compact edge array built by threads yet */
+  coarptr->retuval     = 0;                       /* Assume no error                            */
 
   contextThreadLaunch (coarptr->contptr, (ThreadFunc) graphCoarsen3, (void *) coarptr);
 
   memFree (coarptr->thrdtab);
+  if (coarptr->fineclustax != NULL)               /* If clustering arrays allocated, free them */
+    memFree (coarptr->fineclustax + baseval);
 
   if ((coarptr->flagval & GRAPHCOARSENDSTMATE) == 0) /* If mating array destination not provided */
     memFree (finematetab);                        /* Do not keep mating data array               */
@@ -588,7 +675,7 @@ const Gnum                                    flagval,
 const Anum * restrict const                   fineparotax,
 const Anum * restrict const                   finepfixtax,
 const Gnum                                    finevfixnbr,
-Context * restrict const                      contptr) /*+ Execution context                                     +*/
+Context * restrict const                      contptr) /*+ Execution context +*/
 {
   GraphCoarsenData    coardat;                    /* Graph coarsening global data */
   int                 o;
@@ -649,7 +736,7 @@ const Gnum                        flagval,        /*+ Flag value
 const Anum * restrict const       fineparotax,
 const Anum * restrict const       finepfixtax,
 const Gnum                        finevfixnbr,
-Context * restrict const          contptr)        /*+ Execution context                         +*/
+Context * restrict const          contptr)        /*+ Execution context +*/
 {
   GraphCoarsenData    coardat;                    /* Graph coarsening global data */
   int                 o;
@@ -723,3 +810,565 @@ Context * restrict const                      contptr) /*+ Execution context
 
   return (0);
 }
+
+/**********************************/
+/*                                */
+/* The coarsening cache routines. */
+/*                                */
+/**********************************/
+
+/* This routine frees the cached levels of
+** the given cache, starting from the given
+** level number.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphCoarsenCacheFree (
+GraphCoarsenCache * const   cachptr,
+const INT                   levlnum)
+{
+  while (cachptr->levlnbr > levlnum)
+    graphExit (&cachptr->levltab[-- cachptr->levlnbr].grafdat);
+}
+
+/* This routine computes a checksum of the
+** topology and edge loads of the given graph,
+** so that a graph rebuilt with other arrays
+** at the same addresses is not mistaken for
+** the graph of the cache.
+** It returns:
+** - the checksum, in all cases.
+*/
+
+static
+Gunum
+graphCoarsenCacheSum (
+const Graph * restrict const  grafptr)
+{
+  Gnum                vertnum;
+  Gunum               chekval;
+
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+
+  for (vertnum = grafptr->baseval, chekval = (Gunum) grafptr->vertnbr; vertnum < grafptr->vertnnd; vertnum ++) {
+    GraphCursor         cursdat;
+
+    chekval = (chekval * 31) + (Gunum) vertnum;   /* Account for vertex boundaries */
+    for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); )
+      chekval = (chekval * 31) + (Gunum) cursdat.vertend + ((edlotax != NULL) ? ((Gunum) edlotax[cursdat.edgenum] << 16) : 0);
+  }
+
+  return (chekval);
+}
+
+/* This routine frees the given cache.
+** It is called by the context owning
+** the cache.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphCoarsenCacheExit2 (
+ContextCache * const        contcptr)
+{
+  GraphCoarsenCache * const cachptr = (GraphCoarsenCache *) contcptr; /* TRICK: context cache header is first field */
+
+  graphCoarsenCacheFree (cachptr, 0);
+  memFree (cachptr->levltab);
+  memFree (cachptr);
+}
+
+/* This routine enables the caching of
+** coarsening hierarchies in the given
+** context. If the context already has a
+** cache, cached levels are discarded.
+** It returns:
+** - 0   : if the cache is available.
+** - !0  : on error.
+*/
+
+int
+graphCoarsenCacheInit (
+Context * const             contptr)
+{
+  GraphCoarsenCache * restrict  cachptr;
+
+  if (contptr->cachptr != NULL) {                 /* If context already has cached data */
+    if (contptr->cachptr->exitfunc != graphCoarsenCacheExit2) {
+      errorPrint ("graphCoarsenCacheInit: context already holds cached data");
+      return (1);
+    }
+    cachptr = (GraphCoarsenCache *) contptr->cachptr;
+    graphCoarsenCacheFree (cachptr, 0);           /* Discard cached levels */
+  }
+  else {
+    if ((cachptr = memAlloc (sizeof (GraphCoarsenCache))) == NULL) {
+      errorPrint ("graphCoarsenCacheInit: out of memory (1)");
+      return (1);
+    }
+    cachptr->levlmax = 16;                        /* Enough for most hierarchies */
+    if ((cachptr->levltab = memAlloc (cachptr->levlmax * sizeof (GraphCoarsenLevel))) == NULL) {
+      errorPrint ("graphCoarsenCacheInit: out of memory (2)");
+      memFree    (cachptr);
+      return     (1);
+    }
+    cachptr->cachdat.exitfunc = graphCoarsenCacheExit2;
+    cachptr->levlnbr          = 0;
+    cachptr->deptnbr          = 0;
+    contptr->cachptr          = &cachptr->cachdat;
+  }
+  cachptr->verttax = NULL;                        /* No finest graph recorded yet */
+  cachptr->vendtax = NULL;
+  cachptr->edgetax = NULL;
+  cachptr->packptr = NULL;
+  cachptr->edlotax = NULL;
+  cachptr->vertnbr = -1;
+
+  return (0);
+}
+
+/* This routine disables the caching of
+** coarsening hierarchies in the given
+** context, and frees the cached data.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphCoarsenCacheExit (
+Context * const             contptr)
+{
+  if (contptr->cachptr == NULL)                   /* If no cached data */
+    return;
+
+  contptr->cachptr->exitfunc (contptr->cachptr);
+  contptr->cachptr = NULL;
+}
+
+/* These routines record the beginning and the
+** end of a multilevel method call using the
+** cache of the given context, if any. As the
+** coarse graphs given back by the cache are
+** shared by all the callers of the method,
+** only the outermost call may use the cache;
+** calls nested within it, e.g. by way of
+** its coarsest or refinement strategies,
+** coarsen graphs without it, so that they
+** cannot discard levels still in use.
+** They return:
+** - void  : in all cases.
+*/
+
+void
+graphCoarsenCacheEnter (
+Context * const             contptr)
+{
+  if ((contptr->cachptr != NULL) &&
+      (contptr->cachptr->exitfunc == graphCoarsenCacheExit2))
+    ((GraphCoarsenCache *) contptr->cachptr)->deptnbr ++;
+}
+
+void
+graphCoarsenCacheLeave (
+Context * const             contptr)
+{
+  if ((contptr->cachptr != NULL) &&
+      (contptr->cachptr->exitfunc == graphCoarsenCacheExit2))
+    ((GraphCoarsenCache *) contptr->cachptr)->deptnbr --;
+}
+
+/* This routine coarsens the given "finegraph"
+** into "coargraph", like graphCoarsen(), but
+** takes advantage of the coarsening hierarchy
+** cache of the context, if any. Coarse graphs
+** built from the finest graph whose topology
+** matches that of the cache, by the outermost
+** multilevel call only, are kept in the
+** cache, and are given back with their vertex
+** loads updated on subsequent calls, as long
+** as their multinodes comply with the fixed
+** and old part arrays. The coarse graphs given
+** back do not own their arrays, which must
+** not be modified.
+** It returns:
+** - 0  : if the graph has been coarsened.
+** - 1  : if the graph could not be coarsened.
+** - 2  : on error.
+*/
+
+int
+graphCoarsenCache (
+const Graph * restrict const                  finegrafptr, /*+ Graph to coarsen                             +*/
+Graph * restrict const                        coargrafptr, /*+ Coarse graph to build                        +*/
+GraphCoarsenMulti * restrict * restrict const coarmultptr, /*+ Pointer to un-based multinode table to build +*/
+const Gnum                                    coarvertnbr, /*+ Minimum number of coarse vertices            +*/
+const double                                  coarval, /*+ Maximum contraction ratio                        +*/
+const Gnum                                    flagval,
+const Anum * restrict const                   fineparotax,
+const Anum * restrict const                   finepfixtax,
+const Gnum                                    finevfixnbr,
+const INT                                     levlnum, /*+ Coarsening level of fine graph                   +*/
+Context * restrict const                      contptr) /*+ Execution context                                +*/
+{
+  GraphCoarsenCache * restrict  cachptr;
+  GraphCoarsenLevel * restrict  levlptr;
+  int                           o;
+
+  cachptr = (GraphCoarsenCache *) contptr->cachptr;
+  if ((cachptr == NULL) ||                        /* If no cache in context        */
+      (cachptr->cachdat.exitfunc != graphCoarsenCacheExit2) || /* Or not a coarsening cache */
+      (cachptr->deptnbr != 1) ||                  /* Or if not outermost multilevel call */
+      (*coarmultptr != NULL))                     /* Or if multinode array provided      */
+    return (graphCoarsen (finegrafptr, coargrafptr, NULL, coarmultptr, coarvertnbr, coarval, flagval,
+                          fineparotax, finepfixtax, finevfixnbr, contptr));
+
+  if (levlnum == 0) {                             /* If finest graph, check it is that of the cache */
+    Gunum               chekval;
+
+    chekval = graphCoarsenCacheSum (finegrafptr);
+    if ((cachptr->verttax != finegrafptr->verttax) ||
+        (cachptr->vendtax != finegrafptr->vendtax) ||
+        (cachptr->edgetax != finegrafptr->edgetax) ||
+        (cachptr->packptr != finegrafptr->packptr) ||
+        (cachptr->edlotax != finegrafptr->edlotax) ||
+        (cachptr->baseval != finegrafptr->baseval) ||
+        (cachptr->vertnbr != finegrafptr->vertnbr) ||
+        (cachptr->edgenbr != finegrafptr->edgenbr) ||
+        (cachptr->coarnbr != coarvertnbr)          ||
+        (cachptr->coarval != coarval)              ||
+        (cachptr->flagval != flagval)              ||
+        (cachptr->chekval != chekval)) {          /* If not, cache is for another graph or method */
+      graphCoarsenCacheFree (cachptr, 0);         /* Restart from scratch                         */
+      cachptr->verttax = finegrafptr->verttax;
+      cachptr->vendtax = finegrafptr->vendtax;
+      cachptr->edgetax = finegrafptr->edgetax;
+      cachptr->packptr = finegrafptr->packptr;
+      cachptr->edlotax = finegrafptr->edlotax;
+      cachptr->baseval = finegrafptr->baseval;
+      cachptr->vertnbr = finegrafptr->vertnbr;
+      cachptr->edgenbr = finegrafptr->edgenbr;
+      cachptr->coarnbr = coarvertnbr;
+      cachptr->coarval = coarval;
+      cachptr->flagval = flagval;
+      cachptr->chekval = chekval;
+    }
+  }
+  else if ((levlnum > cachptr->levlnbr) ||        /* Else fine graph must be a cached coarse graph */
+           (cachptr->levltab[levlnum - 1].grafdat.verttax != finegrafptr->verttax))
+    return (graphCoarsen (finegrafptr, coargrafptr, NULL, coarmultptr, coarvertnbr, coarval, flagval,
+                          fineparotax, finepfixtax, finevfixnbr, contptr));
+
+  if (levlnum < cachptr->levlnbr) {               /* If coarse graph already cached */
+    const GraphCoarsenMulti * restrict  coarmulttax;
+    Gnum * restrict                     coarvelotax;
+    Gnum                                coarvertnum;
+    Gnum                                coarvertnnd;
+
+    const Gnum * restrict const finevelotax = finegrafptr->velotax;
+
+    levlptr     = &cachptr->levltab[levlnum];
+    coarmulttax = levlptr->multtab - finegrafptr->baseval;
+    coarvertnnd = levlptr->grafdat.vertnnd;
+
+    if ((fineparotax != NULL) || (finepfixtax != NULL)) { /* If mating constraints, check multinodes comply with them */
+      for (coarvertnum = finegrafptr->baseval; coarvertnum < coarvertnnd; coarvertnum ++) {
+        Gnum                finevertnum0;
+        Gnum                finevertnum1;
+
+        finevertnum0 = coarmulttax[coarvertnum].vertnum[0];
+        finevertnum1 = coarmulttax[coarvertnum].vertnum[1];
+        if (((finepfixtax != NULL) && (finepfixtax[finevertnum0] != finepfixtax[finevertnum1])) ||
+            ((fineparotax != NULL) && (fineparotax[finevertnum0] != fineparotax[finevertnum1])))
+          break;
+      }
+      if (coarvertnum < coarvertnnd)              /* If some multinode no longer complies   */
+        graphCoarsenCacheFree (cachptr, levlnum); /* Discard this level and all coarser ones */
+    }
+
+    if (levlnum < cachptr->levlnbr) {             /* If cached level can be re-used  */
+      coarvelotax = levlptr->grafdat.velotax;     /* Aggregate current vertex loads */
+      if (finevelotax != NULL) {
+        for (coarvertnum = finegrafptr->baseval; coarvertnum < coarvertnnd; coarvertnum ++) {
+          Gnum                finevertnum0;
+          Gnum                finevertnum1;
+
+          finevertnum0 = coarmulttax[coarvertnum].vertnum[0];
+          finevertnum1 = coarmulttax[coarvertnum].vertnum[1];
+          coarvelotax[coarvertnum] = finevelotax[finevertnum0] + ((finevertnum0 != finevertnum1) ? finevelotax[finevertnum1] : 0);
+        }
+      }
+      else {
+        for (coarvertnum = finegrafptr->baseval; coarvertnum < coarvertnnd; coarvertnum ++)
+          coarvelotax[coarvertnum] = (coarmulttax[coarvertnum].vertnum[0] != coarmulttax[coarvertnum].vertnum[1]) ? 2 : 1;
+      }
+      levlptr->grafdat.velosum = finegrafptr->velosum;
+
+      *coargrafptr          = levlptr->grafdat;   /* Give back coarse graph, without its arrays */
+      coargrafptr->flagval &= ~GRAPHFREETABS;
+      *coarmultptr          = levlptr->multtab;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+      if (graphCheck (coargrafptr) != 0) {
+        errorPrint ("graphCoarsenCache: inconsistent graph data");
+        return (2);
+      }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+      return (0);
+    }
+  }
+
+  o = graphCoarsen (finegrafptr, coargrafptr, NULL, coarmultptr, coarvertnbr, coarval, flagval,
+                    fineparotax, finepfixtax, finevfixnbr, contptr);
+  if (o != 0)
+    return (o);
+
+  if (cachptr->levlnbr >= cachptr->levlmax) {     /* If level array is full, resize it */
+    GraphCoarsenLevel * levltmp;
+
+    if ((levltmp = memRealloc (cachptr->levltab, cachptr->levlmax * 2 * sizeof (GraphCoarsenLevel))) == NULL)
+      return (0);                                 /* Not a problem: coarse graph is simply not cached */
+    cachptr->levltab  = levltmp;
+    cachptr->levlmax *= 2;
+  }
+
+  levlptr = &cachptr->levltab[cachptr->levlnbr ++]; /* Cache owns coarse graph arrays */
+  levlptr->grafdat      = *coargrafptr;
+  levlptr->multtab      = *coarmultptr;
+  coargrafptr->flagval &= ~GRAPHFREETABS;
+
+  return (0);
+}
+
+/****************************************/
+/*                                      */
+/* The coarse level spilling routines.  */
+/*                                      */
+/****************************************/
+
+/* This routine computes the sizes of the end
+** vertex and edge arrays of a coarse graph built
+** by graphCoarsen(). The edge array size is taken
+** up to the last used edge, which excludes the
+** upper-bound slack of non-compact graphs.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphCoarsenSpillSize2 (
+const Graph * restrict const  coargrafptr,
+Gnum * restrict const         vendsizptr,
+Gnum * restrict const         edgesizptr)
+{
+  Gnum                vertnum;
+  Gnum                edgennd;
+
+  const Gnum * restrict const vendtax = coargrafptr->vendtax;
+
+  if (vendtax == coargrafptr->verttax + 1) {      /* If graph is compact */
+    *vendsizptr = 1;                              /* End of last vertex is stored in vertex array */
+    *edgesizptr = vendtax[coargrafptr->vertnnd - 1] - coargrafptr->baseval;
+    return;
+  }
+
+  for (vertnum = coargrafptr->baseval, edgennd = coargrafptr->baseval;
+       vertnum < coargrafptr->vertnnd; vertnum ++) {
+    if (edgennd < vendtax[vertnum])
+      edgennd = vendtax[vertnum];
+  }
+  *vendsizptr = coargrafptr->vertnbr;
+  *edgesizptr = edgennd - coargrafptr->baseval;
+}
+
+/* This routine computes the number of bytes
+** held by the arrays of a coarse graph built
+** by graphCoarsen(), along with its embedded
+** multinode array and an optional private
+** vertex array.
+** It returns:
+** - the number of bytes, in all cases.
+*/
+
+size_t
+graphCoarsenSpillSize (
+const Graph * restrict const  coargrafptr,        /*+ Coarse graph                 +*/
+const Gnum * restrict const   coarvextax)         /*+ Private vertex array, if any +*/
+{
+  Gnum                vendsiz;
+  Gnum                edgesiz;
+
+  const Gnum          vertnbr = coargrafptr->vertnbr;
+
+  graphCoarsenSpillSize2 (coargrafptr, &vendsiz, &edgesiz);
+
+  return ((size_t) (vertnbr * 2 + vendsiz + edgesiz * 2 + ((coarvextax != NULL) ? vertnbr : 0)) * sizeof (Gnum) +
+          (size_t) vertnbr * sizeof (GraphCoarsenMulti));
+}
+
+/* This routine writes the arrays of a coarse
+** graph built by graphCoarsen(), its embedded
+** multinode array and an optional private vertex
+** array to an anonymous temporary file, and frees
+** them. The graph structure is kept, with its array
+** pointers set to NULL, such that it can still be
+** freed.
+** It returns:
+** - 0   : if the arrays have been spilled.
+** - !0  : on error; arrays are still resident.
+*/
+
+int
+graphCoarsenSpill (
+Graph * restrict const              coargrafptr,  /*+ Coarse graph to spill          +*/
+GraphCoarsenMulti * restrict const  coarmulttab,  /*+ Multinode array in graph group +*/
+Gnum * restrict const               coarvextax,   /*+ Private vertex array, if any   +*/
+GraphCoarsenSpill * restrict const  spilptr)      /*+ Spill data to fill             +*/
+{
+  FILE *              fileptr;
+
+  const Gnum          baseval = coargrafptr->baseval;
+  const Gnum          vertnbr = coargrafptr->vertnbr;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if ((coargrafptr->packptr != NULL) ||
+      ((coargrafptr->flagval & (GRAPHFREEVERT | GRAPHVERTGROUP | GRAPHFREEEDGE)) != (GRAPHFREEVERT | GRAPHVERTGROUP | GRAPHFREEEDGE))) {
+    errorPrint ("graphCoarsenSpill: invalid graph");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  if ((fileptr = tmpfile ()) == NULL)             /* Not an error per se: level will remain resident */
+    return (1);
+
+  graphCoarsenSpillSize2 (coargrafptr, &spilptr->vendsiz, &spilptr->edgesiz);
+  spilptr->memusiz = graphCoarsenSpillSize (coargrafptr, coarvextax);
+
+  if ((fwrite (coargrafptr->verttax + baseval, sizeof (Gnum), vertnbr + ((spilptr->vendsiz == 1) ? 1 : 0), fileptr) != (size_t) (vertnbr + ((spilptr->vendsiz == 1) ? 1 : 0))) ||
+      ((spilptr->vendsiz != 1) &&
+       (fwrite (coargrafptr->vendtax + baseval, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr)) ||
+      (fwrite (coargrafptr->velotax + baseval, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr) ||
+      (fwrite (coarmulttab, sizeof (GraphCoarsenMulti), vertnbr, fileptr) != (size_t) vertnbr) ||
+      (fwrite (coargrafptr->edgetax + baseval, sizeof (Gnum), spilptr->edgesiz, fileptr) != (size_t) spilptr->edgesiz) ||
+      (fwrite (coargrafptr->edlotax + baseval, sizeof (Gnum), spilptr->edgesiz, fileptr) != (size_t) spilptr->edgesiz) ||
+      ((coarvextax != NULL) &&
+       (fwrite (coarvextax + baseval, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr)) ||
+      (fflush (fileptr) != 0)) {
+    fclose (fileptr);                             /* Level will remain resident */
+    return (1);
+  }
+
+  memFree (coargrafptr->verttax + baseval);       /* Free group leader, along with multinode array */
+  memFree (coargrafptr->edgetax + baseval);       /* Free edge array, along with edge load array   */
+  if (coarvextax != NULL)
+    memFree (coarvextax + baseval);
+  coargrafptr->verttax =                          /* Graph can still be freed while spilled */
+  coargrafptr->vendtax =
+  coargrafptr->velotax =
+  coargrafptr->edgetax =
+  coargrafptr->edlotax = NULL;
+
+  spilptr->fileptr = fileptr;
+  spilptr->vextflg = (coarvextax != NULL) ? 1 : 0;
+
+  return (0);
+}
+
+/* This routine reads back the arrays of a
+** spilled coarse graph and closes its temporary
+** file. As arrays are re-allocated, the locations
+** of the multinode array and of the private vertex
+** array are updated.
+** It returns:
+** - 0   : if the arrays have been restored.
+** - !0  : on error; graph arrays are lost.
+*/
+
+int
+graphCoarsenRestore (
+Graph * restrict const              coargrafptr,  /*+ Spilled coarse graph               +*/
+GraphCoarsenMulti ** const          coarmultptr,  /*+ Pointer to multinode array to set  +*/
+Gnum ** const                       coarvextptr,  /*+ Pointer to private vertex array    +*/
+GraphCoarsenSpill * restrict const  spilptr)      /*+ Spill data                         +*/
+{
+  Gnum * restrict     verttab;
+  Gnum * restrict     vendtab;
+  Gnum * restrict     velotab;
+  GraphCoarsenMulti * multtab;
+  Gnum * restrict     edgetab;
+  Gnum * restrict     vexttab;
+  int                 o;
+
+  FILE * const        fileptr = spilptr->fileptr;
+  const Gnum          baseval = coargrafptr->baseval;
+  const Gnum          vertnbr = coargrafptr->vertnbr;
+  const Gnum          edgesiz = spilptr->edgesiz;
+
+  spilptr->fileptr = NULL;                        /* Level will no longer be spilled */
+
+  edgetab =
+  vexttab = NULL;
+  if ((memAllocGroup ((void **) (void *)
+                      &verttab, (size_t) (vertnbr * sizeof (Gnum)), /* TRICK: vendtab follows verttab if graph is compact */
+                      &vendtab, (size_t) (spilptr->vendsiz * sizeof (Gnum)),
+                      &velotab, (size_t) (vertnbr * sizeof (Gnum)),
+                      &multtab, (size_t) (vertnbr * sizeof (GraphCoarsenMulti)), NULL) == NULL) ||
+      ((edgetab = memAlloc (edgesiz * 2 * sizeof (Gnum))) == NULL) || /* "* 2" for edlotab */
+      ((spilptr->vextflg != 0) &&
+       ((vexttab = memAlloc (vertnbr * sizeof (Gnum))) == NULL))) {
+    errorPrint ("graphCoarsenRestore: out of memory");
+    if (verttab != NULL) {
+      if (edgetab != NULL)
+        memFree (edgetab);
+      memFree (verttab);
+    }
+    fclose (fileptr);
+    return (1);
+  }
+
+  o = 0;
+  rewind (fileptr);
+  if ((fread (verttab, sizeof (Gnum), vertnbr + ((spilptr->vendsiz == 1) ? 1 : 0), fileptr) != (size_t) (vertnbr + ((spilptr->vendsiz == 1) ? 1 : 0))) ||
+      ((spilptr->vendsiz != 1) &&
+       (fread (vendtab, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr)) ||
+      (fread (velotab, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr) ||
+      (fread (multtab, sizeof (GraphCoarsenMulti), vertnbr, fileptr) != (size_t) vertnbr) ||
+      (fread (edgetab, sizeof (Gnum), edgesiz, fileptr) != (size_t) edgesiz) ||
+      (fread (edgetab + edgesiz, sizeof (Gnum), edgesiz, fileptr) != (size_t) edgesiz) ||
+      ((vexttab != NULL) &&
+       (fread (vexttab, sizeof (Gnum), vertnbr, fileptr) != (size_t) vertnbr))) {
+    errorPrint ("graphCoarsenRestore: cannot read spilled data");
+    if (vexttab != NULL)
+      memFree (vexttab);
+    memFree (edgetab);
+    memFree (verttab);
+    o = 1;
+  }
+  fclose (fileptr);
+  if (o != 0)
+    return (o);
+
+  coargrafptr->verttax = verttab - baseval;
+  coargrafptr->vendtax = (spilptr->vendsiz == 1) ? (coargrafptr->verttax + 1) : (vendtab - baseval);
+  coargrafptr->velotax = velotab - baseval;
+  coargrafptr->edgetax = edgetab - baseval;
+  coargrafptr->edlotax = coargrafptr->edgetax + edgesiz;
+  *coarmultptr = multtab;
+  if (vexttab != NULL)
+    *coarvextptr = vexttab - baseval;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (coargrafptr) != 0) {
+    errorPrint ("graphCoarsenRestore: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -79,9 +79,15 @@
 #define GRAPHCOARSENHASMULT         0x0004        /* Multinode array provided                           */
 #define GRAPHCOARSENUSEMATE         0x0008        /* Matching array data provided                       */
 
+#define GRAPHCOARSENHOP             0x0800        /* Mate unmated vertices through their neighbors      */
 #define GRAPHCOARSENNOCOMPACT       0x1000        /* Create a non-compact graph                         */
 #define GRAPHCOARSENDETERMINISTIC   0x2000        /* Use deterministic algorithms only                  */
 #define GRAPHCOARSENNOMERGE         0x4000        /* Do not merge isolated vertices                     */
+#define GRAPHCOARSENCLUSTER         0x8000        /* Mate vertices according to clusters                */
+
+/*+ Coarsening flags for each matching type. +*/
+
+#define graphCoarsenTypeFlag(t)     (((t) == GRAPHCOARCLU) ? GRAPHCOARSENCLUSTER : (((t) == GRAPHCOARHOP) ? GRAPHCOARSENHOP : GRAPHCOARSENNONE))
 
 /*+ Prime number for hashing vertex numbers. +*/
 
@@ -96,6 +102,8 @@
 typedef enum GraphCoarsenType_ {
   GRAPHCOARHEM,                                   /*+ Heavy-edge matching       +*/
   GRAPHCOARSCN,                                   /*+ Scanning (first) matching +*/
+  GRAPHCOARCLU,                                   /*+ Cluster-based matching    +*/
+  GRAPHCOARHOP,                                   /*+ Matching and hop mating   +*/
   GRAPHCOARNBR                                    /*+ Number of matching types  +*/
 } GraphCoarsenType;
 
@@ -129,6 +137,7 @@ typedef struct GraphCoarsenThread_ {
   Gnum                      coarvertbas;          /*+ Minimum coarse vertex number                            +*/
   Gnum                      coarvertnbr;          /*+ Number of coarse vertices to date                       +*/
   Gnum                      coaredgebas;          /*+ Minimum coarse edge number                              +*/
+  Gnum                      coaredgenbr;          /*+ Local number of coarse edges                            +*/
   Gnum                      coaredloadj;          /*+ Local coarse edge load sum adjust                       +*/
   Gnum                      coardegrmax;          /*+ Local maximum degree                                    +*/
   Gnum                      finevertbas;          /*+ Start of fine vertex range                              +*/
@@ -156,25 +165,95 @@ typedef struct GraphCoarsenData_ {
   GraphCoarsenMulti *       coarmulttab;          /*+ Multinode array                                 +*/
   Gnum                      coarmultsiz;          /*+ Size of multinode array allocated in graph      +*/
   Gnum                      coarhashmsk;          /*+ Hash table mask                                 +*/
+  Gnum *                    coaredgetab;          /*+ Compact edge array built by threads, if any     +*/
   int *                     finelocktax;          /*+ Global matching lock array (if any)             +*/
+  Gnum *                    fineclustax;          /*+ Cluster label array (if clustering)             +*/
+  Gnum *                    fineclwgtax;          /*+ Cluster weight array (if clustering)            +*/
+  Gnum *                    fineclcntax;          /*+ Cluster connectivity array (if clustering)      +*/
   GraphCoarsenThread *      thrdtab;              /*+ Array of thread-specific data                   +*/
   int                       fumaval;              /*+ Index of mating routine in function array       +*/
   volatile int              retuval;              /*+ Return value                                    +*/
   Context *                 contptr;              /*+ Execution context                               +*/
 } GraphCoarsenData;
 
+/*+ A cached coarsening level. +*/
+
+typedef struct GraphCoarsenLevel_ {
+  Graph                     grafdat;              /*+ Coarse graph, which owns its arrays     +*/
+  GraphCoarsenMulti *       multtab;              /*+ Multinode array, in coarse graph arrays +*/
+} GraphCoarsenLevel;
+
+/*+ The coarsening hierarchy cache. It keeps
+    the coarse graphs and multinode arrays built
+    from some finest graph, so that subsequent
+    coarsenings of the same topology only have
+    to aggregate vertex loads across levels.     +*/
+
+typedef struct GraphCoarsenCache_ {
+  ContextCache              cachdat;              /*+ Context cache header; TRICK: must be first +*/
+  const Gnum *              verttax;              /*+ Vertex array of finest graph               +*/
+  const Gnum *              vendtax;              /*+ End vertex array of finest graph           +*/
+  const Gnum *              edgetax;              /*+ Edge array of finest graph                 +*/
+  const GraphPack *         packptr;              /*+ Packed edge array of finest graph          +*/
+  const Gnum *              edlotax;              /*+ Edge load array of finest graph            +*/
+  Gnum                      baseval;              /*+ Base value of finest graph                 +*/
+  Gnum                      vertnbr;              /*+ Number of vertices of finest graph         +*/
+  Gnum                      edgenbr;              /*+ Number of arcs of finest graph             +*/
+  Gnum                      coarnbr;              /*+ Minimum number of coarse vertices          +*/
+  double                    coarval;              /*+ Maximum contraction ratio                  +*/
+  Gnum                      flagval;              /*+ Coarsening flags                           +*/
+  Gunum                     chekval;              /*+ Checksum of finest graph topology          +*/
+  GraphCoarsenLevel *       levltab;              /*+ Array of cached levels                     +*/
+  INT                       levlnbr;              /*+ Number of cached levels                    +*/
+  INT                       levlmax;              /*+ Size of level array                        +*/
+  INT                       deptnbr;              /*+ Number of nested multilevel calls running  +*/
+} GraphCoarsenCache;
+
+/*+ The memory budget of a multilevel method.
+    It accounts for the bytes held by the coarse
+    levels which are resident in memory.         +*/
+
+typedef struct GraphCoarsenBudget_ {
+  size_t                    memumax;              /*+ Maximum number of resident bytes; 0 if unbounded +*/
+  size_t                    memunbr;              /*+ Current number of resident bytes                 +*/
+} GraphCoarsenBudget;
+
+/*+ The data of a coarse level whose arrays
+    have been spilled to a temporary file
+    until they are needed for uncoarsening. +*/
+
+typedef struct GraphCoarsenSpill_ {
+  FILE *                    fileptr;              /*+ Temporary file, or NULL if level is resident      +*/
+  Gnum                      vendsiz;              /*+ Size of end vertex array; 1 if graph is compact   +*/
+  Gnum                      edgesiz;              /*+ Size of spilled edge and edge load arrays         +*/
+  int                       vextflg;              /*+ Set if a private vertex array has been spilled    +*/
+  size_t                    memusiz;              /*+ Number of bytes released by spilling              +*/
+} GraphCoarsenSpill;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef SCOTCH_GRAPH_COARSEN
 #ifndef GRAPHCOARSENNOTHREAD
-static void                 graphCoarsenEdgeCt  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+static void                 graphCoarsenPack    (ThreadDescriptor * restrict const, GraphCoarsenData * restrict const);
 #endif /* GRAPHCOARSENNOTHREAD */
 static void                 graphCoarsenEdgeLl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 static void                 graphCoarsenEdgeLu  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
+static void                 graphCoarsenCacheFree (GraphCoarsenCache * const, const INT);
+static Gunum                graphCoarsenCacheSum (const Graph * restrict const);
+static void                 graphCoarsenCacheExit2 (ContextCache * const);
+static void                 graphCoarsenSpillSize2 (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const);
 #endif /* SCOTCH_GRAPH_COARSEN */
 
 int                         graphCoarsen        (const Graph * restrict const, Graph * restrict const, Gnum * restrict * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, Context * restrict const);
 int                         graphCoarsenMatch   (const Graph * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, Context * restrict const);
 int                         graphCoarsenBuild   (const Graph * restrict const, Graph * restrict const, Gnum * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, Context * restrict const);
+int                         graphCoarsenCache   (const Graph * restrict const, Graph * restrict const, GraphCoarsenMulti * restrict * restrict const, const Gnum, const double, const Gnum, const Anum * restrict const, const Anum * restrict const, const Gnum, const INT, Context * restrict const);
+int                         graphCoarsenCacheInit (Context * const);
+void                        graphCoarsenCacheExit (Context * const);
+void                        graphCoarsenCacheEnter (Context * const);
+void                        graphCoarsenCacheLeave (Context * const);
+size_t                      graphCoarsenSpillSize (const Graph * restrict const, const Gnum * restrict const);
+int                         graphCoarsenSpill   (Graph * restrict const, GraphCoarsenMulti * restrict const, Gnum * restrict const, GraphCoarsenSpill * restrict const);
+int                         graphCoarsenRestore (Graph * restrict const, GraphCoarsenMulti ** const, Gnum ** const, GraphCoarsenSpill * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2012,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2012,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 28 oct 2012     **/
 /**                                 to   : 28 feb 2015     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 02 aug 2018     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,9 +68,6 @@ GraphCoarsenThread * restrict const     thrdptr)
 #endif /* GRAPHCOARSENEDGECOUNT */
 
   const Graph * restrict const              finegrafptr = coarptr->finegrafptr;
-  const Gnum * restrict const               fineverttax = finegrafptr->verttax;
-  const Gnum * restrict const               finevendtax = finegrafptr->vendtax;
-  const Gnum * restrict const               fineedgetax = finegrafptr->edgetax;
 #ifdef GRAPHCOARSENEDLOTAB
   const Gnum * restrict const               fineedlotax = finegrafptr->edlotax;
 #endif /* GRAPHCOARSENEDLOTAB */
@@ -107,19 +104,18 @@ GraphCoarsenThread * restrict const     thrdptr)
 #endif /* GRAPHCOARSENEDGECOUNT */
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
-      Gnum                fineedgenum;
+      GraphCursor         finecursdat;            /* Cursor on neighbors of fine vertex */
 
       finevertnum = coarmulttax[coarvertnum].vertnum[i];
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
       coarveloval += (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
 #endif /* GRAPHCOARSENEDGECOUNT */
 
-      for (fineedgenum = fineverttax[finevertnum];
-           fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
+      for (graphCursorInit (&finecursdat, finegrafptr, finevertnum); graphCursorNext (&finecursdat); ) {
         Gnum                coarvertend;          /* Number of coarse vertex which is end of fine edge */
         Gnum                h;
 
-        coarvertend = finecoartax[fineedgetax[fineedgenum]];
+        coarvertend = finecoartax[finecursdat.vertend];
         if (coarvertend != coarvertnum) {         /* If not end of collapsed edge */
           for (h = (coarvertend * GRAPHCOARSENHASHPRIME) & coarhashmsk; ; h = (h + 1) & coarhashmsk) {
             if (coarhashtab[h].vertorgnum != coarvertnum) { /* If old slot           */
@@ -129,7 +125,7 @@ GraphCoarsenThread * restrict const     thrdptr)
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
               coaredgetax[coaredgenum]  = coarvertend; /* One more edge created      */
 #ifdef GRAPHCOARSENEDLOTAB
-              coaredlotax[coaredgenum]  = fineedlotax[fineedgenum];
+              coaredlotax[coaredgenum]  = fineedlotax[finecursdat.edgenum];
 #else /* GRAPHCOARSENEDLOTAB */
               coaredlotax[coaredgenum]  = 1;
 #endif /* GRAPHCOARSENEDLOTAB */
@@ -140,7 +136,7 @@ GraphCoarsenThread * restrict const     thrdptr)
             if (coarhashtab[h].vertendnum == coarvertend) { /* If coarse edge already exists */
 #ifndef GRAPHCOARSENEDGECOUNT
 #ifdef GRAPHCOARSENEDLOTAB
-              coaredlotax[coarhashtab[h].edgenum] += fineedlotax[fineedgenum]; /* Accumulate edge load */
+              coaredlotax[coarhashtab[h].edgenum] += fineedlotax[finecursdat.edgenum]; /* Accumulate edge load */
 #else /* GRAPHCOARSENEDLOTAB */
               coaredlotax[coarhashtab[h].edgenum] ++;
 #endif /* GRAPHCOARSENEDLOTAB */
@@ -152,7 +148,7 @@ GraphCoarsenThread * restrict const     thrdptr)
 #ifndef GRAPHCOARSENEDGECOUNT
         else {
 #ifdef GRAPHCOARSENEDLOTAB
-          coaredloadj -= fineedlotax[fineedgenum];
+          coaredloadj -= fineedlotax[finecursdat.edgenum];
 #else /* GRAPHCOARSENEDLOTAB */
           coaredloadj --;
 #endif /* GRAPHCOARSENEDLOTAB */
@@ -1,4 +1,4 @@
-/* Copyright 2017,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2017,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 31 mar 2021     **/
 /**                                 to   : 31 mar 2021     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -105,10 +105,7 @@ Context * restrict const    contptr)
   Gnum                        diammax;
   Gnum                        diambst;
 
-  const Gnum * restrict const verttax = grafptr->verttax;
-  const Gnum * restrict const vendtax = grafptr->vendtax;
   const Gnum * restrict const velotax = grafptr->velotax;
-  const Gnum * restrict const edgetax = grafptr->edgetax;
   const Gnum * restrict const edlotax = grafptr->edlotax;
 
   if (grafptr->vertnbr <= 0)                      /* Diameter of empty graphs is zero */
@@ -146,7 +143,7 @@ Context * restrict const    contptr)
     while ((vexxptr = (GraphDiamVertex *) fiboHeapMin (&fibodat)) != NULL) { /* As long as there's a vertex to extract */
       Gnum                vertnum;
       Gnum                distval;
-      Gnum                edgenum;
+      GraphCursor         cursdat;                /* Cursor on neighbors of vertex */
 
       vertnbr ++;                                 /* One more vertex processed        */
       fiboHeapDel (&fibodat, (FiboNode *) vexxptr); /* Remove it from heap            */
@@ -161,15 +158,13 @@ Context * restrict const    contptr)
       if (velotax != NULL)                        /* Add node weight as it is being traversed */
         distval += velotax[vertnum];
 
-      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); ) {
         GraphDiamVertex *   vexxpnd;
-        Gnum                vertend;
         Gnum                disttmp;
         Gnum                distold;
 
-        vertend = edgetax[edgenum];
-        vexxpnd = vexxtax + vertend;
-        disttmp = distval + ((edlotax != NULL) ? edlotax[edgenum] : 1);
+        vexxpnd = vexxtax + cursdat.vertend;
+        disttmp = distval + ((edlotax != NULL) ? edlotax[cursdat.edgenum] : 1);
         distold = vexxpnd->distval;
 
         if (disttmp < distold) {                  /* Never the case for already processed vertices */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 03 aug 2016     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -71,6 +71,7 @@
 #include "common.h"
 #include "graph.h"
 #include "graph_io.h"
+#include "graph_io_bgrf.h"
 
 /*******************************************/
 /*                                         */
@@ -78,44 +79,42 @@
 /*                                         */
 /*******************************************/
 
-/* This routine loads a source graph from
-** the given stream.
+/* This routine reads the header of a source
+** graph file from the given stream, and
+** allocates the graph arrays accordingly.
+** The property flags of the file and the
+** base adjustment to apply to edge ends
+** are returned to the caller, which is in
+** charge of reading vertex and edge data.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
 */
 
 int
-graphLoad (
+graphLoad1 (
 Graph * restrict const      grafptr,              /* Graph structure to fill              */
 FILE * const                stream,               /* Stream from which to read graph data */
 const Gnum                  baseval,              /* Base value (-1 means keep file base) */
-const GraphFlag             flagval)              /* Graph loading flags                  */
+const GraphFlag             flagval,              /* Graph loading flags                  */
+char * const                proptab,              /* Array of 4 file property flags       */
+Gnum * const                baseptr)              /* Pointer to base adjustment value     */
 {
-  Gnum                edgenum;                    /* Number of edges really allocated */
-  Gnum                edgennd;
   Gnum                vlblsiz;                    /* = vertnbr if vertex labels       */
-  Gnum                vlblmax;                    /* Maximum vertex label number      */
   Gnum                velosiz;                    /* = vertnbr if vertex loads wanted */
-  Gnum                velosum;                    /* Sum of vertex loads              */
   Gnum                edlosiz;                    /* = edgenbr if edge loads wanted   */
-  Gnum                edlosum;                    /* Sum of edge loads                */
-  Gnum                edgeval;                    /* Value where to read edge end     */
   Gnum                baseadj;
   Gnum                versval;
-  Gnum                degrmax;
   Gnum                propval;
-  char                proptab[4];
-  Gnum                vertnum;
 
   memSet (grafptr, 0, sizeof (Graph));
 
   if (intLoad (stream, &versval) != 1) {          /* Read version number */
-    errorPrint ("graphLoad: bad input (1)");
+    errorPrint ("graphLoad1: bad input (1)");
     return (1);
   }
   if (versval != 0) {                             /* If version not zero */
-    errorPrint ("graphLoad: old-style graph format no longer supported");
+    errorPrint ("graphLoad1: old-style graph format no longer supported");
     return (1);
   }
 
@@ -125,16 +124,16 @@ const GraphFlag             flagval)              /* Graph loading flags
       (intLoad (stream, &propval)          != 1) ||
       (propval < 0)                              ||
       (propval > 111)) {
-    errorPrint ("graphLoad: bad input (2)");
+    errorPrint ("graphLoad1: bad input (2)");
     return (1);
   }
   if (grafptr->vertnbr < 0) {
-    errorPrint ("graphLoad: invalid number of vertices");
+    errorPrint ("graphLoad1: invalid number of vertices");
     return (1);
   }
   if ((grafptr->edgenbr < 0) ||
       ((grafptr->edgenbr & 1) != 0)) {
-    errorPrint ("graphLoad: invalid number of edges");
+    errorPrint ("graphLoad1: invalid number of edges");
     return (1);
   }
   sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
@@ -167,7 +166,7 @@ const GraphFlag             flagval)              /* Graph loading flags
                       &grafptr->edlotax, (size_t) (edlosiz                * sizeof (Gnum)), NULL) == NULL)) {
     if (grafptr->verttax != NULL)
       memFree (grafptr->verttax);
-    errorPrint ("graphLoad: out of memory");
+    errorPrint ("graphLoad1: out of memory");
     graphFree  (grafptr);
     return (1);
   }
@@ -179,6 +178,49 @@ const GraphFlag             flagval)              /* Graph loading flags
   grafptr->edgetax -= grafptr->baseval;
   grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
 
+  *baseptr = baseadj;
+
+  return (0);
+}
+
+/* This routine loads a source graph from
+** the given stream. Binary graph files are
+** recognized by their first character and
+** handed over to graphLoadBgrf().
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoad (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  Gnum                edgenum;                    /* Number of edges really allocated */
+  Gnum                edgennd;
+  Gnum                vlblmax;                    /* Maximum vertex label number      */
+  Gnum                velosum;                    /* Sum of vertex loads              */
+  Gnum                edlosum;                    /* Sum of edge loads                */
+  Gnum                edgeval;                    /* Value where to read edge end     */
+  Gnum                baseadj;
+  Gnum                degrmax;
+  char                proptab[4];
+  Gnum                vertnum;
+  int                 charval;
+
+  charval = getc (stream);                        /* Peek first character to detect binary graph files */
+  if (charval != EOF) {
+    ungetc (charval, stream);
+    if (charval == (int) (byte) GRAPHBGRFMAGIC[0]) /* If binary graph file, load it as such */
+      return (graphLoadBgrf (grafptr, stream, baseval, flagval));
+  }
+
+  if (graphLoad1 (grafptr, stream, baseval, flagval, proptab, &baseadj) != 0)
+    return (1);
+
   vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
   velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
   edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
@@ -0,0 +1,742 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bgrf.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the input/output   **/
+/**                routines for the binary memory-mappable **/
+/**                source graph format.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_IO_BGRF
+
+#include "module.h"
+#include "common.h"
+#include "geom.h"
+#include "graph.h"
+#include "graph_io_bgrf.h"
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#define GRAPHBGRFMMAP                             /* Zero-copy loading is available */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+/*******************************************/
+/*                                         */
+/* These routines handle binary graph I/O. */
+/*                                         */
+/*******************************************/
+
+/* This routine rounds the given size
+** to the next array alignment boundary.
+** It returns:
+** - the aligned size, in all cases.
+*/
+
+static
+UINT64
+graphBgrfAlign (
+const UINT64                sizeval)
+{
+  return ((sizeval + (GRAPHBGRFALIGNVAL - 1)) & ~((UINT64) (GRAPHBGRFALIGNVAL - 1)));
+}
+
+/* This routine skips the given number of
+** bytes from the given stream, which may
+** not be seekable.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphLoadBgrfSkip (
+FILE * const                stream,
+UINT64                      sizeval,
+byte * restrict const       bufftab)              /* Buffer of GRAPHBGRFBUFFNBR 64-bit items */
+{
+  while (sizeval > 0) {
+    size_t              blokval;
+
+    blokval = (size_t) MIN (sizeval, (UINT64) (GRAPHBGRFBUFFNBR * sizeof (UINT64)));
+    if (fread (bufftab, 1, blokval, stream) != blokval)
+      return (1);
+    sizeval -= (UINT64) blokval;
+  }
+
+  return (0);
+}
+
+/* This routine checks that the given compact
+** vertex and edge arrays describe a valid graph
+** structure, that is, that vertex indices are
+** non-decreasing and span all edges, that all
+** end vertices are within bounds, and that all
+** loads are non-negative. It also computes the
+** maximum degree and the load sums, as the
+** values stored in the header cannot be trusted.
+** It is used before arrays which have not been
+** read through the stream are trusted.
+** It returns:
+** - 0   : if arrays are consistent.
+** - !0  : on error.
+*/
+
+static
+int
+graphLoadBgrfCheck (
+Graph * restrict const      grafptr,              /* Graph whose sums and degree are set */
+const Gnum * restrict const verttab,              /* Compact vertex array (not based)    */
+const Gnum * restrict const velotab,              /* Vertex load array, or NULL          */
+const Gnum * restrict const edgetab,              /* Edge array (not based)              */
+const Gnum * restrict const edlotab,              /* Edge load array, or NULL            */
+const Gnum                  vertnbr,
+const Gnum                  edgenbr,
+const Gnum                  baseval)
+{
+  const Gnum          vertnnd = vertnbr + baseval;
+  Gnum                vertnum;
+  Gnum                edgenum;
+  Gnum                degrmax;
+  Gnum                velosum;
+  Gnum                edlosum;
+
+  if ((verttab[0] != baseval) ||                  /* Check vertex array bounds */
+      (verttab[vertnbr] != (baseval + edgenbr)))
+    return (1);
+  for (vertnum = 0, degrmax = 0; vertnum < vertnbr; vertnum ++) {
+    Gnum                degrval;
+
+    degrval = verttab[vertnum + 1] - verttab[vertnum];
+    if (degrval < 0)
+      return (1);
+    if (degrmax < degrval)
+      degrmax = degrval;
+  }
+  for (edgenum = 0; edgenum < edgenbr; edgenum ++) {
+    if ((edgetab[edgenum] < baseval) ||
+        (edgetab[edgenum] >= vertnnd))
+      return (1);
+  }
+
+  velosum = vertnbr;
+  if (velotab != NULL) {
+    for (vertnum = 0, velosum = 0; vertnum < vertnbr; vertnum ++) {
+      Gnum                velotmp;
+
+      velotmp = velosum + velotab[vertnum];
+      if ((velotab[vertnum] < 0) ||               /* If negative load or overflow */
+          (velotmp < velosum))
+        return (1);
+      velosum = velotmp;
+    }
+  }
+  edlosum = edgenbr;
+  if (edlotab != NULL) {
+    for (edgenum = 0, edlosum = 0; edgenum < edgenbr; edgenum ++) {
+      Gnum                edlotmp;
+
+      edlotmp = edlosum + edlotab[edgenum];
+      if ((edlotab[edgenum] < 0) ||
+          (edlotmp < edlosum))
+        return (1);
+      edlosum = edlotmp;
+    }
+  }
+
+  grafptr->degrmax = degrmax;
+  grafptr->velosum = velosum;
+  grafptr->edlosum = edlosum;
+
+  return (0);
+}
+
+/* This routine reads an integer array of the
+** given stored integer size, converts its values
+** to Gnum's, and adds the given adjustment value.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphLoadBgrfArray (
+FILE * const                stream,
+Gnum * restrict const       datatab,              /* Array to fill (not based) */
+const Gnum                  datanbr,
+const UINT32                gnumsiz,              /* Stored integer size       */
+const Gnum                  adjuval,              /* Value to add to data      */
+byte * restrict const       bufftab)              /* Buffer of GRAPHBGRFBUFFNBR 64-bit items */
+{
+  Gnum                datanum;
+
+  if (gnumsiz == sizeof (Gnum)) {                 /* Fast path: read in place */
+    if (fread (datatab, sizeof (Gnum), (size_t) datanbr, stream) != (size_t) datanbr)
+      return (1);
+    if (adjuval != 0) {
+      for (datanum = 0; datanum < datanbr; datanum ++)
+        datatab[datanum] += adjuval;
+    }
+    return (0);
+  }
+
+  for (datanum = 0; datanum < datanbr; ) {
+    Gnum                blokval;
+    Gnum                bloknum;
+
+    blokval = MIN (datanbr - datanum, GRAPHBGRFBUFFNBR);
+    if (fread (bufftab, gnumsiz, (size_t) blokval, stream) != (size_t) blokval)
+      return (1);
+
+    for (bloknum = 0; bloknum < blokval; bloknum ++, datanum ++) {
+      Gnum                dataval;
+
+      if (gnumsiz == 4) {
+        int32_t             readval;
+
+        memCpy (&readval, bufftab + bloknum * 4, 4);
+        dataval = (Gnum) readval;
+      }
+      else {
+        int64_t             readval;
+
+        memCpy (&readval, bufftab + bloknum * 8, 8);
+        dataval = (Gnum) readval;
+        if ((int64_t) dataval != readval)         /* If value does not fit in a Gnum */
+          return (2);
+      }
+      datatab[datanum] = dataval + adjuval;
+    }
+  }
+
+  return (0);
+}
+
+/* This routine loads a source graph in the binary
+** format from the given stream. The stream must be
+** positioned just after the first character of the
+** magic string, which has been read and pushed back
+** by the caller. When the stream is a regular file
+** and stored integers match Gnum's, the graph arrays
+** are mapped in memory without any copy, and the graph
+** is flagged with GRAPHFREEMMAP so that graphFree()
+** unmaps them. Else, arrays are read and converted.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBgrf (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  GraphBgrfHeader     headdat;
+  Gnum                basefil;                    /* Base value of file data          */
+  Gnum                baseadj;                    /* Adjustment between file and graph */
+  Gnum                vertnbr;
+  Gnum                edgenbr;
+  int                 veloflag;                   /* Flag set if vertex loads kept    */
+  int                 edloflag;                   /* Flag set if edge loads kept      */
+  UINT64              fileoft;                    /* Current offset in file data      */
+  int                 o;
+#ifdef GRAPHBGRFMMAP
+  off_t               headoft;                    /* Position of header in stream     */
+#endif /* GRAPHBGRFMMAP */
+
+  memSet (grafptr, 0, sizeof (Graph));
+
+#ifdef GRAPHBGRFMMAP
+  headoft = ftello (stream);                      /* Account for pushed-back character, if any */
+#endif /* GRAPHBGRFMMAP */
+  if (fread (&headdat, sizeof (GraphBgrfHeader), 1, stream) != 1) {
+    errorPrint ("graphLoadBgrf: bad input (1)");
+    return (1);
+  }
+  if (memcmp (headdat.magitab, GRAPHBGRFMAGIC, GRAPHBGRFMAGICSIZ) != 0) {
+    errorPrint ("graphLoadBgrf: not a binary graph file");
+    return (1);
+  }
+  if (headdat.endival != GRAPHBGRFENDIVAL) {
+    errorPrint ("graphLoadBgrf: binary graph file has different byte ordering");
+    return (1);
+  }
+  if (headdat.versval != GRAPHBGRFVERSVAL) {
+    errorPrint ("graphLoadBgrf: unsupported binary graph file version");
+    return (1);
+  }
+  if (((headdat.gnumsiz != 4) && (headdat.gnumsiz != 8)) ||
+      ((headdat.flagval & ~GRAPHBGRFFLAGMSK) != 0)) {
+    errorPrint ("graphLoadBgrf: bad input (2)");
+    return (1);
+  }
+
+  basefil = (Gnum) (int64_t) headdat.baseval;
+  vertnbr = (Gnum) headdat.vertnbr;
+  edgenbr = (Gnum) headdat.edgenbr;
+  if (((UINT64) vertnbr != headdat.vertnbr) ||    /* If sizes do not fit in Gnum's */
+      ((UINT64) edgenbr != headdat.edgenbr) ||
+      ((int64_t) basefil  != (int64_t) headdat.baseval) ||
+      (vertnbr < 0) || (edgenbr < 0) || (basefil < 0) ||
+      ((edgenbr & 1) != 0)) {
+    errorPrint ("graphLoadBgrf: invalid graph size");
+    return (1);
+  }
+
+  fileoft = headdat.vertoft + ((UINT64) vertnbr + 1) * headdat.gnumsiz; /* Check array layout */
+  o = (headdat.vertoft != GRAPHBGRFHEADSIZ);
+  if ((headdat.flagval & GRAPHBGRFHASVELO) != 0) {
+    o |= (headdat.velooft < fileoft) || ((headdat.velooft % headdat.gnumsiz) != 0);
+    fileoft = headdat.velooft + (UINT64) vertnbr * headdat.gnumsiz;
+  }
+  if ((headdat.flagval & GRAPHBGRFHASVLBL) != 0) {
+    o |= (headdat.vlbloft < fileoft) || ((headdat.vlbloft % headdat.gnumsiz) != 0);
+    fileoft = headdat.vlbloft + (UINT64) vertnbr * headdat.gnumsiz;
+  }
+  o |= (headdat.edgeoft < fileoft) || ((headdat.edgeoft % headdat.gnumsiz) != 0);
+  fileoft = headdat.edgeoft + (UINT64) edgenbr * headdat.gnumsiz;
+  if ((headdat.flagval & GRAPHBGRFHASEDLO) != 0) {
+    o |= (headdat.edlooft < fileoft) || ((headdat.edlooft % headdat.gnumsiz) != 0);
+    fileoft = headdat.edlooft + (UINT64) edgenbr * headdat.gnumsiz;
+  }
+  if ((o != 0) || (fileoft > headdat.datasiz)) {
+    errorPrint ("graphLoadBgrf: bad input (3)");
+    return (1);
+  }
+
+  grafptr->baseval = (baseval == -1) ? basefil : baseval;
+  baseadj = grafptr->baseval - basefil;           /* Vertex numbers are stored, not labels */
+  veloflag = (((headdat.flagval & GRAPHBGRFHASVELO) != 0) && ((flagval & GRAPHIONOLOADVERT) == 0));
+  edloflag = (((headdat.flagval & GRAPHBGRFHASEDLO) != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0));
+
+  grafptr->vertnbr = vertnbr;
+  grafptr->vertnnd = vertnbr + grafptr->baseval;
+  grafptr->edgenbr = edgenbr;
+  grafptr->velosum = vertnbr;                     /* Sums and degree are computed when checking arrays */
+  grafptr->edlosum = edgenbr;
+  grafptr->degrmax = 0;
+
+#ifdef GRAPHBGRFMMAP
+  if ((headdat.gnumsiz == sizeof (Gnum)) &&       /* If arrays can be used in place */
+      (headoft >= 0) &&
+      ((headoft % sizeof (Gnum)) == 0)) {
+    struct stat         statdat;
+    int                 filenum;
+
+    filenum = fileno (stream);
+    if ((filenum >= 0) &&
+        (fstat (filenum, &statdat) == 0) &&
+        (S_ISREG (statdat.st_mode)) &&
+        ((UINT64) statdat.st_size >= (UINT64) headoft + headdat.datasiz)) {
+      off_t               pagesiz;
+      off_t               mapoft;                 /* Page-aligned offset of mapping */
+      size_t              mapsiz;
+      byte *              mapptr;
+
+      pagesiz = (off_t) sysconf (_SC_PAGESIZE);
+      mapoft  = headoft - (headoft % pagesiz);
+      mapsiz  = (size_t) (headoft - mapoft) + (size_t) headdat.datasiz;
+      mapptr  = mmap (NULL, mapsiz, PROT_READ | PROT_WRITE, MAP_PRIVATE, filenum, mapoft); /* Private copy-on-write mapping */
+      if (mapptr != MAP_FAILED) {
+        byte *              headptr;
+        Gnum *              verttab;
+
+        headptr = mapptr + (headoft - mapoft);
+        verttab = (Gnum *) (headptr + headdat.vertoft);
+        if (graphLoadBgrfCheck (grafptr, verttab, veloflag ? (Gnum *) (headptr + headdat.velooft) : NULL, /* Mapped data is used as is */
+                                (Gnum *) (headptr + headdat.edgeoft), edloflag ? (Gnum *) (headptr + headdat.edlooft) : NULL,
+                                vertnbr, edgenbr, basefil) != 0) {
+          errorPrint ("graphLoadBgrf: invalid graph structure");
+          munmap     (mapptr, mapsiz);
+          return (1);
+        }
+
+        grafptr->flagval = GRAPHFREETABS | GRAPHFREEMMAP | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+        grafptr->verttax = verttab - grafptr->baseval;
+        grafptr->vendtax = grafptr->verttax + 1;  /* Use compact vertex array */
+        grafptr->velotax = veloflag ? ((Gnum *) (headptr + headdat.velooft) - grafptr->baseval) : NULL;
+        grafptr->vlbltax = ((headdat.flagval & GRAPHBGRFHASVLBL) != 0) ? ((Gnum *) (headptr + headdat.vlbloft) - grafptr->baseval) : NULL;
+        grafptr->edgetax = (Gnum *) (headptr + headdat.edgeoft) - grafptr->baseval;
+        grafptr->edlotax = edloflag ? ((Gnum *) (headptr + headdat.edlooft) - grafptr->baseval) : NULL;
+
+        if (baseadj != 0) {                       /* If base has to be changed, pages are copied on write */
+          Gnum                vertnum;
+          Gnum                edgenum;
+
+          for (vertnum = 0; vertnum <= vertnbr; vertnum ++)
+            verttab[vertnum] += baseadj;
+          for (edgenum = grafptr->baseval; edgenum < (edgenbr + grafptr->baseval); edgenum ++)
+            grafptr->edgetax[edgenum] += baseadj;
+        }
+
+        fseeko (stream, headoft + (off_t) headdat.datasiz, SEEK_SET); /* Leave stream after graph data */
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+        if (graphCheck (grafptr) != 0) {          /* Check graph consistency */
+          errorPrint ("graphLoadBgrf: inconsistent graph data (1)");
+          graphFree  (grafptr);
+          return (1);
+        }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+        return (0);
+      }
+    }
+  }
+#endif /* GRAPHBGRFMMAP */
+
+  {                                               /* Stream cannot be mapped: read and convert arrays */
+    byte *              bufftab;
+    Gnum                velosiz;
+    Gnum                vlblsiz;
+    Gnum                edlosiz;
+
+    velosiz = veloflag ? vertnbr : 0;
+    vlblsiz = ((headdat.flagval & GRAPHBGRFHASVLBL) != 0) ? vertnbr : 0;
+    edlosiz = edloflag ? edgenbr : 0;
+
+    if ((bufftab = memAlloc (GRAPHBGRFBUFFNBR * sizeof (UINT64))) == NULL) {
+      errorPrint ("graphLoadBgrf: out of memory (1)");
+      return (1);
+    }
+    if ((memAllocGroup ((void **) (void *)
+                        &grafptr->verttax, (size_t) ((vertnbr + 1) * sizeof (Gnum)),
+                        &grafptr->velotax, (size_t) (velosiz       * sizeof (Gnum)),
+                        &grafptr->vlbltax, (size_t) (vlblsiz       * sizeof (Gnum)), NULL) == NULL) ||
+        (memAllocGroup ((void **) (void *)
+                        &grafptr->edgetax, (size_t) (edgenbr       * sizeof (Gnum)),
+                        &grafptr->edlotax, (size_t) (edlosiz       * sizeof (Gnum)), NULL) == NULL)) {
+      if (grafptr->verttax != NULL)
+        memFree (grafptr->verttax);
+      errorPrint ("graphLoadBgrf: out of memory (2)");
+      memFree    (bufftab);
+      return (1);
+    }
+    grafptr->flagval  = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+    grafptr->verttax -= grafptr->baseval;
+    grafptr->vendtax  = grafptr->verttax + 1;     /* Use compact vertex array */
+    grafptr->velotax  = (velosiz != 0) ? (grafptr->velotax - grafptr->baseval) : NULL;
+    grafptr->vlbltax  = (vlblsiz != 0) ? (grafptr->vlbltax - grafptr->baseval) : NULL;
+    grafptr->edgetax -= grafptr->baseval;
+    grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
+
+    fileoft = sizeof (GraphBgrfHeader);           /* Arrays are stored by increasing offsets */
+    o = graphLoadBgrfSkip (stream, headdat.vertoft - fileoft, bufftab) ||
+        graphLoadBgrfArray (stream, grafptr->verttax + grafptr->baseval, vertnbr + 1, headdat.gnumsiz, baseadj, bufftab);
+    fileoft = headdat.vertoft + (UINT64) (vertnbr + 1) * headdat.gnumsiz;
+    if ((o == 0) && ((headdat.flagval & GRAPHBGRFHASVELO) != 0)) {
+      o = graphLoadBgrfSkip (stream, headdat.velooft - fileoft, bufftab);
+      if (o == 0)
+        o = (veloflag) ? graphLoadBgrfArray (stream, grafptr->velotax + grafptr->baseval, vertnbr, headdat.gnumsiz, 0, bufftab)
+                       : graphLoadBgrfSkip (stream, (UINT64) vertnbr * headdat.gnumsiz, bufftab);
+      fileoft = headdat.velooft + (UINT64) vertnbr * headdat.gnumsiz;
+    }
+    if ((o == 0) && ((headdat.flagval & GRAPHBGRFHASVLBL) != 0)) {
+      o = graphLoadBgrfSkip (stream, headdat.vlbloft - fileoft, bufftab) ||
+          graphLoadBgrfArray (stream, grafptr->vlbltax + grafptr->baseval, vertnbr, headdat.gnumsiz, 0, bufftab);
+      fileoft = headdat.vlbloft + (UINT64) vertnbr * headdat.gnumsiz;
+    }
+    if (o == 0) {
+      o = graphLoadBgrfSkip (stream, headdat.edgeoft - fileoft, bufftab) ||
+          graphLoadBgrfArray (stream, grafptr->edgetax + grafptr->baseval, edgenbr, headdat.gnumsiz, baseadj, bufftab);
+      fileoft = headdat.edgeoft + (UINT64) edgenbr * headdat.gnumsiz;
+    }
+    if ((o == 0) && ((headdat.flagval & GRAPHBGRFHASEDLO) != 0)) {
+      o = graphLoadBgrfSkip (stream, headdat.edlooft - fileoft, bufftab);
+      if (o == 0)
+        o = (edloflag) ? graphLoadBgrfArray (stream, grafptr->edlotax + grafptr->baseval, edgenbr, headdat.gnumsiz, 0, bufftab)
+                       : graphLoadBgrfSkip (stream, (UINT64) edgenbr * headdat.gnumsiz, bufftab);
+      fileoft = headdat.edlooft + (UINT64) edgenbr * headdat.gnumsiz;
+    }
+    if (o == 0)                                   /* Leave stream after graph data */
+      o = graphLoadBgrfSkip (stream, headdat.datasiz - fileoft, bufftab);
+    memFree (bufftab);
+
+    if (o != 0) {
+      errorPrint ("graphLoadBgrf: bad input (4)");
+      graphFree  (grafptr);
+      return (1);
+    }
+    if (graphLoadBgrfCheck (grafptr, grafptr->verttax + grafptr->baseval, (velosiz != 0) ? grafptr->velotax + grafptr->baseval : NULL,
+                            grafptr->edgetax + grafptr->baseval, (edlosiz != 0) ? grafptr->edlotax + grafptr->baseval : NULL,
+                            vertnbr, edgenbr, grafptr->baseval) != 0) {
+      errorPrint ("graphLoadBgrf: invalid graph structure");
+      graphFree  (grafptr);
+      return (1);
+    }
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadBgrf: inconsistent graph data (2)");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine unmaps the arrays of a graph
+** which has been loaded by mapping a binary
+** graph file. The mapping is retrieved from
+** the header, which precedes the vertex array.
+** If the edge array has been rebuilt out of
+** the mapping by graphUnpack(), it is freed.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphUnmapBgrf (
+Graph * const               grafptr)
+{
+#ifdef GRAPHBGRFMMAP
+  const GraphBgrfHeader * headptr;
+  byte *              mapptr;
+  size_t              pagesiz;
+
+  headptr = (const GraphBgrfHeader *) ((byte *) (grafptr->verttax + grafptr->baseval) - GRAPHBGRFHEADSIZ);
+  if (((grafptr->flagval & GRAPHFREEEDGE) != 0) && /* If edge array allocated by graphUnpack() */
+      (grafptr->edgetax != NULL) &&
+      ((byte *) (grafptr->edgetax + grafptr->baseval) != ((byte *) headptr + headptr->edgeoft)))
+    memFree (grafptr->edgetax + grafptr->baseval);
+
+  pagesiz = (size_t) sysconf (_SC_PAGESIZE);
+  mapptr  = (byte *) headptr - (((size_t) headptr) % pagesiz);
+  munmap (mapptr, (size_t) ((byte *) headptr - mapptr) + (size_t) headptr->datasiz);
+#endif /* GRAPHBGRFMMAP */
+}
+
+/* This routine writes the given number of
+** padding bytes to the given stream.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphSaveBgrfPad (
+FILE * const                stream,
+UINT64                      sizeval)
+{
+  for ( ; sizeval > 0; sizeval --) {
+    if (putc (0, stream) == EOF)
+      return (1);
+  }
+
+  return (0);
+}
+
+/* This routine saves a source graph to the
+** given stream, in the binary graph format.
+** Non-compact graphs are compacted on the fly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBgrf (
+const Graph * const         grafptr,
+FILE * const                stream)
+{
+  GraphBgrfHeader     headdat;
+  UINT64              fileoft;
+  Gnum                vertnum;
+  int                 o;
+
+  const Gnum                  baseval = grafptr->baseval;
+  const Gnum                  vertnnd = grafptr->vertnnd;
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const int                   cmpcflg = ((vendtax == (verttax + 1)) && (verttax[baseval] == baseval)); /* If edge arrays can be written at once */
+
+  memSet (&headdat, 0, sizeof (GraphBgrfHeader));
+  memCpy (headdat.magitab, GRAPHBGRFMAGIC, GRAPHBGRFMAGICSIZ);
+  headdat.endival = GRAPHBGRFENDIVAL;
+  headdat.versval = GRAPHBGRFVERSVAL;
+  headdat.gnumsiz = sizeof (Gnum);
+  headdat.flagval = ((grafptr->velotax != NULL) ? GRAPHBGRFHASVELO : 0) |
+                    ((grafptr->vlbltax != NULL) ? GRAPHBGRFHASVLBL : 0) |
+                    ((grafptr->edlotax != NULL) ? GRAPHBGRFHASEDLO : 0);
+  headdat.baseval = (UINT64) (int64_t) baseval;
+  headdat.vertnbr = (UINT64) grafptr->vertnbr;
+  headdat.edgenbr = (UINT64) grafptr->edgenbr;
+  headdat.velosum = (UINT64) grafptr->velosum;
+  headdat.edlosum = (UINT64) grafptr->edlosum;
+  headdat.degrmax = (UINT64) grafptr->degrmax;
+
+  fileoft = headdat.vertoft = GRAPHBGRFHEADSIZ;
+  fileoft = graphBgrfAlign (fileoft + (UINT64) (grafptr->vertnbr + 1) * sizeof (Gnum));
+  if (grafptr->velotax != NULL) {
+    headdat.velooft = fileoft;
+    fileoft = graphBgrfAlign (fileoft + (UINT64) grafptr->vertnbr * sizeof (Gnum));
+  }
+  if (grafptr->vlbltax != NULL) {
+    headdat.vlbloft = fileoft;
+    fileoft = graphBgrfAlign (fileoft + (UINT64) grafptr->vertnbr * sizeof (Gnum));
+  }
+  headdat.edgeoft = fileoft;
+  fileoft = graphBgrfAlign (fileoft + (UINT64) grafptr->edgenbr * sizeof (Gnum));
+  if (grafptr->edlotax != NULL) {
+    headdat.edlooft = fileoft;
+    fileoft = graphBgrfAlign (fileoft + (UINT64) grafptr->edgenbr * sizeof (Gnum));
+  }
+  headdat.datasiz = fileoft;
+
+  o  = (fwrite (&headdat, sizeof (GraphBgrfHeader), 1, stream) != 1);
+  o |= graphSaveBgrfPad (stream, GRAPHBGRFHEADSIZ - sizeof (GraphBgrfHeader));
+  if (cmpcflg)                                    /* Write compact vertex array */
+    o |= (fwrite (verttax + baseval, sizeof (Gnum), (size_t) (grafptr->vertnbr + 1), stream) != (size_t) (grafptr->vertnbr + 1));
+  else {
+    Gnum                edgenum;
+
+    for (vertnum = baseval, edgenum = baseval; (o == 0) && (vertnum < vertnnd); vertnum ++) {
+      o = (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+      edgenum += vendtax[vertnum] - verttax[vertnum];
+    }
+    o |= (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+  }
+  fileoft = headdat.vertoft + (UINT64) (grafptr->vertnbr + 1) * sizeof (Gnum);
+  if (grafptr->velotax != NULL) {
+    o |= graphSaveBgrfPad (stream, headdat.velooft - fileoft);
+    o |= (fwrite (grafptr->velotax + baseval, sizeof (Gnum), (size_t) grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    fileoft = headdat.velooft + (UINT64) grafptr->vertnbr * sizeof (Gnum);
+  }
+  if (grafptr->vlbltax != NULL) {
+    o |= graphSaveBgrfPad (stream, headdat.vlbloft - fileoft);
+    o |= (fwrite (grafptr->vlbltax + baseval, sizeof (Gnum), (size_t) grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    fileoft = headdat.vlbloft + (UINT64) grafptr->vertnbr * sizeof (Gnum);
+  }
+  o |= graphSaveBgrfPad (stream, headdat.edgeoft - fileoft);
+  if (cmpcflg)
+    o |= (fwrite (grafptr->edgetax + baseval, sizeof (Gnum), (size_t) grafptr->edgenbr, stream) != (size_t) grafptr->edgenbr);
+  else {
+    for (vertnum = baseval; (o == 0) && (vertnum < vertnnd); vertnum ++) {
+      size_t              degrval;
+
+      degrval = (size_t) (vendtax[vertnum] - verttax[vertnum]);
+      o = (fwrite (grafptr->edgetax + verttax[vertnum], sizeof (Gnum), degrval, stream) != degrval);
+    }
+  }
+  fileoft = headdat.edgeoft + (UINT64) grafptr->edgenbr * sizeof (Gnum);
+  if (grafptr->edlotax != NULL) {
+    o |= graphSaveBgrfPad (stream, headdat.edlooft - fileoft);
+    if (cmpcflg)
+      o |= (fwrite (grafptr->edlotax + baseval, sizeof (Gnum), (size_t) grafptr->edgenbr, stream) != (size_t) grafptr->edgenbr);
+    else {
+      for (vertnum = baseval; (o == 0) && (vertnum < vertnnd); vertnum ++) {
+        size_t              degrval;
+
+        degrval = (size_t) (vendtax[vertnum] - verttax[vertnum]);
+        o = (fwrite (grafptr->edlotax + verttax[vertnum], sizeof (Gnum), degrval, stream) != degrval);
+      }
+    }
+    fileoft = headdat.edlooft + (UINT64) grafptr->edgenbr * sizeof (Gnum);
+  }
+  o |= graphSaveBgrfPad (stream, headdat.datasiz - fileoft);
+
+  if (o != 0)
+    errorPrint ("graphSaveBgrf: bad output");
+
+  return (o);
+}
+
+/* This routine loads the geometrical graph
+** in the binary graph format. Since this
+** format holds no geometry, the geometry
+** file is ignored.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomLoadBgrf (
+Graph * restrict const      grafptr,              /* Graph to load    */
+Geom * restrict const       geomptr,              /* No use           */
+FILE * const                filesrcptr,           /* Topological data */
+FILE * const                filegeoptr,           /* No use           */
+const char * const          dataptr)              /* No use           */
+{
+  int                 charval;
+
+  charval = getc (filesrcptr);                    /* Check that stream holds a binary graph */
+  if (charval == EOF) {
+    errorPrint ("graphGeomLoadBgrf: bad input");
+    return (1);
+  }
+  ungetc (charval, filesrcptr);
+  if (charval != (int) (byte) GRAPHBGRFMAGIC[0]) {
+    errorPrint ("graphGeomLoadBgrf: not a binary graph file");
+    return (1);
+  }
+
+  return (graphLoadBgrf (grafptr, filesrcptr, -1, 0));
+}
+
+/* This routine saves the source graph
+** in the binary graph format. Geometry
+** data, if any, is not saved.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomSaveBgrf (
+const Graph * restrict const  grafptr,            /* Graph to save    */
+const Geom * restrict const   geomptr,            /* No use           */
+FILE * const                  filesrcptr,         /* Topological data */
+FILE * const                  filegeoptr,         /* No use           */
+const char * const            dataptr)            /* No use           */
+{
+  return (graphSaveBgrf (grafptr, filesrcptr));
+}
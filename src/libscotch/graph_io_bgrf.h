@@ -0,0 +1,116 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bgrf.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the binary memory-mappable source   **/
+/**                graph format.                           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ File format characteristics. The magic
+    string starts with a non-ASCII character
+    so that it cannot be mistaken for the
+    beginning of a text graph file.          +*/
+
+#define GRAPHBGRFMAGIC              "\211BGRF\r\n\032" /*+ Magic string, 8 bytes     +*/
+#define GRAPHBGRFMAGICSIZ           8             /*+ Size of magic string           +*/
+#define GRAPHBGRFENDIVAL            0x01020304    /*+ Value to check byte ordering   +*/
+#define GRAPHBGRFVERSVAL            1             /*+ Current format version         +*/
+#define GRAPHBGRFALIGNVAL           64            /*+ Alignment of arrays in file    +*/
+#define GRAPHBGRFHEADSIZ            128           /*+ Size of header; array-aligned  +*/
+#define GRAPHBGRFBUFFNBR            4096          /*+ Number of items in I/O buffers +*/
+
+/*+ Header flags. +*/
+
+#define GRAPHBGRFNONE               0x0000        /*+ No options set       +*/
+#define GRAPHBGRFHASVELO            0x0001        /*+ File has vertex loads  +*/
+#define GRAPHBGRFHASVLBL            0x0002        /*+ File has vertex labels +*/
+#define GRAPHBGRFHASEDLO            0x0004        /*+ File has edge loads    +*/
+#define GRAPHBGRFFLAGMSK            0x0007        /*+ All valid flags        +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The binary file header. All fields have fixed
+    widths so that files can be exchanged between
+    programs compiled with different integer sizes.
+    Array offsets are relative to the beginning of
+    the header, and are multiples of GRAPHBGRFALIGNVAL.
+    The vertex array always immediately follows the
+    header, which allows one to retrieve the header
+    from the vertex array of a mapped graph.            +*/
+
+typedef struct GraphBgrfHeader_ {
+  char                      magitab[GRAPHBGRFMAGICSIZ]; /*+ Magic string                      +*/
+  UINT32                    endival;              /*+ Byte ordering check value              +*/
+  UINT32                    versval;              /*+ Format version                         +*/
+  UINT32                    gnumsiz;              /*+ Size of stored integers, in bytes      +*/
+  UINT32                    flagval;              /*+ Header flags                           +*/
+  UINT64                    baseval;              /*+ Base value of stored arrays            +*/
+  UINT64                    vertnbr;              /*+ Number of vertices                     +*/
+  UINT64                    edgenbr;              /*+ Number of arcs                         +*/
+  UINT64                    velosum;              /*+ Sum of vertex loads                    +*/
+  UINT64                    edlosum;              /*+ Sum of arc loads                       +*/
+  UINT64                    degrmax;              /*+ Maximum degree                         +*/
+  UINT64                    datasiz;              /*+ Size of file data, header included     +*/
+  UINT64                    vertoft;              /*+ Offset of compact vertex array         +*/
+  UINT64                    velooft;              /*+ Offset of vertex load array, if any    +*/
+  UINT64                    vlbloft;              /*+ Offset of vertex label array, if any   +*/
+  UINT64                    edgeoft;              /*+ Offset of edge array                   +*/
+  UINT64                    edlooft;              /*+ Offset of edge load array, if any      +*/
+  UINT64                    resvtab[1];           /*+ Reserved; pads header to GRAPHBGRFHEADSIZ +*/
+} GraphBgrfHeader;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_IO_BGRF
+static UINT64               graphBgrfAlign      (const UINT64);
+static int                  graphLoadBgrfArray  (FILE * const, Gnum * restrict const, const Gnum, const UINT32, const Gnum, byte * restrict const);
+static int                  graphLoadBgrfCheck  (Graph * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum * restrict const, const Gnum, const Gnum, const Gnum);
+static int                  graphLoadBgrfSkip   (FILE * const, UINT64, byte * restrict const);
+static int                  graphSaveBgrfPad    (FILE * const, UINT64);
+#endif /* SCOTCH_GRAPH_IO_BGRF */
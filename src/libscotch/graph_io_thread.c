@@ -0,0 +1,659 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_thread.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module loads source graphs in the  **/
+/**                Scotch text format using multiple       **/
+/**                threads. Text lines are split into      **/
+/**                chunks which are parsed concurrently.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_IO_THREAD
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "graph_io.h"
+#include "graph_io_bgrf.h"
+#include "graph_io_thread.h"
+
+/*********************************/
+/*                               */
+/* These routines parse textual  */
+/* graph data held in memory.    */
+/*                               */
+/*********************************/
+
+/* This routine reads an integer value from
+** the given character area. It behaves like
+** intLoad(), except that, when the line flag
+** is set, newline characters terminate the
+** search for the value.
+** It returns:
+** - 1  : on success.
+** - 0  : if no value could be read.
+*/
+
+static
+int
+graphLoadThreadInt (
+const char ** const         charptr,              /* Pointer to current character pointer */
+const char * const          charnnd,              /* End of character area                */
+const int                   lineflag,             /* Set if value must be on current line */
+Gnum * const                valptr)               /* Area where to put value              */
+{
+  const char *        charcur;
+  int                 signval;                    /* Sign flag */
+  Gnum                val;                        /* Value     */
+
+  for (charcur = *charptr; charcur < charnnd; charcur ++) { /* Consume whitespaces */
+    if (((*charcur == '\n') && (lineflag != 0)) ||
+        (! isspace ((unsigned char) *charcur)))
+      break;
+  }
+  if (charcur >= charnnd)
+    return (0);
+
+  signval = 0;                                    /* Assume positive constant */
+  if (*charcur == '-') {
+    signval = 1;
+    charcur ++;
+  }
+  else if (*charcur == '+')
+    charcur ++;
+  if ((charcur >= charnnd) ||                     /* If first char is non numeric */
+      (*charcur < '0')     ||
+      (*charcur > '9'))
+    return (0);                                   /* Then it is an error */
+
+  for (val = 0; (charcur < charnnd) && (*charcur >= '0') && (*charcur <= '9'); charcur ++)
+    val = val * 10 + (*charcur - '0');            /* Accumulate digits */
+
+  *valptr  = (signval != 0) ? (- val) : val;      /* Set result */
+  *charptr = charcur;
+
+  return (1);
+}
+
+/* This routine counts the vertex lines and
+** the edges of the given text chunk, by
+** reading only the head of each line. It
+** stops at the first line which cannot be
+** understood as the start of a vertex line,
+** which may be a line of trailing data.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadThreadCount (
+const GraphLoadThreadData * restrict const  dataptr,
+GraphLoadThread * restrict const            thrdptr,
+const char *                                charptr, /* Start of chunk */
+const char * const                          charnnd) /* End of chunk   */
+{
+  Gnum                vertnbr;
+  Gnum                edgenbr;
+  Gnum                dumyval;
+
+  const char * const  proptab = dataptr->proptab;
+  const Gnum          edgemax = dataptr->grafptr->edgenbr;
+
+  thrdptr->failval = 0;
+  for (vertnbr = edgenbr = 0; ; vertnbr ++) {
+    Gnum                degrval;
+
+    while ((charptr < charnnd) && (isspace ((unsigned char) *charptr))) /* Skip blank lines */
+      charptr ++;
+    if (charptr >= charnnd)
+      break;
+
+    if (((proptab[0] != 0) && (graphLoadThreadInt (&charptr, charnnd, 1, &dumyval) != 1)) || /* Vertex label */
+        ((proptab[2] != 0) && (graphLoadThreadInt (&charptr, charnnd, 1, &dumyval) != 1)) || /* Vertex load  */
+        (graphLoadThreadInt (&charptr, charnnd, 1, &degrval) != 1) ||
+        (degrval < 0) || (degrval > (edgemax - edgenbr))) {
+      thrdptr->failval = 1;                       /* Line cannot be a complete vertex line */
+      break;
+    }
+    edgenbr += degrval;
+
+    if ((charptr = memchr (charptr, '\n', charnnd - charptr)) == NULL) { /* Go to end of line */
+      vertnbr ++;
+      break;
+    }
+  }
+
+  thrdptr->vertnbr = vertnbr;
+  thrdptr->edgenbr = edgenbr;
+}
+
+/* This routine parses the vertex data of the
+** given vertex range from the given text area.
+** When the line flag is set, each vertex must
+** be described on its own line, and no error
+** message is output, as the caller will then
+** fall back to the plain parsing of the data.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphLoadThreadParse (
+const GraphLoadThreadData * restrict const  dataptr,
+GraphLoadThread * restrict const            thrdptr,
+const char *                                charptr, /* Start of text area               */
+const char * const                          charnnd, /* End of text area                 */
+Gnum                                        vertnum, /* Number of first vertex to read   */
+const Gnum                                  vertnnd, /* After-last vertex to read        */
+Gnum                                        edgenum, /* Number of first edge of vertex   */
+const int                                   lineflag) /* Set if one vertex per text line */
+{
+  Gnum                vlblmax;                    /* Maximum vertex label number */
+  Gnum                velosum;                    /* Sum of vertex loads         */
+  Gnum                edlosum;                    /* Sum of edge loads           */
+  Gnum                degrmax;
+  Gnum                edgeval;                    /* Value where to read edge end */
+
+  const Graph * restrict const  grafptr = dataptr->grafptr;
+  const char * const            proptab = dataptr->proptab;
+  const Gnum                    baseadj = dataptr->baseadj;
+  const Gnum                    edgennd = grafptr->edgenbr + grafptr->baseval;
+  Gnum * restrict const         verttax = grafptr->verttax;
+  Gnum * restrict const         velotax = grafptr->velotax;
+  Gnum * restrict const         vlbltax = grafptr->vlbltax;
+  Gnum * restrict const         edgetax = grafptr->edgetax;
+  Gnum * restrict const         edlotax = grafptr->edlotax;
+
+  vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
+  velosum =
+  edlosum =
+  degrmax = 0;
+  for ( ; vertnum < vertnnd; vertnum ++) {
+    Gnum                degrval;
+
+    if (lineflag != 0) {                          /* Skip blank lines before vertex line */
+      while ((charptr < charnnd) && (isspace ((unsigned char) *charptr)))
+        charptr ++;
+    }
+
+    if (vlbltax != NULL) {                        /* If must read label               */
+      Gnum                vlblval;                /* Value where to read vertex label */
+
+      if (graphLoadThreadInt (&charptr, charnnd, lineflag, &vlblval) != 1) { /* Read label data */
+        if (lineflag == 0)
+          errorPrint ("graphLoadThreadParse: bad input (1)");
+        return (1);
+      }
+      vlbltax[vertnum] = vlblval;
+      if (vlblval > vlblmax)                      /* Get maximum vertex label */
+        vlblmax = vlblval;
+    }
+    if (proptab[2] != 0) {                        /* If must read vertex load        */
+      Gnum                veloval;                /* Value where to read vertex load */
+
+      if (graphLoadThreadInt (&charptr, charnnd, lineflag, &veloval) != 1) { /* Read vertex load data */
+        if (lineflag == 0)
+          errorPrint ("graphLoadThreadParse: bad input (2)");
+        return (1);
+      }
+      if (velotax != NULL)
+        velosum          +=
+        velotax[vertnum]  = veloval;
+    }
+    if ((graphLoadThreadInt (&charptr, charnnd, lineflag, &degrval) != 1) || /* Read vertex degree */
+        ((degrval < 0) && (lineflag != 0))) {
+      if (lineflag == 0)
+        errorPrint ("graphLoadThreadParse: bad input (3)");
+      return (1);
+    }
+    if (degrmax < degrval)                        /* Set maximum degree */
+      degrmax = degrval;
+
+    verttax[vertnum] = edgenum;                   /* Set index in edge array */
+    degrval += edgenum;
+    if (degrval > edgennd) {                      /* Check if edge array overflows */
+      if (lineflag == 0)
+        errorPrint ("graphLoadThreadParse: invalid arc count");
+      return (1);
+    }
+
+    for ( ; edgenum < degrval; edgenum ++) {
+      if (proptab[1] != 0) {                      /* If must read edge load        */
+        Gnum                edloval;              /* Value where to read edge load */
+
+        if (graphLoadThreadInt (&charptr, charnnd, lineflag, &edloval) != 1) { /* Read edge load data */
+          if (lineflag == 0)
+            errorPrint ("graphLoadThreadParse: bad input (4)");
+          return (1);
+        }
+        if (edlotax != NULL)
+          edlosum          +=
+          edlotax[edgenum]  = edloval;
+      }
+      if (graphLoadThreadInt (&charptr, charnnd, lineflag, &edgeval) != 1) { /* Read edge data */
+        if (lineflag == 0)
+          errorPrint ("graphLoadThreadParse: bad input (5)");
+        return (1);
+      }
+      edgetax[edgenum] = edgeval + baseadj;
+    }
+
+    if (lineflag != 0) {                          /* Check that nothing remains on vertex line */
+      const char *        chartmp;
+
+      for (chartmp = charptr; (chartmp < charnnd) && (*chartmp != '\n') && (isspace ((unsigned char) *chartmp)); chartmp ++) ;
+      if ((chartmp < charnnd) && (*chartmp != '\n'))
+        return (1);
+    }
+  }
+
+  thrdptr->velosum = velosum;
+  thrdptr->edlosum = edlosum;
+  thrdptr->degrmax = degrmax;
+  thrdptr->vlblmax = vlblmax;
+  thrdptr->edgennd = edgenum;
+  thrdptr->dataend = charptr;                     /* Record end of parsed data */
+
+  return (0);
+}
+
+/*************************************/
+/*                                   */
+/* These routines handle the threads */
+/* of the graph loading routine.     */
+/*                                   */
+/*************************************/
+
+/* This routine performs the prefix scan
+** of vertex and edge counts across threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadThreadScan (
+GraphLoadThread * restrict const  tlocptr,        /* Pointer to local area   */
+GraphLoadThread * restrict const  tremptr,        /* Pointer to remote area  */
+const int                         srcpval,        /* Source phase value      */
+const int                         dstpval,        /* Destination phase value */
+const void * const                globptr)        /* Unused                  */
+{
+  tlocptr->scantab[dstpval].vertnbr = tlocptr->scantab[srcpval].vertnbr + ((tremptr == NULL) ? 0 : tremptr->scantab[srcpval].vertnbr);
+  tlocptr->scantab[dstpval].edgenbr = tlocptr->scantab[srcpval].edgenbr + ((tremptr == NULL) ? 0 : tremptr->scantab[srcpval].edgenbr);
+}
+
+/* This routine is the threaded core of the
+** graph loading routine. Each thread counts
+** the vertex lines and edges of its chunk,
+** then all threads compute their vertex and
+** edge start indices by prefix scan, and
+** eventually parse their vertex lines in
+** place in the graph arrays.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadThread2 (
+ThreadDescriptor * restrict const   descptr,
+GraphLoadThreadData * restrict const  dataptr)
+{
+  Gnum                vertnum;
+  Gnum                vertnnd;
+  Gnum                edgenum;
+
+  const int                         thrdnum = threadNum (descptr);
+  GraphLoadThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+  const Gnum                        vertmax = dataptr->grafptr->vertnnd;
+  const char * const                chnkbeg = dataptr->chnktab[thrdnum];
+  const char * const                chnkend = dataptr->chnktab[thrdnum + 1];
+
+  graphLoadThreadCount (dataptr, thrdptr, chnkbeg, chnkend);
+
+  thrdptr->scantab[0].vertnbr = thrdptr->vertnbr;
+  thrdptr->scantab[0].edgenbr = thrdptr->edgenbr;
+  threadScan (descptr, (void *) thrdptr, sizeof (GraphLoadThread), (ThreadScanFunc) graphLoadThreadScan, NULL); /* Compute start indices of vertex lines and edges */
+
+  vertnum = dataptr->vertbas + thrdptr->scantab[0].vertnbr - thrdptr->vertnbr;
+  edgenum = dataptr->edgebas + thrdptr->scantab[0].edgenbr - thrdptr->edgenbr;
+  vertnnd = vertnum + thrdptr->vertnbr;
+  if (vertnnd > vertmax)                          /* Do not parse data beyond the last graph vertex */
+    vertnnd = vertmax;
+
+  thrdptr->velosum =
+  thrdptr->edlosum =
+  thrdptr->degrmax =
+  thrdptr->vlblmax = 0;
+  thrdptr->dataend = NULL;
+  thrdptr->retuval = 0;
+
+  if ((thrdptr->failval != 0) && (vertnnd < vertmax)) { /* If chunk could not be counted but its vertices are needed */
+    thrdptr->retuval = 1;
+    return;
+  }
+  if (vertnum >= vertnnd)                         /* If no vertices to parse in chunk */
+    return;
+
+  thrdptr->retuval = graphLoadThreadParse (dataptr, thrdptr, chnkbeg, chnkend, vertnum, vertnnd, edgenum, 1);
+  if (vertnnd < vertmax)                          /* Only the thread holding the last vertex knows where graph data end */
+    thrdptr->dataend = NULL;
+}
+
+/*******************************************/
+/*                                         */
+/* This is the multi-threaded graph loader */
+/*                                         */
+/*******************************************/
+
+/* This routine loads a source graph from the
+** given stream, in the Scotch text format. The
+** stream is read by large blocks made of whole
+** lines, each of which is split into as many
+** chunks as there are threads. Chunks are parsed
+** concurrently, provided that each vertex is
+** described on its own line. Else, the rest of
+** the stream is parsed sequentially, so that the
+** resulting graph is always identical to the one
+** produced by graphLoad(). As data read beyond
+** the end of the graph has to be given back to
+** the stream, non-seekable streams, such as pipes,
+** are handed over to graphLoad(), as well as when
+** only one thread is available.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadThread (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval,              /* Graph loading flags                  */
+Context * restrict const    contptr)              /* Execution context                    */
+{
+  GraphLoadThreadData       datadat;
+  GraphLoadThread *         thrdtab;
+  const char **             chnktab;
+  char *                    bufftab;              /* Stream reading buffer                    */
+  size_t                    buffsiz;              /* Size of reading buffer                   */
+  size_t                    buffnbr;              /* Number of bytes in reading buffer        */
+  size_t                    datasiz;              /* Size of data to process in current block */
+  const char *              dataend;              /* End of graph data in buffer, once known  */
+  Gnum                      vlblmax;              /* Maximum vertex label number              */
+  Gnum                      velosum;              /* Sum of vertex loads                      */
+  Gnum                      edlosum;              /* Sum of edge loads                        */
+  Gnum                      degrmax;
+  char                      proptab[4];
+  int                       lineval;              /* Set while vertices are read line by line */
+  int                       eofval;               /* Set once end of stream reached           */
+  int                       thrdnum;
+  int                       charval;
+  int                       o;
+
+  const int                 thrdnbr = contextThreadNbr (contptr);
+
+  if ((thrdnbr < 2) ||                            /* If no concurrency or if read-ahead data could not be given back */
+      (ftello (stream) < 0))
+    return (graphLoad (grafptr, stream, baseval, flagval));
+
+  charval = getc (stream);                        /* Peek first character to detect binary graph files */
+  if (charval != EOF) {
+    ungetc (charval, stream);
+    if (charval == (int) (byte) GRAPHBGRFMAGIC[0]) /* If binary graph file, load it as such */
+      return (graphLoadBgrf (grafptr, stream, baseval, flagval));
+  }
+
+  if (graphLoad1 (grafptr, stream, baseval, flagval, proptab, &datadat.baseadj) != 0)
+    return (1);
+
+  buffsiz = GRAPHLOADTHREADBUFFSIZ;
+  if (memAllocGroup ((void **) (void *)
+                     &thrdtab, (size_t) (thrdnbr       * sizeof (GraphLoadThread)),
+                     &chnktab, (size_t) ((thrdnbr + 1) * sizeof (const char *)), NULL) == NULL) {
+    errorPrint ("graphLoadThread: out of memory (1)");
+    graphFree  (grafptr);
+    return (1);
+  }
+  if ((bufftab = memAlloc (buffsiz)) == NULL) {
+    errorPrint ("graphLoadThread: out of memory (2)");
+    memFree    (thrdtab);
+    graphFree  (grafptr);
+    return (1);
+  }
+
+  datadat.grafptr = grafptr;
+  datadat.proptab = proptab;
+  datadat.vertbas =
+  datadat.edgebas = grafptr->baseval;
+  datadat.chnktab = chnktab;
+  datadat.thrdtab = thrdtab;
+
+  vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
+  velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
+  edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
+  degrmax = 0;                                    /* No maximum degree yet */
+  dataend = NULL;
+  buffnbr = 0;
+  eofval  = 0;
+  o       = 0;
+
+  for (lineval = 1; datadat.vertbas < grafptr->vertnnd; ) {
+    Gnum                vertnbr;                  /* Number of vertex lines processed in block */
+    int                 thrdmax;                  /* Number of threads which processed block   */
+
+    if (buffnbr >= buffsiz) {                     /* If buffer full of unprocessed data, enlarge it */
+      char *              bufftmp;
+
+      if ((bufftmp = memRealloc (bufftab, buffsiz * 2)) == NULL) {
+        errorPrint ("graphLoadThread: out of memory (3)");
+        o = 1;
+        break;
+      }
+      bufftab  = bufftmp;
+      buffsiz *= 2;
+    }
+    if (eofval == 0) {                            /* Fill buffer */
+      size_t              readmax;
+      size_t              readnbr;
+
+      readmax  = buffsiz - buffnbr;
+      readnbr  = fread (bufftab + buffnbr, 1, readmax, stream);
+      buffnbr += readnbr;
+      if (readnbr < readmax) {                    /* Short count only on end of stream or error */
+        if (ferror (stream)) {
+          errorPrint ("graphLoadThread: cannot read stream");
+          o = 1;
+          break;
+        }
+        eofval = 1;
+      }
+    }
+
+    if (eofval == 0) {                            /* If more data may follow */
+      if (lineval == 0)                           /* If sequential parsing, read whole stream */
+        continue;
+      for (datasiz = buffnbr; (datasiz > 0) && (bufftab[datasiz - 1] != '\n'); datasiz --) ; /* Process whole lines only */
+      if (datasiz == 0)                           /* If line longer than buffer, read more */
+        continue;
+    }
+    else
+      datasiz = buffnbr;
+
+    if (lineval != 0) {                           /* If vertex lines can be processed concurrently */
+      size_t              chnksiz;
+      int                 chnknbr;
+
+      chnknbr = (datasiz / GRAPHLOADTHREADCHNKMIN) + 1; /* Do not create too small chunks */
+      if (chnknbr > thrdnbr)
+        chnknbr = thrdnbr;
+      chnksiz = datasiz / chnknbr;
+
+      chnktab[0] = bufftab;
+      for (thrdnum = 1; thrdnum < thrdnbr; thrdnum ++) {
+        const char *        chnkptr;
+
+        chnkptr = bufftab + datasiz;
+        if (thrdnum < chnknbr) {                  /* Chunk boundaries are set after newline characters */
+          const char *        chrtptr;
+
+          chrtptr = bufftab + chnksiz * thrdnum;
+          if (chrtptr < chnktab[thrdnum - 1])
+            chrtptr = chnktab[thrdnum - 1];
+          if ((chrtptr = memchr (chrtptr, '\n', bufftab + datasiz - chrtptr)) != NULL)
+            chnkptr = chrtptr + 1;
+        }
+        chnktab[thrdnum] = chnkptr;
+      }
+      chnktab[thrdnbr] = bufftab + datasiz;
+
+      contextThreadLaunch (contptr, (ThreadFunc) graphLoadThread2, (void *) &datadat);
+
+      for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+        o |= thrdtab[thrdnum].retuval;
+      vertnbr = thrdtab[thrdnbr - 1].scantab[0].vertnbr; /* Number of vertex lines found in block */
+      if ((o != 0) ||                             /* If some chunk could not be parsed line by line */
+          ((eofval != 0) && ((datadat.vertbas + vertnbr) < grafptr->vertnnd))) { /* Or if stream too short */
+        lineval = 0;                              /* Parse block again, sequentially                */
+        o       = 0;
+        continue;
+      }
+      thrdmax = thrdnbr;
+    }
+    else {                                        /* Sequential parsing of all remaining data */
+      if (graphLoadThreadParse (&datadat, &thrdtab[0], bufftab, bufftab + datasiz,
+                                datadat.vertbas, grafptr->vertnnd, datadat.edgebas, 0) != 0) {
+        o = 1;
+        break;
+      }
+      vertnbr = grafptr->vertnnd - datadat.vertbas;
+      thrdmax = 1;
+    }
+
+    for (thrdnum = 0; thrdnum < thrdmax; thrdnum ++) { /* Accumulate thread results */
+      const GraphLoadThread * restrict const  thrdptr = &thrdtab[thrdnum];
+
+      velosum += thrdptr->velosum;
+      edlosum += thrdptr->edlosum;
+      if (degrmax < thrdptr->degrmax)
+        degrmax = thrdptr->degrmax;
+      if (vlblmax < thrdptr->vlblmax)
+        vlblmax = thrdptr->vlblmax;
+      if (thrdptr->dataend != NULL) {             /* If thread parsed last vertex of graph */
+        dataend         = thrdptr->dataend;
+        datadat.edgebas = thrdptr->edgennd;
+      }
+    }
+
+    if (dataend != NULL) {                        /* If all vertices read */
+      datadat.vertbas = grafptr->vertnnd;
+      break;
+    }
+    datadat.vertbas += vertnbr;
+    datadat.edgebas += thrdtab[thrdnbr - 1].scantab[0].edgenbr;
+
+    memMov (bufftab, bufftab + datasiz, buffnbr - datasiz); /* Keep incomplete line for next block */
+    buffnbr -= datasiz;
+  }
+
+  if (o == 0) {
+    grafptr->verttax[grafptr->vertnnd] = datadat.edgebas; /* Set end of edge array */
+    if (datadat.edgebas != (grafptr->edgenbr + grafptr->baseval)) { /* Check if number of edges is valid */
+      errorPrint ("graphLoadThread: invalid arc count");
+      o = 1;
+    }
+  }
+
+  if ((o == 0) && (dataend != NULL)) {            /* If data read beyond end of graph */
+    size_t              restsiz;
+
+    restsiz = (bufftab + buffnbr) - dataend;
+    if ((restsiz > 0) &&                          /* Try to give them back to the stream */
+        (fseeko (stream, - (off_t) restsiz, SEEK_CUR) != 0)) {
+      for ( ; dataend < (bufftab + buffnbr); dataend ++) {
+        if (! isspace ((unsigned char) *dataend)) {
+          errorPrintW ("graphLoadThread: data after graph cannot be given back to stream");
+          break;
+        }
+      }
+    }
+  }
+
+  memFree (bufftab);
+  memFree (thrdtab);                              /* Free group leader */
+
+  if (o != 0) {
+    graphFree (grafptr);
+    return (1);
+  }
+
+  grafptr->velosum = velosum;
+  grafptr->edlosum = edlosum;
+  grafptr->degrmax = degrmax;
+
+  if (grafptr->vlbltax != NULL) {                 /* If vertex label renaming necessary       */
+    if (graphLoad2 (grafptr->baseval, grafptr->vertnnd, grafptr->verttax, /* Rename edge ends */
+                    grafptr->vendtax, grafptr->edgetax, vlblmax, grafptr->vlbltax) != 0) {
+      errorPrint ("graphLoadThread: cannot relabel vertices");
+      graphFree  (grafptr);
+      return (1);
+    }
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadThread: inconsistent graph data");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,108 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_thread.h                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the multi-threaded source graph     **/
+/**                loading routine.                        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Stream reading parameters. +*/
+
+#define GRAPHLOADTHREADBUFFSIZ      (1 << 24)     /*+ Initial size of reading buffer, in bytes +*/
+#define GRAPHLOADTHREADCHNKMIN      (1 << 16)     /*+ Minimum size of per-thread text chunk    +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The prefix scan cell, which holds the
+    number of vertices and edges parsed by
+    the current and preceding threads.     +*/
+
+typedef struct GraphLoadThreadScan_ {
+  Gnum                      vertnbr;              /*+ Number of vertex lines +*/
+  Gnum                      edgenbr;              /*+ Number of edges        +*/
+} GraphLoadThreadScan;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphLoadThread_ {
+  GraphLoadThreadScan       scantab[2];           /*+ Scan cells for both scan phases           +*/
+  Gnum                      vertnbr;              /*+ Number of vertex lines found in chunk     +*/
+  Gnum                      edgenbr;              /*+ Number of edges found in chunk            +*/
+  int                       failval;              /*+ Set if chunk has a line not parsed        +*/
+  int                       retuval;              /*+ Return value of chunk parsing             +*/
+  Gnum                      velosum;              /*+ Local sum of vertex loads                 +*/
+  Gnum                      edlosum;              /*+ Local sum of edge loads                   +*/
+  Gnum                      degrmax;              /*+ Local maximum degree                      +*/
+  Gnum                      vlblmax;              /*+ Local maximum vertex label                +*/
+  Gnum                      edgennd;              /*+ End of edge range, if last vertex reached +*/
+  const char *              dataend;              /*+ End of graph data, if last vertex reached +*/
+} GraphLoadThread;
+
+/*+ The loading routine parameter structure.
+    It contains the thread-independent data. +*/
+
+typedef struct GraphLoadThreadData_ {
+  Graph *                   grafptr;              /*+ Graph being loaded                          +*/
+  const char *              proptab;              /*+ File property flags                         +*/
+  Gnum                      baseadj;              /*+ Base adjustment for edge ends               +*/
+  Gnum                      vertbas;              /*+ Number of first vertex of current block     +*/
+  Gnum                      edgebas;              /*+ Number of first edge of current block       +*/
+  const char **             chnktab;              /*+ Array of [thrdnbr + 1] chunk boundaries     +*/
+  GraphLoadThread *         thrdtab;              /*+ Array of thread-specific data               +*/
+} GraphLoadThreadData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_IO_THREAD
+static int                  graphLoadThreadInt  (const char ** const, const char * const, const int, Gnum * const);
+static void                 graphLoadThreadCount (const GraphLoadThreadData * restrict const, GraphLoadThread * restrict const, const char *, const char * const);
+static int                  graphLoadThreadParse (const GraphLoadThreadData * restrict const, GraphLoadThread * restrict const, const char *, const char * const, Gnum, const Gnum, Gnum, const int);
+static void                 graphLoadThreadScan (GraphLoadThread * restrict const, GraphLoadThread * restrict const, const int, const int, const void * const);
+static void                 graphLoadThread2    (ThreadDescriptor * restrict const, GraphLoadThreadData * restrict const);
+#endif /* SCOTCH_GRAPH_IO_THREAD */
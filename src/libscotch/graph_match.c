@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2012,2015,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 05 oct 2012     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -177,6 +177,315 @@ Gnum                                finevertnnd)
   intPsort2asc1 (thrdptr->finequeutab, finequeunbr, 3);
 }
 
+/************************/
+/*                      */
+/* The cluster-based    */
+/* mating routine.      */
+/*                      */
+/************************/
+
+/* This routine computes, by label propagation,
+** a size-constrained clustering of the fine
+** vertices of the given range, and mates pairs
+** of vertices that belong to the same cluster.
+** Vertices are first mated with their heaviest
+** neighbor within their cluster. Then, vertices
+** that are still unmated are mated together,
+** whether they are adjacent or not, if they
+** belong to the same cluster, or if, being
+** alone in their cluster, they have their
+** heaviest neighbor in the same cluster, or if
+** this neighbor is outside of the range. This
+** allows the many leaves of high-degree vertices
+** to be collapsed, which mere matching cannot do.
+** Only vertices of the range are considered, so
+** that concurrent threads never share data. The
+** vertices which remain unmated are put back in
+** the queue, in ascending degree order, to be
+** processed by the regular matching routines.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphMatchClus (
+GraphCoarsenData * restrict const   coarptr,
+GraphCoarsenThread * restrict const thrdptr,
+const Gnum                          finevertbas,
+const Gnum                          finevertnnd)
+{
+  Gnum                finevertnum;
+  Gnum                finequeunum;
+  Gnum                finequeunew;
+  Gnum                finesortnbr;                /* Number of items in sort array    */
+  Gnum                finesortnum;
+  Gnum                fineclusmax;                /* Maximum weight of a cluster      */
+  int                 passnum;
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   finevelotax = finegrafptr->velotax;
+  const Gnum * restrict const   fineedlotax = finegrafptr->edlotax;
+  const Anum * restrict const   fineparotax = coarptr->fineparotax;
+  const Anum * restrict const   finepfixtax = coarptr->finepfixtax;
+  Gnum * restrict const         finematetax = coarptr->finematetax;
+  Gnum * restrict const         fineclustax = coarptr->fineclustax;
+  Gnum * restrict const         fineclwgtax = coarptr->fineclwgtax;
+  Gnum * restrict const         fineclcntax = coarptr->fineclcntax;
+  Gnum * restrict const         finequeutab = thrdptr->finequeutab;
+  const Gnum                    finequeunbr = thrdptr->finequeunbr;
+  Gnum * restrict const         finesorttab = finequeutab + 2 * finequeunbr; /* Sort array is placed after (degree, vertex) queue */
+  Gnum                          coarvertnbr = thrdptr->coarvertnbr;
+
+  fineclusmax = GRAPHMATCHCLUSSIZE * ((finegrafptr->velosum + finegrafptr->vertnbr - 1) / finegrafptr->vertnbr);
+
+  for (finevertnum = finevertbas; finevertnum < finevertnnd; finevertnum ++) { /* Every vertex is its own cluster */
+    fineclustax[finevertnum] = finevertnum;
+    fineclwgtax[finevertnum] = (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
+    fineclcntax[finevertnum] = 0;
+  }
+
+  for (passnum = 0; passnum < GRAPHMATCHCLUSPASSNBR; passnum ++) { /* Label propagation passes */
+    Gnum                finemovenbr;
+
+    for (finequeunum = 0, finemovenbr = 0; finequeunum < finequeunbr; finequeunum ++) {
+      Gnum                fineclusnum;            /* Current cluster of vertex                */
+      Gnum                fineclusbst;            /* Best cluster found to date               */
+      Gnum                fineclcnbst;            /* Connectivity of vertex to best cluster   */
+      Gnum                fineveloval;
+      GraphCursor         finecursdat;            /* Cursor on neighbors of vertex            */
+
+      finevertnum = finequeutab[2 * finequeunum + 1];
+      graphCursorInit (&finecursdat, finegrafptr, finevertnum);
+      for (finesortnbr = 0; graphCursorNext (&finecursdat); ) { /* Sum connectivity to neighbor clusters */
+        Gnum                finevertend;
+        Gnum                fineclusend;
+
+        finevertend = finecursdat.vertend;
+        if ((finevertend < finevertbas) || (finevertend >= finevertnnd)) /* Only consider vertices of the range */
+          continue;
+
+        fineclusend = fineclustax[finevertend];
+        if (fineclcntax[fineclusend] == 0)        /* If cluster not yet encountered, record it */
+          finesorttab[finesortnbr ++] = fineclusend;
+        fineclcntax[fineclusend] += (fineedlotax != NULL) ? fineedlotax[finecursdat.edgenum] : 1;
+      }
+
+      fineclusnum = fineclustax[finevertnum];
+      fineveloval = (finevelotax != NULL) ? finevelotax[finevertnum] : 1;
+      fineclusbst = fineclusnum;                  /* Assume vertex stays in its cluster */
+      fineclcnbst = fineclcntax[fineclusnum];
+      for (finesortnum = 0; finesortnum < finesortnbr; finesortnum ++) {
+        Gnum                fineclusend;
+
+        fineclusend = finesorttab[finesortnum];
+        if ((fineclcntax[fineclusend] > fineclcnbst) && /* If better connected cluster          */
+            ((fineclwgtax[fineclusend] + fineveloval) <= fineclusmax) && /* And can accept vertex */
+            ((finepfixtax == NULL) || (finepfixtax[fineclusend] == finepfixtax[finevertnum])) && /* TRICK: cluster label is vertex with same values as all members */
+            ((fineparotax == NULL) || (fineparotax[fineclusend] == fineparotax[finevertnum]))) {
+          fineclusbst = fineclusend;
+          fineclcnbst = fineclcntax[fineclusend];
+        }
+        fineclcntax[fineclusend] = 0;             /* Reset connectivity array for next vertex */
+      }
+
+      if (fineclusbst != fineclusnum) {           /* If vertex moves to another cluster */
+        fineclwgtax[fineclusnum] -= fineveloval;
+        fineclwgtax[fineclusbst] += fineveloval;
+        fineclustax[finevertnum]  = fineclusbst;
+        finemovenbr ++;
+      }
+    }
+
+    if (finemovenbr == 0)                         /* If clustering is stable, stop here */
+      break;
+  }
+
+  for (finequeunum = 0; finequeunum < finequeunbr; finequeunum ++) { /* Mate vertices with heaviest neighbors in their cluster */
+    Gnum                fineclusnum;
+    Gnum                finevertbst;
+    Gnum                fineedlobst;
+    GraphCursor         finecursdat;
+
+    finevertnum = finequeutab[2 * finequeunum + 1];
+    if (finematetax[finevertnum] >= 0)            /* If vertex already mated, skip it */
+      continue;
+
+    fineclusnum = fineclustax[finevertnum];
+    finevertbst = finevertnum;
+    fineedlobst = -1;
+    graphCursorInit (&finecursdat, finegrafptr, finevertnum);
+    while (graphCursorNext (&finecursdat)) {
+      Gnum                finevertend;
+      Gnum                fineedloval;
+
+      finevertend = finecursdat.vertend;
+      if ((finevertend < finevertbas) || (finevertend >= finevertnnd) ||
+          (finematetax[finevertend] >= 0) || (fineclustax[finevertend] != fineclusnum))
+        continue;
+
+      fineedloval = (fineedlotax != NULL) ? fineedlotax[finecursdat.edgenum] : 1;
+      if (fineedloval > fineedlobst) {
+        finevertbst = finevertend;
+        fineedlobst = fineedloval;
+      }
+    }
+
+    if (finevertbst != finevertnum) {             /* If mate found */
+      finematetax[finevertbst] = finevertnum;
+      finematetax[finevertnum] = finevertbst;
+      coarvertnbr ++;
+    }
+  }
+
+  for (finequeunum = finesortnbr = 0; finequeunum < finequeunbr; finequeunum ++) { /* Sort remaining vertices by cluster */
+    Gnum                fineclusnum;
+
+    finevertnum = finequeutab[2 * finequeunum + 1];
+    if (finematetax[finevertnum] >= 0)
+      continue;
+
+    fineclusnum = fineclustax[finevertnum];
+    if (fineclwgtax[fineclusnum] <= ((finevelotax != NULL) ? finevelotax[finevertnum] : 1)) { /* If vertex is alone in its cluster */
+      Gnum                fineedlobst;
+      GraphCursor         finecursdat;
+
+      fineclusnum = -1;                           /* Use cluster of heaviest neighbor, if any */
+      fineedlobst = -1;
+      graphCursorInit (&finecursdat, finegrafptr, finevertnum);
+      while (graphCursorNext (&finecursdat)) {
+        Gnum                fineedloval;
+
+        fineedloval = (fineedlotax != NULL) ? fineedlotax[finecursdat.edgenum] : 1;
+        if (fineedloval > fineedlobst) {
+          fineclusnum = finecursdat.vertend;
+          fineedlobst = fineedloval;
+        }
+      }
+      if (fineclusnum < 0)                        /* If isolated vertex, leave it to regular matching */
+        continue;
+      if ((fineclusnum >= finevertbas) && (fineclusnum < finevertnnd)) /* If neighbor in range, use its cluster */
+        fineclusnum = fineclustax[fineclusnum];   /* Else, neighbor number cannot collide with cluster labels      */
+    }
+
+    finesorttab[2 * finesortnbr]     = fineclusnum;
+    finesorttab[2 * finesortnbr + 1] = finevertnum;
+    finesortnbr ++;
+  }
+  intSort2asc2 (finesorttab, finesortnbr);        /* Sort by cluster, then by vertex number, for determinism */
+
+  for (finesortnum = 0; finesortnum < (finesortnbr - 1); ) { /* Mate consecutive vertices of the same cluster */
+    Gnum                finevertend;
+
+    finevertnum = finesorttab[2 * finesortnum + 1];
+    finevertend = finesorttab[2 * finesortnum + 3];
+    if ((finesorttab[2 * finesortnum] != finesorttab[2 * finesortnum + 2]) ||
+        ((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertnum])) ||
+        ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertnum]))) {
+      finesortnum ++;
+      continue;
+    }
+
+    finematetax[finevertend] = finevertnum;
+    finematetax[finevertnum] = finevertend;
+    coarvertnbr ++;
+    finesortnum += 2;
+  }
+
+  for (finequeunum = finequeunew = 0; finequeunum < finequeunbr; finequeunum ++) { /* Compact queue of unmated vertices */
+    finevertnum = finequeutab[2 * finequeunum + 1];
+    if (finematetax[finevertnum] < 0)
+      finequeutab[finequeunew ++] = finevertnum;
+  }
+
+  thrdptr->finequeunbr = finequeunew;             /* Regular matching will only process remaining vertices */
+  thrdptr->finequeudlt = 1;                       /* Queue now only contains vertex indices                */
+  thrdptr->coarvertnbr = coarvertnbr;
+}
+
+/* This routine mates together the vertices of
+** the given range which are still unmated after
+** the matching phase, and which share the same
+** heaviest neighbor: it may be the hub to which
+** degree-one leaves are attached, or a common
+** neighbor of two vertices which are two hops
+** apart. Only vertices of the range are mated,
+** so that concurrent threads never share data.
+** The queue array is used as sort array.
+** It returns:
+** - the number of pairs of vertices mated.
+*/
+
+static
+Gnum
+graphMatchHop (
+GraphCoarsenData * restrict const   coarptr,
+GraphCoarsenThread * restrict const thrdptr,
+const Gnum                          finevertbas,
+const Gnum                          finevertnnd)
+{
+  Gnum                finevertnum;
+  Gnum                finesortnbr;                /* Number of unmated vertices to sort */
+  Gnum                finesortnum;
+  Gnum                finehopnbr;                 /* Number of pairs mated              */
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   fineedlotax = finegrafptr->edlotax;
+  const Anum * restrict const   fineparotax = coarptr->fineparotax;
+  const Anum * restrict const   finepfixtax = coarptr->finepfixtax;
+  Gnum * restrict const         finematetax = coarptr->finematetax;
+  Gnum * restrict const         finesorttab = thrdptr->finequeutab; /* Queue is no longer in use */
+
+  for (finevertnum = finevertbas, finesortnbr = 0; finevertnum < finevertnnd; finevertnum ++) {
+    Gnum                finevertbst;
+    Gnum                fineedlobst;
+    GraphCursor         finecursdat;
+
+    if (finematetax[finevertnum] != finevertnum)  /* If vertex mated with some other vertex */
+      continue;
+
+    finevertbst = -1;                             /* Search for heaviest neighbor, if any */
+    fineedlobst = -1;
+    graphCursorInit (&finecursdat, finegrafptr, finevertnum);
+    while (graphCursorNext (&finecursdat)) {
+      Gnum                fineedloval;
+
+      fineedloval = (fineedlotax != NULL) ? fineedlotax[finecursdat.edgenum] : 1;
+      if (fineedloval > fineedlobst) {
+        finevertbst = finecursdat.vertend;
+        fineedlobst = fineedloval;
+      }
+    }
+    if (finevertbst < 0)                          /* Isolated vertices are handled by matching routines */
+      continue;
+
+    finesorttab[2 * finesortnbr]     = finevertbst;
+    finesorttab[2 * finesortnbr + 1] = finevertnum;
+    finesortnbr ++;
+  }
+  intSort2asc2 (finesorttab, finesortnbr);        /* Sort by heaviest neighbor, then by vertex number, for determinism */
+
+  for (finesortnum = finehopnbr = 0; finesortnum < (finesortnbr - 1); ) { /* Mate consecutive vertices with same neighbor */
+    Gnum                finevertend;
+
+    finevertnum = finesorttab[2 * finesortnum + 1];
+    finevertend = finesorttab[2 * finesortnum + 3];
+    if ((finesorttab[2 * finesortnum] != finesorttab[2 * finesortnum + 2]) ||
+        ((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertnum])) ||
+        ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertnum]))) {
+      finesortnum ++;
+      continue;
+    }
+
+    finematetax[finevertend] = finevertnum;
+    finematetax[finevertnum] = finevertend;
+    finehopnbr ++;
+    finesortnum += 2;
+  }
+
+  return (finehopnbr);
+}
+
 /***********************************/
 /*                                 */
 /* The matching handling routines. */
@@ -208,10 +517,26 @@ const int                   thrdnbr)
   if ((coarptr->finevfixnbr > 0) || (coarptr->fineparotax != NULL))
     fumaval |= 2;
 
+  coarptr->fineclustax = NULL;                    /* Assume no clustering wanted */
+  if ((coarptr->flagval & GRAPHCOARSENCLUSTER) != 0) {
+    if (memAllocGroup ((void **) (void *)
+                       &coarptr->fineclustax, (size_t) (finegrafptr->vertnbr * sizeof (Gnum)),
+                       &coarptr->fineclwgtax, (size_t) (finegrafptr->vertnbr * sizeof (Gnum)),
+                       &coarptr->fineclcntax, (size_t) (finegrafptr->vertnbr * sizeof (Gnum)), NULL) == NULL) {
+      errorPrint ("graphMatchInit: out of memory (1)");
+      return (1);
+    }
+    coarptr->fineclustax -= finegrafptr->baseval;
+    coarptr->fineclwgtax -= finegrafptr->baseval;
+    coarptr->fineclcntax -= finegrafptr->baseval;
+  }
+
 #ifndef GRAPHMATCHNOTHREAD
   if ((deteval == 0) && (thrdnbr > 1)) {          /* If non-deterministic behavior accepted and several threads available */
     if ((coarptr->finelocktax = memAlloc (finegrafptr->vertnbr * sizeof (int))) == NULL) {
-      errorPrint ("graphMatchInit: out of memory");
+      errorPrint ("graphMatchInit: out of memory (2)");
+      if (coarptr->fineclustax != NULL)
+        memFree (coarptr->fineclustax + finegrafptr->baseval);
       return (1);
     }
     coarptr->finelocktax -= finegrafptr->baseval;
@@ -302,7 +627,7 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
   finevertsiz = finevertnnd - finevertbas;
 
   thrdptr->finequeudlt = 2;                       /* For sort queue */
-  if ((thrdptr->finequeutab = memAlloc (finevertsiz * thrdptr->finequeudlt * sizeof (Gnum))) == NULL) { /* Allocate (local or global) processing queue */
+  if ((thrdptr->finequeutab = memAlloc (finevertsiz * ((coarptr->fineclustax != NULL) ? 4 : 2) * sizeof (Gnum))) == NULL) { /* Allocate (local or global) processing queue, plus sort array if clustering */
     errorPrint ("graphMatch: out of memory");
     coarptr->retuval = 2;
     if (coarptr->finelocktax == NULL) {           /* If only thread 0 is working */
@@ -330,6 +655,14 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
 
   thrdptr->coarvertnbr = 0;                       /* No coarse vertices created yet */
 
+  if (coarptr->fineclustax != NULL) {             /* If clustering wanted, mate vertices within clusters first */
+    graphMatchClus (coarptr, thrdptr, finevertbas, finevertnnd);
+#ifdef SCOTCH_PTHREAD
+    if (coarptr->finelocktax != NULL)             /* If threads work concurrently                              */
+      threadBarrier (descptr);                    /* Mates within clusters must be known before regular matching */
+#endif /* SCOTCH_PTHREAD */
+  }
+
 #ifdef SCOTCH_PTHREAD
   if (coarptr->finelocktax != NULL) {
     graphmatchfunctab[coarptr->fumaval] (coarptr, thrdptr); /* Call parallel matching routine */
@@ -351,12 +684,32 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
     }
 
     threadBarrier (descptr);                      /* coarptr->coarvertnbr must be known to all */
+
+    if (graphMatchHopTest (coarptr)) {            /* If too many vertices remain unmated, mate them by neighbors */
+      thrdptr->coarvertnbr = graphMatchHop (coarptr, thrdptr, finevertbas, finevertnnd); /* Record number of new pairs */
+
+      threadBarrier (descptr);                    /* Wait for all threads to count their pairs */
+
+      if (thrdnum == 0) {
+        Gnum                coarvertnbr;
+        int                 thrdtmp;
+
+        for (thrdtmp = 0, coarvertnbr = coarptr->coarvertnbr; thrdtmp < thrdnbr; thrdtmp ++)
+          coarvertnbr -= coarptr->thrdtab[thrdtmp].coarvertnbr; /* Each new pair removes one coarse vertex */
+        coarptr->coarvertnbr = coarvertnbr;
+      }
+
+      threadBarrier (descptr);                    /* coarptr->coarvertnbr must be known to all */
+    }
   }
   else
 #endif /* SCOTCH_PTHREAD */
   {
     graphmatchfunctab[coarptr->fumaval & ~4] (coarptr, thrdptr); /* Call sequential matching routine                            */
     coarptr->coarvertnbr = thrdptr->coarvertnbr;  /* Global number of coarse vertices is that computed by (sequential) thread 0 */
+
+    if (graphMatchHopTest (coarptr))              /* If too many vertices remain unmated, mate them by neighbors */
+      coarptr->coarvertnbr -= graphMatchHop (coarptr, thrdptr, finevertbas, finevertnnd); /* Each new pair removes one coarse vertex */
   }
 
   memFree (thrdptr->finequeutab);
@@ -1,4 +1,4 @@
-/* Copyright 2012,2015,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2015,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 02 oct 2012     **/
 /**                                 to   : 21 feb 2020     **/
 /**                # Version 7.0  : from : 01 aug 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,6 +54,21 @@
 
 #define GRAPHMATCHSCANPERTPRIME     179           /* Prime number */
 
+/** Clustering parameters. **/
+
+#define GRAPHMATCHCLUSPASSNBR       2             /* Maximum number of label propagation passes        */
+#define GRAPHMATCHCLUSSIZE          8             /* Maximum cluster weight, in average vertex weights */
+
+/** Unmated vertex mating parameter. **/
+
+#define GRAPHMATCHHOPRAT            0.1           /* Minimum ratio of unmated vertices to mate vertices by neighbors */
+
+/** Test for mating unmated vertices by neighbors. **/
+
+#define graphMatchHopTest(c)        ((((c)->flagval & GRAPHCOARSENHOP) != 0) && \
+                                     ((double) (2 * (c)->coarvertnbr - (c)->finegrafptr->vertnbr) > /* Number of unmated vertices */ \
+                                      (GRAPHMATCHHOPRAT * (double) (c)->finegrafptr->vertnbr)))
+
 /** Function block building macro. **/
 
 #define GRAPHMATCHFUNCBLOCK(t)      graphMatch##t##NfNe, \
@@ -71,6 +86,8 @@
 */
 
 #ifdef SCOTCH_GRAPH_MATCH
+static void                 graphMatchClus      (GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const, const Gnum, const Gnum);
+static Gnum                 graphMatchHop       (GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const, const Gnum, const Gnum);
 GRAPHMATCHFUNCDECL (Seq);
 #ifndef GRAPHMATCHNOTHREAD
 GRAPHMATCHFUNCDECL (Thr);
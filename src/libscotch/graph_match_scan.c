@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2015,2018-2020 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2015,2018-2020,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**   DATES      : # Version 6.0  : from : 01 oct 2012     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 14 jan 2020     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code partly derives from the     **/
 /**                  code of graph_match.c partly updated  **/
@@ -86,7 +86,6 @@ GraphCoarsenThread * restrict const thrdptr)
 #endif /* GRAPHMATCHSCANSEQ */
   const Gnum * restrict const     fineverttax = finegrafptr->verttax;
   const Gnum * restrict const     finevendtax = finegrafptr->vendtax;
-  const Gnum * restrict const     fineedgetax = finegrafptr->edgetax;
 #ifdef GRAPHMATCHSCANEDLOTAB
   const Gnum * restrict const     fineedlotax = finegrafptr->edlotax;
 #endif /* GRAPHMATCHSCANEDLOTAB */
@@ -102,8 +101,7 @@ GraphCoarsenThread * restrict const thrdptr)
   for ( ; finequeunum < finequeunnd; finequeunum += finequeudlt) { /* For all queued vertex indices */
     Gnum                finevertnum;
     Gnum                finevertbst;
-    Gnum                fineedgenum;
-    Gnum                fineedgennd;
+    GraphCursor         finecursdat;              /* Cursor on neighbors of vertex */
 #ifdef GRAPHMATCHSCANEDLOTAB
     Gnum                fineedlobst = -1;         /* Edge load of current best neighbor */
 #endif /* GRAPHMATCHSCANEDLOTAB */
@@ -113,10 +111,8 @@ GraphCoarsenThread * restrict const thrdptr)
       continue;
 
     finevertbst = finevertnum;                    /* Assume we match with ourselves */
-    fineedgenum = fineverttax[finevertnum];
-    fineedgennd = finevendtax[finevertnum];
 
-    if (fineedgenum == fineedgennd) {             /* If isolated vertex                               */
+    if (fineverttax[finevertnum] == finevendtax[finevertnum]) { /* If isolated vertex                 */
       if ((flagval & GRAPHCOARSENNOMERGE) == 0) { /* If can be merged                                 */
         Gnum                finequisnnd;          /* Index for mating isolated vertex at end of queue */
 
@@ -148,10 +144,11 @@ GraphCoarsenThread * restrict const thrdptr)
       }
     }
     else {                                        /* Vertex has at least one neighbor     */
-      do {                                        /* Perform search for mate on neighbors */
+      graphCursorInit (&finecursdat, finegrafptr, finevertnum);
+      while (graphCursorNext (&finecursdat)) {    /* Perform search for mate on neighbors */
         Gnum                finevertend;
 
-        finevertend = fineedgetax[fineedgenum];
+        finevertend = finecursdat.vertend;
 
         if ((finematetax[finevertend] < 0)        /* If unmatched vertex */
 #ifdef GRAPHMATCHSCANPFIXTAB
@@ -159,17 +156,17 @@ GraphCoarsenThread * restrict const thrdptr)
             && ((fineparotax == NULL) || (fineparotax[finevertend] == fineparotax[finevertnum])) /* And is in the same old part                       */
 #endif /* GRAPHMATCHSCANPFIXTAB */
 #ifdef GRAPHMATCHSCANEDLOTAB
-            && (fineedlotax[fineedgenum] > fineedlobst) /* And is better candidate */
+            && (fineedlotax[finecursdat.edgenum] > fineedlobst) /* And is better candidate */
 #endif /* GRAPHMATCHSCANEDLOTAB */
         ) {
           finevertbst = finevertend;
 #ifdef GRAPHMATCHSCANEDLOTAB
-          fineedlobst = fineedlotax[fineedgenum];
+          fineedlobst = fineedlotax[finecursdat.edgenum];
 #else /* GRAPHMATCHSCANEDLOTAB */
           break;                                  /* Matching vertex found */
 #endif /* GRAPHMATCHSCANEDLOTAB */
         }
-      } while (++ fineedgenum < fineedgennd);
+      }
     }
 
 #ifndef GRAPHMATCHSCANSEQ
@@ -0,0 +1,264 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_pack.c                            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the packed          **/
+/**                (compressed) form of the edge array of  **/
+/**                source graphs.                          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_PACK
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+
+/*********************************************/
+/*                                           */
+/* These routines handle packed edge arrays. */
+/*                                           */
+/*********************************************/
+
+/* This routine decodes a variable-length
+** unsigned value from the packed byte array,
+** and moves the given pointer past it. It is
+** called by the graph cursor routines when
+** the value spans more than one byte.
+** It returns:
+** - the decoded value, in all cases.
+*/
+
+Gunum
+graphPackRead (
+const byte ** const         bytpptr)              /*+ Pointer to pointer to current byte +*/
+{
+  const byte *        byteptr;
+  Gunum               diffval;
+  int                 bitsnum;
+  byte                byteval;
+
+  byteptr = *bytpptr;
+  diffval = 0;
+  bitsnum = 0;
+  do {
+    byteval  = *(byteptr ++);
+    diffval |= ((Gunum) (byteval & 0x7F)) << bitsnum;
+    bitsnum += 7;
+  } while (byteval >= 0x80);
+  *bytpptr = byteptr;
+
+  return (diffval);
+}
+
+/* This routine replaces the edge array of
+** the given graph by its packed form. Each
+** neighbor is coded as the difference with
+** the previous neighbor of the same vertex,
+** such that neighbor lists with good locality
+** take about one byte per arc instead of
+** sizeof (Gnum). Neighbor order is preserved,
+** so that edge loads remain valid and all
+** graph algorithms keep the same behavior.
+** Packed graphs can only be traversed by
+** routines using graph cursors.
+** It returns:
+** - 0   : if graph has been packed.
+** - !0  : on error.
+*/
+
+int
+graphPack (
+Graph * restrict const      grafptr)
+{
+  GraphPack *         packptr;
+  Gnum * restrict     bidxtab;                    /* Index of first byte of each vertex */
+  byte * restrict     bytetab;                    /* Packed neighbor array              */
+  Gnum * restrict     edlotab;                    /* Copy of grouped edge load array    */
+  Gnum                bytenbr;
+  Gnum                bytenum;
+  Gnum                edgennd;                    /* Largest edge index, plus one       */
+  Gnum                edlonbr;
+  Gnum                vertnum;
+  Gunum               diffval;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+
+  if ((grafptr->flagval & GRAPHEDGEPACK) != 0)    /* If graph already packed, nothing to do */
+    return (0);
+
+  for (vertnum = grafptr->baseval, edgennd = grafptr->baseval, bytenbr = 0; /* Compute size of packed array */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                edgenum;
+    Gnum                vertend;
+
+    for (edgenum = verttax[vertnum], vertend = vertnum; edgenum < vendtax[vertnum]; edgenum ++) {
+      diffval  = GRAPHPACKENCODE (edgetax[edgenum] - vertend);
+      vertend  = edgetax[edgenum];
+      do {
+        bytenbr ++;
+        diffval >>= 7;
+      } while (diffval != 0);
+    }
+    if (bytenbr >= (GNUMMAX - 16)) {              /* Keep some room for one more packed value */
+      errorPrint ("graphPack: packed edge array too large");
+      return (1);
+    }
+    if (edgennd < vendtax[vertnum])
+      edgennd = vendtax[vertnum];
+  }
+
+  edlonbr = ((grafptr->edlotax != NULL) &&        /* If edge loads belong to edge array group to be freed */
+             ((grafptr->flagval & (GRAPHFREEEDGE | GRAPHEDGEGROUP | GRAPHFREEMMAP)) == (GRAPHFREEEDGE | GRAPHEDGEGROUP)))
+            ? (edgennd - grafptr->baseval) : 0;
+
+  if (memAllocGroup ((void **) (void *)
+                     &packptr, (size_t) sizeof (GraphPack),
+                     &bidxtab, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                     &edlotab, (size_t) (edlonbr          * sizeof (Gnum)),
+                     &bytetab, (size_t) (bytenbr          * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("graphPack: out of memory");
+    return (1);
+  }
+  packptr->bytetax = bidxtab - grafptr->baseval;
+  packptr->bytetab = bytetab;
+  packptr->bytenbr = bytenbr;
+  packptr->edlotax = NULL;
+
+  for (vertnum = grafptr->baseval, bytenum = 0;   /* Fill packed array */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                edgenum;
+    Gnum                vertend;
+
+    packptr->bytetax[vertnum] = bytenum;
+    for (edgenum = verttax[vertnum], vertend = vertnum; edgenum < vendtax[vertnum]; edgenum ++) {
+      diffval = GRAPHPACKENCODE (edgetax[edgenum] - vertend);
+      vertend = edgetax[edgenum];
+      while (diffval >= 0x80) {
+        bytetab[bytenum ++] = (byte) (diffval | 0x80);
+        diffval >>= 7;
+      }
+      bytetab[bytenum ++] = (byte) diffval;
+    }
+  }
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (bytenum != bytenbr) {
+    errorPrint ("graphPack: internal error");
+    memFree    (packptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  if ((grafptr->flagval & (GRAPHFREEEDGE | GRAPHFREEMMAP)) == GRAPHFREEEDGE) { /* If edge array belongs to graph and is not mapped */
+    if (edlonbr > 0) {                            /* If edge loads have to be preserved                                    */
+      memCpy (edlotab, grafptr->edlotax + grafptr->baseval, edlonbr * sizeof (Gnum));
+      packptr->edlotax  =
+      grafptr->edlotax  = edlotab - grafptr->baseval;
+    }
+    memFree (grafptr->edgetax + grafptr->baseval);
+  }
+
+  grafptr->edgetax  = NULL;
+  grafptr->packptr  = packptr;
+  grafptr->flagval |= GRAPHEDGEPACK | GRAPHFREEEDGE; /* Packed array always belongs to graph */
+
+  return (0);
+}
+
+/* This routine restores the plain edge
+** array of a packed graph.
+** It returns:
+** - 0   : if graph has been unpacked.
+** - !0  : on error.
+*/
+
+int
+graphUnpack (
+Graph * restrict const      grafptr)
+{
+  GraphPack *         packptr;
+  Gnum * restrict     edgetab;
+  Gnum                edgennd;                    /* Largest edge index, plus one */
+  Gnum                edgesiz;
+  Gnum                vertnum;
+
+  if ((grafptr->flagval & GRAPHEDGEPACK) == 0)    /* If graph not packed, nothing to do */
+    return (0);
+
+  for (vertnum = grafptr->baseval, edgennd = grafptr->baseval;
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    if (edgennd < grafptr->vendtax[vertnum])
+      edgennd = grafptr->vendtax[vertnum];
+  }
+  edgesiz = edgennd - grafptr->baseval;
+
+  packptr = grafptr->packptr;
+  if ((edgetab = memAlloc (((packptr->edlotax != NULL) ? 2 : 1) * edgesiz * sizeof (Gnum) + 1)) == NULL) {
+    errorPrint ("graphUnpack: out of memory");
+    return (1);
+  }
+  edgetab -= grafptr->baseval;
+
+  for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+    GraphCursor         cursdat;
+
+    for (graphCursorInit (&cursdat, grafptr, vertnum); graphCursorNext (&cursdat); )
+      edgetab[cursdat.edgenum] = cursdat.vertend;
+  }
+
+  if (packptr->edlotax != NULL) {                 /* If edge loads were grouped with packed array */
+    memCpy (edgetab + edgennd, packptr->edlotax + grafptr->baseval, edgesiz * sizeof (Gnum));
+    grafptr->edlotax  = edgetab + edgesiz;
+    grafptr->flagval |= GRAPHEDGEGROUP;
+  }
+  if ((grafptr->flagval & GRAPHFREEEDGE) != 0)    /* If packed array belongs to graph */
+    memFree (packptr);
+
+  grafptr->edgetax  = edgetab;
+  grafptr->packptr  = NULL;
+  grafptr->flagval  = (grafptr->flagval & ~GRAPHEDGEPACK) | GRAPHFREEEDGE;
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2019-2020,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2019-2020,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 11 nov 2019     **/
 /**                                 to   : 11 feb 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -122,18 +122,18 @@ const HgraphOrderHdParam * restrict const paraptr)
     iwlen = n;
   cwgtsiz = (grafptr->s.velotax != NULL) ? n : 0;
 
-  if (memAllocGroup ((void **) (void *)
-                     &petab,   (size_t) (n           * sizeof (Gnum)),
-                     &iwtab,   (size_t) (iwlen       * sizeof (Gnum)),
-                     &lentab,  (size_t) (n           * sizeof (Gnum)),
-                     &nvartab, (size_t) (n           * sizeof (Gnum)),
-                     &elentab, (size_t) (n           * sizeof (Gnum)),
-                     &lasttab, (size_t) (n           * sizeof (Gnum)),
-                     &leaftab, (size_t) (n           * sizeof (Gnum)),
-                     &frsttab, (size_t) (n           * sizeof (Gnum)),
-                     &secntab, (size_t) ((norig + 1) * sizeof (Gnum)),
-                     &nexttab, (size_t) (n           * sizeof (Gnum)),
-                     &cwgttax, (size_t) (cwgtsiz     * sizeof (Gnum)), NULL) == NULL) { /* Not based yet */
+  if (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                              &petab,   (size_t) (n           * sizeof (Gnum)),
+                              &iwtab,   (size_t) (iwlen       * sizeof (Gnum)),
+                              &lentab,  (size_t) (n           * sizeof (Gnum)),
+                              &nvartab, (size_t) (n           * sizeof (Gnum)),
+                              &elentab, (size_t) (n           * sizeof (Gnum)),
+                              &lasttab, (size_t) (n           * sizeof (Gnum)),
+                              &leaftab, (size_t) (n           * sizeof (Gnum)),
+                              &frsttab, (size_t) (n           * sizeof (Gnum)),
+                              &secntab, (size_t) ((norig + 1) * sizeof (Gnum)),
+                              &nexttab, (size_t) (n           * sizeof (Gnum)),
+                              &cwgttax, (size_t) (cwgtsiz     * sizeof (Gnum)), NULL) == NULL) { /* Not based yet */
     errorPrint ("hgraphOrderHd: out of memory");
     return (1);
   }
@@ -145,7 +145,7 @@ const HgraphOrderHdParam * restrict const paraptr)
                       leaftab, secntab, nexttab, frsttab);
   if (ncmpa < 0) {
     errorPrint ("hgraphOrderHd: internal error");
-    memFree    (petab);                           /* Free group leader */
+    contextArenaFree (grafptr->contptr, petab);   /* Free group leader */
     return (1);
   }
 
@@ -171,7 +171,7 @@ const HgraphOrderHdParam * restrict const paraptr)
                         leaftab,
                         paraptr->colmin, paraptr->colmax, (float) paraptr->fillrat);
 
-  memFree (petab);                                /* Free group leader */
+  contextArenaFree (grafptr->contptr, petab);     /* Free group leader */
 
   return (o);
 }
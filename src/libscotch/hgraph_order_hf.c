@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018-2020,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018-2020,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 29 oct 2019     **/
 /**                                 to   : 18 jan 2020     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -123,19 +123,19 @@ const HgraphOrderHfParam * restrict const paraptr)
     iwlen = n;
   cwgtsiz = (grafptr->s.velotax != NULL) ? n : 0;
 
-  if (memAllocGroup ((void **) (void *)
-                     &petab,   (size_t) (n * sizeof (Gnum)),
-                     &lentab,  (size_t) (n * sizeof (Gnum)),
-                     &nvtab,   (size_t) (n * sizeof (Gnum)),
-                     &elentab, (size_t) (n * sizeof (Gnum)),
-                     &lasttab, (size_t) (n * sizeof (Gnum)),
-                     &leaftab, (size_t) (n * sizeof (Gnum)),
-                     &frsttab, (size_t) (n * sizeof (Gnum)),
-                     &secntab, (size_t) (n * sizeof (Gnum)),
-                     &nexttab, (size_t) (n * sizeof (Gnum)),
-                     &cwgttax, (size_t) (cwgtsiz * sizeof (Gnum)), /* Not based yet */
-                     &headtab, (size_t) ((nbbuck + 2) * sizeof (Gnum)),
-                     &iwtab,   (size_t) (iwlen * sizeof (Gnum)), NULL) == NULL) {
+  if (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                              &petab,   (size_t) (n * sizeof (Gnum)),
+                              &lentab,  (size_t) (n * sizeof (Gnum)),
+                              &nvtab,   (size_t) (n * sizeof (Gnum)),
+                              &elentab, (size_t) (n * sizeof (Gnum)),
+                              &lasttab, (size_t) (n * sizeof (Gnum)),
+                              &leaftab, (size_t) (n * sizeof (Gnum)),
+                              &frsttab, (size_t) (n * sizeof (Gnum)),
+                              &secntab, (size_t) (n * sizeof (Gnum)),
+                              &nexttab, (size_t) (n * sizeof (Gnum)),
+                              &cwgttax, (size_t) (cwgtsiz * sizeof (Gnum)), /* Not based yet */
+                              &headtab, (size_t) ((nbbuck + 2) * sizeof (Gnum)),
+                              &iwtab,   (size_t) (iwlen * sizeof (Gnum)), NULL) == NULL) {
     errorPrint ("hgraphOrderHf: out of memory");
     return (1);
   }
@@ -147,7 +147,7 @@ const HgraphOrderHfParam * restrict const paraptr)
                        leaftab, secntab, nexttab, frsttab, headtab);
   if (ncmpa < 0) {
     errorPrint ("hgraphOrderHf: internal error");
-    memFree    (petab);                           /* Free group leader */
+    contextArenaFree (grafptr->contptr, petab);   /* Free group leader */
     return (1);
   }
 
@@ -173,7 +173,7 @@ const HgraphOrderHfParam * restrict const paraptr)
                         leaftab,
                         paraptr->colmin, paraptr->colmax, (float) paraptr->fillrat);
 
-  memFree (petab);                                /* Free group leader */
+  contextArenaFree (grafptr->contptr, petab);     /* Free group leader */
 
   return (o);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2012,2016,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2016,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**                # Version 6.0  : from : 23 aug 2014     **/
 /**                                 to   : 15 aug 2016     **/
 /**                # Version 7.0  : from : 26 apr 2021     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -108,6 +108,7 @@ const HgraphOrderKpParam * restrict const paraptr)
 
   hgraphUnhalo (grafptr, &actgrafdat.s);          /* Extract non-halo part of given graph       */
   actgrafdat.s.vnumtax = NULL;                    /* Do not keep numbers from nested dissection */
+  actgrafdat.contptr   = grafptr->contptr;        /* Use same execution context                 */
 
   SCOTCH_archCmplt ((SCOTCH_Arch *) &archdat, (SCOTCH_Num) partnbr); /* Build complete graph architecture */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2012,2014,2016,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2012,2014,2016,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 05 may 2019     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,8 +83,8 @@
 static
 void
 hgraphOrderNd2 (
-Context * restrict const          contptr,        /*+ (Sub-)context                          +*/
-const int                         spltnum,        /*+ Rank of sub-context in initial context +*/
+Context * restrict const          contptr,        /*+ Task context                           +*/
+const int                         spltnum,        /*+ Rank of sub-task                       +*/
 const HgraphOrderNdSplit * const  spltptr)
 {
   Hgraph              orggrafdat;
@@ -284,7 +284,7 @@ const HgraphOrderNdParam * restrict const paraptr)
     o = 0;                                        /* No separator ordering computed */
   }
   if (o == 0) {
-    HgraphOrderNdSplit  spltdat;                  /* Parameters for context splitting */
+    HgraphOrderNdSplit  spltdat;                  /* Parameters for sub-tasks         */
 
     spltdat.splttab[0].vnumnbr = vsplisttab[0].vnumnbr;
     spltdat.splttab[0].vnumtab = vsplisttab[0].vnumtab;
@@ -302,7 +302,7 @@ const HgraphOrderNdParam * restrict const paraptr)
     spltdat.revaptr = &o;
 
 #ifndef HGRAPHORDERNDNOTHREAD
-    if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) hgraphOrderNd2, &spltdat) != 0) /* If counld not split context to run concurrently */
+    if (contextThreadLaunchTask (grafptr->contptr, (ContextSplitFunc) hgraphOrderNd2, &spltdat) != 0) /* If could not run both parts as concurrent tasks */
 #endif /* HGRAPHORDERNDNOTHREAD */
     {
       hgraphOrderNd2 (grafptr->contptr, 0, &spltdat); /* Run tasks in sequence */
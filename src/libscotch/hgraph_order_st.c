@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -251,6 +251,52 @@ StratTab                    hgraphorderststratab = { /* Strategy tables for grap
 /*                                  */
 /************************************/
 
+/* This routine applies the given method
+** to the given graph, and records the
+** statistics of the call in its context.
+** It returns:
+** - the value returned by the method.
+*/
+
+static
+int
+hgraphOrderStStats (
+Hgraph * restrict const     grafptr,              /*+ Subgraph to order          +*/
+Order * restrict const      ordeptr,              /*+ Ordering to complete       +*/
+const Gnum                  ordenum,              /*+ Index to start ordering at +*/
+OrderCblk * restrict const  cblkptr,              /*+ Current column block       +*/
+const Strat * const         straptr)              /*+ Method strategy node       +*/
+{
+  StatsRecord         recodat;
+  StatsRecord *       recoold;
+  int                 o;
+
+  recodat.clasptr    = "hgraph";
+  recodat.methptr    = straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr;
+  recodat.levlnum    = grafptr->levlnum;
+  recodat.vertnbr    = grafptr->vnohnbr;
+  recodat.edgenbr    = grafptr->enohnbr;
+  recodat.cutvtab[0] =                            /* No cut nor imbalance for orderings */
+  recodat.cutvtab[1] =
+  recodat.imbvtab[0] =
+  recodat.imbvtab[1] = -1.0;
+  recodat.passnbr    = -1;                        /* Not an iterative method unless it tells so */
+  recodat.passtim    = 0.0;
+  recodat.bandtim    = -1.0;                      /* No band graph built unless method tells so */
+  recodat.timeval    = clockGet ();
+  recoold            = grafptr->contptr->recoptr; /* Save record of enclosing call, if any */
+  grafptr->contptr->recoptr = &recodat;
+
+  o = ((HgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+      (grafptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat);
+
+  grafptr->contptr->recoptr = recoold;
+  recodat.timeval    = clockGet () - recodat.timeval;
+  contextStatsAdd (grafptr->contptr, &recodat);   /* Statistics are not critical */
+
+  return (o);
+}
+
 /* This routine computes an ordering
 ** with respect to a given strategy.
 ** It returns:
@@ -307,6 +353,8 @@ const Strat * restrict const    straptr)          /*+ Graph ordering strategy
 #else /* SCOTCH_DEBUG_HGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_HGRAPH2 */
+      if (grafptr->contptr->statptr != NULL)      /* If strategy statistics wanted */
+        return (hgraphOrderStStats (grafptr, ordeptr, ordenum, cblkptr, straptr));
       return (((HgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
               (grafptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat));
 #ifdef SCOTCH_DEBUG_HGRAPH2
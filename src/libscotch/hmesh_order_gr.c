@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 4.0  : from : 30 nov 2003     **/
 /**                                 to   : 27 jan 2004     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -89,6 +89,7 @@ const HmeshOrderGrParam * const paraptr)
     errorPrint ("hmeshOrderGr: cannot build halo graph");
     return (1);
   }
+  grafdat.contptr = meshptr->contptr;             /* Use same execution context */
 
   if ((o = hgraphOrderSt (&grafdat, ordeptr, ordenum, cblkptr, paraptr->stratptr)) != 0)
     errorPrint ("hmeshOrderGr: cannot order graph");
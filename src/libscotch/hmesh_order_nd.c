@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2018-2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2018-2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 15 may 2018     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,8 +78,8 @@
 static
 void
 hmeshOrderNd2 (
-Context * restrict const        contptr,          /*+ (Sub-)context                          +*/
-const int                       spltnum,          /*+ Rank of sub-context in initial context +*/
+Context * restrict const        contptr,          /*+ Task context                           +*/
+const int                       spltnum,          /*+ Rank of sub-task                       +*/
 const HmeshOrderNdSplit * const spltptr)
 {
   Hmesh               orgmeshdat;
@@ -240,7 +240,7 @@ const HmeshOrderNdParam * const   paraptr)
     o = 0;                                        /* No separator ordering computed */
   }
   if (o == 0) {
-    HmeshOrderNdSplit   spltdat;                  /* Parameters for context splitting */
+    HmeshOrderNdSplit   spltdat;                  /* Parameters for sub-tasks         */
 
     spltdat.splttab[0].velmnbr = nspmeshdat.ecmpsize[0];
     spltdat.splttab[0].vnodnbr = nspmeshdat.ncmpsize[0];
@@ -258,7 +258,7 @@ const HmeshOrderNdParam * const   paraptr)
     spltdat.revaptr = &o;
 
 #ifndef HMESHORDERNDNOTHREAD
-    if (contextThreadLaunchSplit (meshptr->contptr, (ContextSplitFunc) hmeshOrderNd2, &spltdat) != 0) /* If counld not split context to run concurrently */
+    if (contextThreadLaunchTask (meshptr->contptr, (ContextSplitFunc) hmeshOrderNd2, &spltdat) != 0) /* If could not run both parts as concurrent tasks */
 #endif /* HMESHORDERNDNOTHREAD */
     {
       hmeshOrderNd2 (meshptr->contptr, 0, &spltdat); /* Run tasks in sequence */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2020,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 27 aug 2020     **/
 /**                # Version 7.0  : from : 22 jun 2021     **/
-/**                                 to   : 22 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -238,3 +238,67 @@ Kgraph * restrict const     grafptr)
 
   grafptr->fronnbr = fronnbr;
 }
+
+/* This routine initializes the inter-domain
+** distance cache of the current mapping.
+** The distance matrix is only computed when
+** the number of domains is small enough for
+** its computation to cost less than the
+** distances it will spare during refinement.
+** Else, or if memory is lacking, distances
+** will be computed on the fly.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kgraphDistInit (
+KgraphDist * restrict const   distptr,
+const Kgraph * restrict const grafptr)
+{
+  Anum                domnnbr;
+  Anum                domnnum;
+
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+
+  domnnbr = grafptr->m.domnnbr;
+  distptr->archptr = archptr;
+  distptr->domntab = domntab;
+  distptr->domnnbr = domnnbr;
+  distptr->disttab = NULL;
+
+  if ((domnnbr < 2) ||                            /* If too few or too many domains to be worth caching */
+      (domnnbr > KGRAPHDISTDOMNMAX) ||
+      (((Gnum) domnnbr * (Gnum) domnnbr) > grafptr->s.edgenbr))
+    return;
+  if ((distptr->disttab = memAlloc ((size_t) domnnbr * (size_t) domnnbr * sizeof (Anum))) == NULL)
+    return;                                       /* Not an error: distances will be computed on the fly */
+
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++) {
+    Anum                domnend;
+
+    distptr->disttab[domnnum * domnnbr + domnnum] = 0;
+    for (domnend = domnnum + 1; domnend < domnnbr; domnend ++) { /* Distances are symmetric */
+      Anum                distval;
+
+      distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      distptr->disttab[domnnum * domnnbr + domnend] =
+      distptr->disttab[domnend * domnnbr + domnnum] = distval;
+    }
+  }
+}
+
+/* This routine frees the inter-domain
+** distance cache.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kgraphDistExit (
+KgraphDist * restrict const distptr)
+{
+  if (distptr->disttab != NULL)
+    memFree (distptr->disttab);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2014,2018,2021,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2014,2018,2021,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 16 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The comploadavg and comploaddlt       **/
 /**                  should always be allocated together,  **/
@@ -101,6 +101,11 @@
 #define KGRAPHFREEVMLO              (GRAPHBITSNOTUSED << 3) /*+ Free vertex migration cost array +*/
 #define KGRAPHHASANCHORS            (GRAPHBITSNOTUSED << 4) /*+ The graph is a band graph        +*/
 
+/*+ Maximum number of domains for which the
+    inter-domain distance matrix is cached.  +*/
+
+#define KGRAPHDISTDOMNMAX           2048
+
 /*
 **  The type and structure definitions.
 */
@@ -130,6 +135,17 @@ typedef struct Kgraph_ {
   Context *                 contptr;              /*+ Execution context                                 +*/
 } Kgraph;
 
+/*+ The inter-domain distance cache. When
+    disttab is NULL, distances are computed
+    on the fly by the architecture routines. +*/
+
+typedef struct KgraphDist_ {
+  const Arch *              archptr;              /*+ Target architecture                          +*/
+  const ArchDom *           domntab;              /*+ Array of domains                             +*/
+  Anum                      domnnbr;              /*+ Number of domains                            +*/
+  Anum *                    disttab;              /*+ Distance matrix [domnnbr * domnnbr], or NULL +*/
+} KgraphDist;
+
 /*+ The save graph structure. +*/
 
 typedef struct KgraphStore_ {
@@ -155,9 +171,17 @@ void                        kgraphFrst          (Kgraph * const);
 int                         kgraphCheck         (const Kgraph * const);
 void                        kgraphCost          (Kgraph * const);
 void                        kgraphFron          (Kgraph * const);
+void                        kgraphDistInit      (KgraphDist * const, const Kgraph * const);
+void                        kgraphDistExit      (KgraphDist * const);
 int                         kgraphBand          (Kgraph * restrict const, const Gnum, Kgraph * restrict const, Gnum * const, Gnum * restrict * restrict const);
 
 int                         kgraphStoreInit     (const Kgraph * const, KgraphStore * const);
 void                        kgraphStoreExit     (KgraphStore * const);
 void                        kgraphStoreSave     (const Kgraph * const, KgraphStore * const);
 void                        kgraphStoreUpdt     (Kgraph * const, const KgraphStore * const);
+
+/*
+**  The macro definitions.
+*/
+
+#define kgraphDistVal(d,i,j)        (((d)->disttab != NULL) ? (d)->disttab[(i) * (d)->domnnbr + (j)] : archDomDist ((d)->archptr, &(d)->domntab[i], &(d)->domntab[j]))
@@ -135,7 +135,7 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
 
   if (graphBand (&grafptr->s, grafptr->fronnbr, grafptr->frontab, distmax,
                  &vnumotbdtax, &bandvertlvlnum, &bandvertnbr, &bandedgenbr,
-                 pfixtax, &bandvfixnbr) != 0) {   /* Get vertices to keep in band graph */
+                 pfixtax, &bandvfixnbr, grafptr->contptr) != 0) { /* Get vertices to keep in band graph */
     errorPrint ("kgraphBand: cannot number graph vertices");
     return (1);
   }
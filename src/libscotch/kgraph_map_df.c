@@ -1,4 +1,4 @@
-/* Copyright 2010-2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010-2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 05 jan 2010     **/
 /**                                 to   : 04 nov 2012     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -131,6 +131,7 @@ KgraphMapDfData * restrict const  loopptr)
   Anum                          domnnnd;
   Anum                          domnnum;
   Gnum                          passnum;
+  double                        passtim;          /* Start time of passes                    */
   int                           velsmsk;
   int                           mappflag = 0;     /* Flag set if we are computing a mapping  */
 
@@ -165,6 +166,8 @@ KgraphMapDfData * restrict const  loopptr)
   vertnnd = baseval + DATASCAN (vancnbr, thrdnbr, thrdnum + 1);
 
   sorttab = NULL;                                 /* In case of abort */
+  passnum = loopptr->passnbr;
+  passtim = 0.0;
 
   velsmsk = 1;                                    /* Assume no anchors are isolated */
   if (edlotax != NULL) {
@@ -242,9 +245,11 @@ KgraphMapDfData * restrict const  loopptr)
   difntax = loopptr->difntax;
   difotax = loopptr->difotax;
 
-  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
-    difotax[vertnum].partval = parttax[vertnum]; /* Set initial part by default */
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* Touch both arrays for memory affinity of local pages */
+    difotax[vertnum].partval =
+    difntax[vertnum].partval = parttax[vertnum]; /* Set initial part by default */
     difotax[vertnum].diffval =
+    difntax[vertnum].diffval =
     difotax[vertnum].fdifval =
     difotax[vertnum].mdisval =
     difotax[vertnum].mdidval =
@@ -298,13 +303,21 @@ KgraphMapDfData * restrict const  loopptr)
     mappflag = 1;
 #endif /* KGRAPHDIFFMAPPNONE */
 
-  passnum = loopptr->passnbr;
+  passtim = clockGet ();                          /* Time passes for statistics */
+
   for ( ; passnum > 0; passnum --) {              /* For all passes       */
     KgraphMapDfVertex * difttax;                  /* Temporary swap value */
     Gnum                vertnum;
     float               veloval;
+    float               varisum;                  /* Sum of variations of local values          */
+    float               valusum;                  /* Sum of local values                        */
+    int                 moveval;                  /* Flag set if some local vertex changed part */
+    int                 thrdtmp;
 
     veloval = 1.0F;                               /* Assume no vertex loads */
+    varisum =
+    valusum = 0.0F;
+    moveval = 0;
 
     for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* For all local regular vertices */
       Gnum                edgenum;
@@ -316,6 +329,7 @@ KgraphMapDfData * restrict const  loopptr)
       Anum                partnbr;                /* Number of active parts */
       Anum                partnum;
       float               diffval;
+      float               diffdlt;
       Anum                partcur;
 
       partnbr            = 1;                     /* Keep vertex in first place to preserve its part */
@@ -364,7 +378,7 @@ KgraphMapDfData * restrict const  loopptr)
           }
         }
         sorttab[partnbr].partval = partval;       /* Create new slot */
-        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? archDomDist (archptr, &grafptr->m.domntab[partcur], &grafptr->m.domntab[partval]) : 1;
+        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? kgraphDistVal (&loopptr->distdat, partcur, partval) : 1;
         sorttab[partnbr].diffval = diffval;
         sorttab[partnbr].edlosum = edloval;
         partnbr ++;
@@ -448,6 +462,10 @@ endloop1 : ;
       }
 
       difntax[vertnum].diffval = diffval;
+      diffdlt  = diffval - difotax[vertnum].diffval; /* Amounts of liquid are never negative */
+      varisum += (diffdlt < 0.0F) ? - diffdlt : diffdlt;
+      valusum += diffval;
+      moveval |= (sorttab[0].partval != partcur);
       if (dfplval != 0)
         difntax[vertnum].fdifval = diffval * sfplval / dfplval;
       else
@@ -460,6 +478,7 @@ endloop1 : ;
       Gnum                edgennd;
       Anum                partnbr;                /* Number of active parts */
       float               diffval;
+      float               diffdlt;
 
       partnbr = 1;                                /* Keep vertex in first place to preserve its part */
       sorttab[0].partval = domnnum;               /* Always keep initial part value                  */
@@ -520,8 +539,15 @@ endloop2 : ;
 
       difntax[vertnum].partval = domnnum;         /* Anchor part is always domain part */
       difntax[vertnum].diffval = diffval;
+      diffdlt  = diffval - difotax[vertnum].diffval;
+      varisum += (diffdlt < 0.0F) ? - diffdlt : diffdlt;
+      valusum += diffval;
     }
 
+    loopptr->thrdtab[thrdnum].varitab[passnum & 1] = varisum; /* Parity prevents overwriting by threads ahead */
+    loopptr->thrdtab[thrdnum].valutab[passnum & 1] = valusum;
+    loopptr->thrdtab[thrdnum].movetab[passnum & 1] = moveval;
+
     difttax = (KgraphMapDfVertex *) difntax;      /* Swap old and new diffusion arrays          */
     difntax = (KgraphMapDfVertex *) difotax;      /* Casts to prevent IBM compiler from yelling */
     difotax = (KgraphMapDfVertex *) difttax;
@@ -532,6 +558,22 @@ abort : ;                                         /* If overflow occured, resume
 
     if (loopptr->abrtval == 1)                    /* If all threads need to abort */
       break;
+
+    for (thrdtmp = 0, varisum = valusum = 0.0F, moveval = 0; /* All threads take the same decision */
+         thrdtmp < thrdnbr; thrdtmp ++) {
+      varisum += loopptr->thrdtab[thrdtmp].varitab[passnum & 1];
+      valusum += loopptr->thrdtab[thrdtmp].valutab[passnum & 1];
+      moveval |= loopptr->thrdtab[thrdtmp].movetab[passnum & 1];
+    }
+    if ((moveval == 0) &&                         /* If diffusion has converged, stop early */
+        (varisum <= (valusum * KGRAPHMAPDFCONVRAT))) {
+      passnum --;                                 /* Account for current pass               */
+      break;
+    }
+  }
+  if ((thrdnum == 0) && (loopptr->abrtval == 0)) {
+    loopptr->passnum = loopptr->passnbr - (int) passnum;
+    loopptr->passtim = clockGet () - passtim;
   }
 
   if (loopptr->abrtval == 0) {
@@ -566,6 +608,7 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
 
   const Gnum                domnnbr = grafptr->m.domnnbr;
   const Gnum                vertnbr = grafptr->s.vertnbr;
+  const int                 thrdnbr = contextThreadNbr (grafptr->contptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH1
   if ((grafptr->s.flagval & KGRAPHHASANCHORS) == 0) { /* Method valid only if graph has anchors */
@@ -579,7 +622,8 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
                      &loopdat.valotab, (size_t) (domnnbr * sizeof (Gnum)),
                      &loopdat.velstax, (size_t) (vertnbr * sizeof (Gnum)),
                      &loopdat.difntax, (size_t) (vertnbr * sizeof (KgraphMapDfVertex)),
-                     &loopdat.difotax, (size_t) (vertnbr * sizeof (KgraphMapDfVertex)), NULL) == NULL) {
+                     &loopdat.difotax, (size_t) (vertnbr * sizeof (KgraphMapDfVertex)),
+                     &loopdat.thrdtab, (size_t) (thrdnbr * sizeof (KgraphMapDfThread)), NULL) == NULL) {
     errorPrint ("kgraphMapDf: out of memory");
     return     (1);
   }
@@ -588,6 +632,9 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
   loopdat.difntax -= grafptr->s.baseval;
   loopdat.difotax -= grafptr->s.baseval;
   loopdat.passnbr  = paraptr->passnbr;
+  loopdat.passnum  = 0;                           /* In case of early abort */
+  loopdat.passtim  = 0.0;
+  kgraphDistInit (&loopdat.distdat, grafptr);     /* Cache distances between domains, if possible */
 
   loopdat.abrtval = 0;                            /* No one wants to abort yet */
 
@@ -597,8 +644,11 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
   kgraphMapDfLoop (NULL, &loopdat);
 #endif /* KGRAPHMAPDFNOTHREAD */
 
+  kgraphDistExit (&loopdat.distdat);
   memFree (loopdat.vanctab);                      /* Free group leader */
 
+  contextStatsPass (grafptr->contptr, (INT) loopdat.passnum, loopdat.passtim);
+
   kgraphFron (grafptr);
   kgraphCost (grafptr);
 
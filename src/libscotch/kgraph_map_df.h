@@ -1,4 +1,4 @@
-/* Copyright 2009-2012,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009-2012,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 22 dec 2009     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,6 +54,11 @@
 
 #define KGRAPHMAPDFEPSILON       (1.0F / (float) (GNUMMAX))
 
+/* Relative variation of diffusion values below
+   which diffusion is considered as converged. */
+
+#define KGRAPHMAPDFCONVRAT       (1.0F / 1024.0F)
+
 /*+ Sign masking operator. +*/
 
 #define KGRAPHMAPDFGNUMSGNMSK(i) ((Gnum) 0 - (((Gunum) (i)) >> (sizeof (Gnum) * 8 - 1)))
@@ -89,19 +94,31 @@ typedef struct KgraphMapDfSort_ {
   Gnum                      edlosum;              /*+ Sum of edge loads        +*/
 } KgraphMapDfSort;
 
+/*+ The thread-specific data block. +*/
+
+typedef struct KgraphMapDfThread_ {
+  float                     varitab[2];           /*+ Sum of variations of values; [2] for parity +*/
+  float                     valutab[2];           /*+ Sum of values                               +*/
+  int                       movetab[2];           /*+ Flag set if some vertex changed part        +*/
+} KgraphMapDfThread;
+
 /*+ The loop routine parameter
     structure. It contains the
     thread-independent data.   +*/
 
 typedef struct KgraphMapDfData_ {
-  const Kgraph *            grafptr;              /*+ Graph to work on           +*/
+  const Kgraph *            grafptr;              /*+ Graph to work on              +*/
   float *                   vanctab;
-  float *                   valotab;              /*+ Fraction of load to leak   +*/
-  Gnum *                    velstax;              /*+ Vertex edge load sum array +*/
-  KgraphMapDfVertex *       difntax;              /*+ New diffusion value array  +*/
-  KgraphMapDfVertex *       difotax;              /*+ Old diffusion value array  +*/
-  int                       passnbr;              /*+ Number of passes           +*/
-  volatile int              abrtval;              /*+ Abort value                +*/
+  float *                   valotab;              /*+ Fraction of load to leak      +*/
+  Gnum *                    velstax;              /*+ Vertex edge load sum array    +*/
+  KgraphMapDfVertex *       difntax;              /*+ New diffusion value array     +*/
+  KgraphMapDfVertex *       difotax;              /*+ Old diffusion value array     +*/
+  KgraphMapDfThread *       thrdtab;              /*+ Array of thread-specific data +*/
+  KgraphDist                distdat;              /*+ Domain distance cache         +*/
+  int                       passnbr;              /*+ Number of passes              +*/
+  int                       passnum;              /*+ Number of passes performed    +*/
+  double                    passtim;              /*+ Time spent in passes          +*/
+  volatile int              abrtval;              /*+ Abort value                   +*/
 } KgraphMapDfData;
 
 /*
@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -550,6 +550,7 @@ static
 int
 kgraphMapFmPartAdd2 (
 const Kgraph * restrict const       grafptr,
+const KgraphDist * restrict const   distptr,      /*+ Inter-domain distance cache        +*/
 KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array   +*/
 Gnum                                vexxidx,
 KgraphMapFmEdge * restrict * const  edxxtabptr,
@@ -575,7 +576,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   edxxidx = (*edxxnbrptr) ++;                     /* Allocate new slot */
 
   edxxtab[edxxidx].domnnum = domnend;             /* Set extended edge data */
-  edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+  edxxtab[edxxidx].distval = kgraphDistVal (distptr, domnnum, domnend);
   edxxtab[edxxidx].edlosum = edloval;
   edxxtab[edxxidx].edgenbr = 1;
   edxxtab[edxxidx].vexxidx = vexxidx;
@@ -584,7 +585,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   commgain = 0;                                   /* Compute commgain */
   for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
     commgain += edxxtab[edxxtmp].edlosum *
-                (archDomDist (archptr, &domntab[edxxtab[edxxtmp].domnnum], &domntab[domnend])
+                (kgraphDistVal (distptr, edxxtab[edxxtmp].domnnum, domnend)
                 - edxxtab[edxxtmp].distval);
   }
   commgain += (vexxtab[vexxidx].edlosum - edloval) * edxxtab[edxxidx].distval;
@@ -619,6 +620,7 @@ static
 int
 kgraphMapFmPartAdd (
 const Kgraph * restrict const               grafptr,
+const KgraphDist * restrict const           distptr,  /* Inter-domain distance cache */
 const Gnum                                  vertnum,
 const Gnum                                  vexxidx,  /* Hash value for insertion in vexxtab */
 KgraphMapFmVertex * restrict const          vexxtab,
@@ -680,7 +682,7 @@ KgraphMapFmTabl * restrict const            tablptr)
     domnend = edxxtab[edxxidx].domnnum;
     edxxtab[edxxidx].edlosum = 0;
     edxxtab[edxxidx].edgenbr = 0;
-    edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+    edxxtab[edxxidx].distval = kgraphDistVal (distptr, domnnum, domnend);
   }
 
   commload = 0;                                   /* Load associated with vertex edges */
@@ -718,7 +720,7 @@ KgraphMapFmTabl * restrict const            tablptr)
       edxxtab[edxxidx].cmiggain = 0;
       edxxtab[edxxidx].cmigmask = (parotax != NULL) ? ~0 : 0;
       edxxtab[edxxidx].domnnum  = domnend;
-      edxxtab[edxxidx].distval  = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      edxxtab[edxxidx].distval  = kgraphDistVal (distptr, domnnum, domnend);
       edxxtab[edxxidx].edlosum  = 0;
       edxxtab[edxxidx].edgenbr  = 0;
       edxxtab[edxxidx].vexxidx  = vexxidx;
@@ -751,7 +753,7 @@ KgraphMapFmTabl * restrict const            tablptr)
 
       domnend = edxxtab[edxxtmp].domnnum;
       commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
-                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
+                  kgraphDistVal (distptr, domncur, domnend);
     }
     commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
     edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
@@ -981,10 +983,12 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   Gnum                            mswpnum;        /* Current number of recording sweep              */
   Gnum                            vertnum;
   Gnum                            hashsiz;        /* Size of hash table                             */
-  Gnum                            hashmsk;        /* Mask for access to hash table                  */
+  Gnum                            hashmsk;        /* Mask for access to hash table, or last index   */
   Gnum                            hashnum;        /* Hash value                                     */
   Gnum                            hashmax;        /* Maximum number of entries in vertex hash table */
   Gnum                            hashnbr;        /* Current number of entries in vertex hash table */
+  int                             hashflag;       /* Set if vertex array is directly indexed        */
+  KgraphDist                      distdat;        /* Inter-domain distance cache                    */
 #ifdef SCOTCH_DEBUG_KGRAPH3
   Gnum *                          chektab;        /* Extra memory needed for the check routine      */
 #endif /* SCOTCH_DEBUG_KGRAPH3 */
@@ -993,9 +997,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   const Gnum * restrict const     vendtax = grafptr->s.vendtax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Arch * restrict const     archptr = grafptr->m.archptr;
   const Gnum                      domnnbr = grafptr->m.domnnbr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
   Anum * restrict const           parttax = grafptr->m.parttax;
   Anum * restrict const           parotax = grafptr->r.m.parttax;
   const Gnum * restrict const     pfixtax = grafptr->pfixtax;
@@ -1058,6 +1060,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     }
   }
 
+  kgraphDistInit (&distdat, grafptr);             /* Cache inter-domain distances if worth it */
+
 #ifdef SCOTCH_DEBUG_KGRAPH2                       /* Allocation of extended vertex hash table and extended edge array */
   hashnbr = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
   savesiz = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
@@ -1073,12 +1077,22 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     edxxsiz = grafptr->s.edgenbr;
 
   for (hashsiz = 256; hashsiz < hashnbr; hashsiz <<= 1) ; /* Get upper power of two */
-  hashmsk = hashsiz - 1;
-  hashmax = hashsiz >> 2;
+  hashflag = (((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) || /* If band graph, or if hash table would be bigger than graph */
+              (hashsiz >= grafptr->s.vertnbr)) ? 1 : 0;
+  if (hashflag != 0) {                            /* Index vertex array directly by vertex number, without hashing nor resizing */
+    hashsiz = grafptr->s.vertnbr;
+    hashmsk = hashsiz - 1;                        /* Mask is last valid index */
+    hashmax = hashsiz + 1;                        /* Array can never be full  */
+  }
+  else {
+    hashmsk = hashsiz - 1;
+    hashmax = hashsiz >> 2;
+  }
 
-  if (kgraphMapFmTablInit (tablptr) != 0) {
+  if (kgraphMapFmTablInit (tablptr, grafptr->contptr) != 0) {
     errorPrint ("kgraphMapFm: internal error (1)"); /* Unable to do proper initialization */
-    kgraphMapFmTablExit (tablptr);
+    kgraphMapFmTablExit (tablptr, grafptr->contptr);
+    kgraphDistExit (&distdat);
     return (1);
   }
   else {
@@ -1086,7 +1100,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         ((savetab = memAlloc ((size_t) savesiz * sizeof (KgraphMapFmSave)))   == NULL) ||
         ((edxxtab = memAlloc ((size_t) edxxsiz * sizeof (KgraphMapFmEdge)))   == NULL)) {
       errorPrint ("kgraphMapFm: out of memory (4)");
-      kgraphMapFmTablExit (tablptr);
+      kgraphMapFmTablExit (tablptr, grafptr->contptr);
+      kgraphDistExit (&distdat);
       return (1);
     }
   }
@@ -1098,7 +1113,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     if (kgraphMapFmResize (&vexxtab, &hashmax, &hashmsk, savetab, 0, tablptr, edxxtab, &lockptr) != 0) {
       errorPrint ("kgraphMapFm: out of memory (5)");
       memFree    (vexxtab);                       /* Free group leader */
-      kgraphMapFmTablExit (tablptr);
+      kgraphMapFmTablExit (tablptr, grafptr->contptr);
+      kgraphDistExit (&distdat);
       return (1);
     }
   }
@@ -1109,9 +1125,12 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
     vertnum = grafptr->frontab[fronnum];
     if ((pfixtax == NULL) || (pfixtax[vertnum] == -1)) { /* Add only not fixed vertices */
-      for (hashnum = (vertnum * KGRAPHMAPFMHASHPRIME) & hashmsk; vexxtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
+      if (hashflag != 0)
+        hashnum = vertnum - grafptr->s.baseval;
+      else
+        for (hashnum = (vertnum * KGRAPHMAPFMHASHPRIME) & hashmsk; vexxtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
 
-      kgraphMapFmPartAdd (grafptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+      kgraphMapFmPartAdd (grafptr, &distdat, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
       if (vexxtab[hashnum].edxxidx == -1) {       /* If vertex does not have any neighbor */
@@ -1413,7 +1432,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         }
         edxxtab[edxxidx].commgain -= edxxptr->commgain;
         edxxtab[edxxidx].cmiggain -= edxxptr->cmiggain;
-        edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnend], &domntab[domncur]);
+        edxxtab[edxxidx].distval = kgraphDistVal (&distdat, domnend, domncur);
       }
       edxxptr->commgain = - edxxptr->commgain;
       edxxptr->cmiggain = - edxxptr->cmiggain;
@@ -1474,15 +1493,18 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           if (kgraphMapFmResize (&vexxtab, &hashmax, &hashmsk, savetab, savenbr, tablptr, edxxtab, &lockptr) != 0) {
             errorPrint ("kgraphMapFm: out of memory (7)");
             memFree    (vexxtab);                 /* Free group leader */
-            kgraphMapFmTablExit (tablptr);
+            kgraphMapFmTablExit (tablptr, grafptr->contptr);
             return       (1);
           }
         }
-        for (vexxend = (vertend * KGRAPHMAPFMHASHPRIME) & hashmsk; /* Search for vertex or first free slot */
-             (vexxtab[vexxend].vertnum != vertend) && (vexxtab[vexxend].vertnum != ~0); vexxend = (vexxend + 1) & hashmsk) ;
+        if (hashflag != 0)                        /* If vertex array is directly indexed */
+          vexxend = vertend - grafptr->s.baseval;
+        else
+          for (vexxend = (vertend * KGRAPHMAPFMHASHPRIME) & hashmsk; /* Search for vertex or first free slot */
+               (vexxtab[vexxend].vertnum != vertend) && (vexxtab[vexxend].vertnum != ~0); vexxend = (vexxend + 1) & hashmsk) ;
 
         if (vexxtab[vexxend].vertnum == ~0) {     /* If neighbor vertex not yet inserted, create it */
-          kgraphMapFmPartAdd (grafptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+          kgraphMapFmPartAdd (grafptr, &distdat, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
           hashnbr ++;                             /* One more vertex in hash table */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           if (vexxtab[vexxend].edxxidx == -1) {
@@ -1619,7 +1641,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Gnum        edxxidx;
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-          kgraphMapFmPartAdd2 (grafptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
+          kgraphMapFmPartAdd2 (grafptr, &distdat, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           for (edxxidx = vexxtab[vexxend].edxxidx; (edxxidx != -1) && (edxxtab[edxxidx].domnnum != domnend); edxxidx = edxxtab[edxxidx].edxxidx) ;
           if (edxxidx == -1) {
@@ -1653,8 +1675,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
         edloval *= grafptr->r.crloval;
         for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) /* Update vertex links */
-           edxxtab[edxxend].commgain -= edloval * (divnval - archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnend])
-                                                 - divoval + archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnnum]));
+           edxxtab[edxxend].commgain -= edloval * (divnval - kgraphDistVal (&distdat, edxxtab[edxxend].domnnum, domnend)
+                                                 - divoval + kgraphDistVal (&distdat, edxxtab[edxxend].domnnum, domnnum));
         if (vexxtab[vexxend].lockptr == NULL) { /* If vertex is not locked */
           for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) { /* Relink its extended edges */
             kgraphMapFmTablDel (tablptr, &edxxtab[edxxend]); /* Remove it and re-link it                            */
@@ -1772,7 +1794,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Anum              distval;
           Gnum              edloval;
 
-          distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+          distval = (domnend != domnlst) ? kgraphDistVal (&distdat, domnnum, domnend) : distlst;
           distlst = distval;
           domnlst = domnend;
           edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1811,7 +1833,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
             Anum              distval;
             Gnum              edloval;
 
-            distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+            distval = (domnend != domnlst) ? kgraphDistVal (&distdat, domnnum, domnend) : distlst;
             distlst = distval;
             domnlst = domnend;
             edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1838,7 +1860,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   memFree (vexxtab);
   memFree (savetab);
   memFree (edxxtab);
-  kgraphMapFmTablExit (tablptr);
+  kgraphMapFmTablExit (tablptr, grafptr->contptr);
+  kgraphDistExit (&distdat);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
   if (kgraphCheck (grafptr) != 0) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2016,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2016,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,6 +48,8 @@
 /**                                 to   : 12 oct 2006     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -179,11 +181,11 @@ int                         kgraphMapFm         (Kgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define kgraphMapFmTablInit(t)      (((*(t)) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS)) == NULL)
+#define kgraphMapFmTablInit(t,c)    (((*(t)) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS, (c))) == NULL)
 #define kgraphMapFmTablFree(t)      gainTablFree (*(t))
-#define kgraphMapFmTablExit(t)      do {                     \
-                                      if (*(t) != NULL)      \
-                                        gainTablExit (*(t)); \
+#define kgraphMapFmTablExit(t,c)    do {                          \
+                                      if (*(t) != NULL)           \
+                                        gainTablExit (*(t), (c)); \
                                     } while (0)
 #define kgraphMapFmTablAdd(t,e)     gainTablAdd ((*(t)), &(e)->gainlink, ((e)->commgain + (((e)->cmiggain) & ((e)->cmigmask))) * (e)->distval)
 #define kgraphMapFmTablDel(t,e)     gainTablDel ((*(t)), &(e)->gainlink)
@@ -191,9 +193,9 @@ int                         kgraphMapFm         (Kgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define kgraphMapFmTablInit(t)      (fiboHeapInit ((t), kgraphMapFmCmpFunc))
+#define kgraphMapFmTablInit(t,c)    (fiboHeapInit ((t), kgraphMapFmCmpFunc))
 #define kgraphMapFmTablFree(t)      fiboHeapFree (t)
-#define kgraphMapFmTablExit(t)      fiboHeapExit (t)
+#define kgraphMapFmTablExit(t,c)    fiboHeapExit (t)
 #define kgraphMapFmTablAdd(t,e)     fiboHeapAdd ((t), &(e)->gainlink)
 #define kgraphMapFmTablDel(t,e)     fiboHeapDel ((t), &(e)->gainlink)
 
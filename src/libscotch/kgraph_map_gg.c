@@ -0,0 +1,319 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_gg.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a k-way mapping    **/
+/**                of a graph by growing all of its parts  **/
+/**                one after the other, without resorting  **/
+/**                to recursive bipartitioning of the      **/
+/**                graph.                                  **/
+/**                                                        **/
+/**   NOTES      : # The terminal domains of the initial   **/
+/**                  domain are enumerated by recursive    **/
+/**                  bipartitioning of the architecture    **/
+/**                  only, so that domains which are next  **/
+/**                  to each other in the enumeration are  **/
+/**                  also close in the target topology.    **/
+/**                # Each part is grown from a vertex      **/
+/**                  adjacent to the previous part, by     **/
+/**                  adding the vertex which least         **/
+/**                  increases the cut, until the part     **/
+/**                  reaches its cumulative target load.   **/
+/**                  This method is meant to provide an    **/
+/**                  initial mapping at the coarsest level **/
+/**                  of a multilevel scheme, the result of **/
+/**                  which is refined at the upper levels. **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KGRAPH_MAP_GG
+
+#include "module.h"
+#include "common.h"
+#include "gain.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "parser.h"
+#include "kgraph.h"
+#include "kgraph_map_gg.h"
+#include "kgraph_map_st.h"
+
+/************************************/
+/*                                  */
+/* The domain enumeration routines. */
+/*                                  */
+/************************************/
+
+/* This routine fills the given domain array
+** with the terminal domains of the given
+** domain, in recursive bipartitioning order.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapGgDomn (
+const Arch * restrict const     archptr,
+const ArchDom * restrict const  domnptr,
+ArchDom * restrict const        domntab,
+Anum * restrict const           domnnbrptr)
+{
+  ArchDom             domnsubtab[2];
+
+  if ((archDomSize (archptr, domnptr) <= 1) ||    /* If domain is terminal */
+      (archDomBipart (archptr, domnptr, &domnsubtab[0], &domnsubtab[1]) != 0)) {
+    domntab[(*domnnbrptr) ++] = *domnptr;
+    return;
+  }
+
+  kgraphMapGgDomn (archptr, &domnsubtab[0], domntab, domnnbrptr);
+  kgraphMapGgDomn (archptr, &domnsubtab[1], domntab, domnnbrptr);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the k-way
+** greedy graph growing mapping.
+** It returns:
+** - 0 : if the mapping could be computed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapGg (
+Kgraph * restrict const         grafptr,          /*+ Active graph      +*/
+const KgraphMapGgParam * const  paraptr)          /*+ Method parameters +*/
+{
+  KgraphDist                    distdat;          /* Inter-domain distance cache          */
+  GainTabl * restrict           tablptr;          /* Gain table of part being grown       */
+  KgraphMapGgVertex * restrict  vexxtax;          /* Extended vertex array                */
+  Gnum * restrict               loadtab;          /* Cumulative target loads of parts     */
+  Anum * restrict               savetax;          /* Best part array found so far, if any */
+  Gnum                          commloadbst;
+  double                        domnwght;
+  double                        domnwghtsum;
+  Anum                          domnnbr;
+  Anum                          domnnum;
+  INT                           passnum;
+
+  const Gnum * restrict const   verttax = grafptr->s.verttax;
+  const Gnum * restrict const   vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const   velotax = grafptr->s.velotax;
+  const Gnum * restrict const   edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const   edlotax = grafptr->s.edlotax;
+  const Arch * restrict const   archptr = grafptr->m.archptr;
+  const Gnum                    baseval = grafptr->s.baseval;
+  const Gnum                    vertnnd = grafptr->s.vertnnd;
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) { /* Method cannot be applied to band graphs */
+    errorPrint ("kgraphMapGg: cannot apply to band graphs");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  if ((archVar (archptr) != 0) ||                 /* If terminal domains cannot be enumerated */
+      (grafptr->pfixtax != NULL)) {               /* Or if fixed vertices have to be handled  */
+    Strat *             stratptr;
+    int                 o;
+
+    stratptr = stratInit (&kgraphmapststratab, "r{sep=h{pass=10}}"); /* Use a standard algorithm */
+    o = kgraphMapSt (grafptr, stratptr);
+    stratExit (stratptr);
+    return (o);
+  }
+
+  if (mapAlloc (&grafptr->m) != 0) {
+    errorPrint ("kgraphMapGg: cannot allocate mapping arrays");
+    return (1);
+  }
+  domnnbr = 0;
+  kgraphMapGgDomn (archptr, &grafptr->domnorg, grafptr->m.domntab, &domnnbr);
+  grafptr->m.domnnbr = domnnbr;
+
+  if (memAllocGroup ((void **) (void *)
+                     &vexxtax, (size_t) (grafptr->s.vertnbr * sizeof (KgraphMapGgVertex)),
+                     &savetax, (size_t) ((paraptr->passnbr > 1) ? (grafptr->s.vertnbr * sizeof (Anum)) : 0),
+                     &loadtab, (size_t) (domnnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphMapGg: out of memory (1)");
+    return (1);
+  }
+  if ((tablptr = gainTablInit (GAIN_LINMAX, KGRAPHMAPGGGAINTABLSUBBITS, grafptr->contptr)) == NULL) {
+    errorPrint ("kgraphMapGg: out of memory (2)");
+    memFree    (vexxtax);                         /* Free group leader */
+    return (1);
+  }
+  vexxtax -= baseval;
+  savetax  = (paraptr->passnbr > 1) ? (savetax - baseval) : NULL;
+
+  for (domnnum = 0, domnwghtsum = 0.0; domnnum < domnnbr; domnnum ++)
+    domnwghtsum += (double) archDomWght (archptr, &grafptr->m.domntab[domnnum]);
+  for (domnnum = 0, domnwght = 0.0; domnnum < domnnbr; domnnum ++) { /* Compute cumulative target loads to avoid drift */
+    domnwght += (double) archDomWght (archptr, &grafptr->m.domntab[domnnum]);
+    loadtab[domnnum] = (Gnum) ((double) grafptr->s.velosum * (domnwght / domnwghtsum) + 0.5);
+  }
+
+  kgraphDistInit (&distdat, grafptr);
+
+  commloadbst = GNUMMAX;
+  for (passnum = 0; passnum < paraptr->passnbr; passnum ++) { /* For all passes */
+    Gnum                vertnum;
+    Gnum                vertscn;                  /* Scan index for finding new seed vertices */
+    Gnum                compload;                 /* Load of all parts grown so far           */
+    Gnum                commload;
+
+    Anum * restrict const parttax = grafptr->m.parttax;
+
+    for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+      parttax[vertnum]         = -1;              /* All vertices are free */
+      vexxtax[vertnum].tablnum = -1;
+    }
+
+    vertnum  = baseval + contextIntRandVal (grafptr->contptr, grafptr->s.vertnbr); /* Randomly select first seed vertex */
+    vertscn  = baseval;
+    compload = 0;
+    commload = 0;
+    for (domnnum = 0; domnnum < domnnbr; domnnum ++) { /* Grow parts one after the other */
+      const Gnum          loadmax = loadtab[domnnum];
+      const int           lastflag = (domnnum == (domnnbr - 1)); /* Last part takes all remaining vertices */
+
+      gainTablFree (tablptr);                     /* Links of previous part become stale */
+      while (1) {
+        Gnum                veloval;
+        Gnum                edgenum;
+
+        if (vertnum == -1) {                      /* If no frontier vertex to add, get new seed */
+          while ((vertscn < vertnnd) && (parttax[vertscn] != -1))
+            vertscn ++;
+          if (vertscn >= vertnnd)                 /* If no free vertex left */
+            break;
+          vertnum = vertscn;
+        }
+
+        veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+        if ((lastflag == 0) && (veloval > 0) &&   /* If adding vertex would not improve balance, keep it as next seed */
+            (abs (compload + veloval - loadmax) >= abs (compload - loadmax)))
+          break;
+
+        if (vexxtax[vertnum].tablnum == domnnum)  /* If vertex is linked in current table */
+          gainTablDel (tablptr, &vexxtax[vertnum].gainlink);
+        parttax[vertnum] = domnnum;
+        compload += veloval;
+
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          Gnum                vertend;
+          Anum                partend;
+          Gnum                edloval;
+
+          vertend = edgetax[edgenum];
+          partend = parttax[vertend];
+          edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+          if (partend == -1) {                    /* If neighbor is free */
+            if (vexxtax[vertend].tablnum == domnnum) { /* If already linked, update its gain */
+              gainTablDel (tablptr, &vexxtax[vertend].gainlink);
+              vexxtax[vertend].commgain -= 2 * edloval;
+            }
+            else {                                /* Else compute its gain with respect to current part */
+              Gnum                edgeend;
+              Gnum                commgain;
+
+              for (edgeend = verttax[vertend], commgain = 0;
+                   edgeend < vendtax[vertend]; edgeend ++) {
+                Anum                partngb;
+
+                partngb = parttax[edgetax[edgeend]];
+                if (partngb == -1)
+                  commgain += (edlotax != NULL) ? edlotax[edgeend] : 1;
+                else if (partngb == domnnum)
+                  commgain -= (edlotax != NULL) ? edlotax[edgeend] : 1;
+              }
+              vexxtax[vertend].commgain = commgain;
+              vexxtax[vertend].tablnum  = domnnum;
+            }
+            gainTablAdd (tablptr, &vexxtax[vertend].gainlink, vexxtax[vertend].commgain);
+          }
+          else if (partend != domnnum)            /* If neighbor already belongs to another part */
+            commload += edloval * (Gnum) kgraphDistVal (&distdat, domnnum, partend);
+        }
+
+        vertnum = -1;                             /* Get best frontier vertex, if any */
+        {
+          GainLink *          linkptr;
+
+          if ((linkptr = gainTablFrst (tablptr)) != NULL)
+            vertnum = (Gnum) ((KgraphMapGgVertex *) linkptr - vexxtax); /* TRICK: gain link is FIRST */
+        }
+      }
+    }
+
+    if (commload < commloadbst) {                 /* If better mapping found, keep it */
+      commloadbst = commload;
+      if (savetax != NULL)
+        memCpy (savetax + baseval, parttax + baseval, grafptr->s.vertnbr * sizeof (Anum));
+    }
+  }
+  if (savetax != NULL)                            /* Restore best mapping found */
+    memCpy (grafptr->m.parttax + baseval, savetax + baseval, grafptr->s.vertnbr * sizeof (Anum));
+
+  kgraphDistExit (&distdat);
+  gainTablExit   (tablptr, grafptr->contptr);
+  memFree (vexxtax + baseval);                    /* Free group leader */
+
+  kgraphFron (grafptr);
+  kgraphCost (grafptr);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapGg: inconsistent graph data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2010,2011,2012,2014,2015,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 25 feb 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 19 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -101,8 +101,10 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
   *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
-  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr, paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
-                    finegrafptr->r.m.parttax, finepfixtax, finegrafptr->vfixnbr, finegrafptr->contptr) != 0)
+  if (graphCoarsenCache (&finegrafptr->s, &coargrafptr->s, coarmultptr, paraptr->coarnbr, paraptr->coarval,
+                         GRAPHCOARSENNOCOMPACT | graphCoarsenTypeFlag (paraptr->typeval),
+                         finegrafptr->r.m.parttax, finepfixtax, finegrafptr->vfixnbr,
+                         finegrafptr->levlnum, finegrafptr->contptr) != 0) /* Re-use cached hierarchy, if any */
     return (1);
 
   coargrafptr->domnorg = finegrafptr->domnorg;    /* Keep initial domain */
@@ -409,7 +411,9 @@ const KgraphMapMlParam * const  paraptr)          /*+ Method parameters +*/
 
   levlnum = grafptr->levlnum;                     /* Save graph level            */
   grafptr->levlnum = 0;                           /* Initialize coarsening level */
+  graphCoarsenCacheEnter (grafptr->contptr);      /* Nested calls must not use cached levels */
   o = kgraphMapMl2 (grafptr, paraptr);            /* Perform multi-level mapping */
+  graphCoarsenCacheLeave (grafptr->contptr);
   grafptr->levlnum = levlnum;                     /* Restore graph level         */
 
   return (o);
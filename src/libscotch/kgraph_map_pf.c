@@ -0,0 +1,597 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_pf.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a k-way mapping by  **/
+/**                moving frontier vertices in rounds of   **/
+/**                concurrent gain computations, in the    **/
+/**                spirit of the Fiduccia-Mattheyses       **/
+/**                heuristic.                              **/
+/**                                                        **/
+/**   NOTES      : # Every pass, threads compute in        **/
+/**                  parallel, for the frontier vertices   **/
+/**                  of their own vertex range, the best   **/
+/**                  neighbor domain to move to, using     **/
+/**                  the distances between domains. Only   **/
+/**                  moves which decrease the cost, or     **/
+/**                  which reduce a broken balance, are    **/
+/**                  kept as candidates.                   **/
+/**                # Candidates which have a better-ranked **/
+/**                  candidate neighbor are dropped, so    **/
+/**                  that the remaining moves form an      **/
+/**                  independent set and their gains are   **/
+/**                  exact. These conflict-free moves are  **/
+/**                  then applied in ascending gain order, **/
+/**                  as long as balance is preserved.      **/
+/**                # Since the cost, or else the load      **/
+/**                  excess, strictly decreases at every   **/
+/**                  pass, no rollback is needed.          **/
+/**                # Fixed vertices and anchor vertices    **/
+/**                  are never moved.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_pf.h"
+
+/************************************/
+/*                                  */
+/* The threaded reduction routines. */
+/*                                  */
+/************************************/
+
+#ifndef KGRAPHMAPPFNOTHREAD
+static
+void
+kgraphMapPfScan (
+KgraphMapPfThread * restrict const  blocptr,      /* Pointer to local block  */
+KgraphMapPfThread * restrict const  bremptr,      /* Pointer to remote block */
+const int                           srcpval,      /* Source phase value      */
+const int                           dstpval,      /* Destination phase value */
+const void * const                  globptr)      /* Unused                  */
+{
+  blocptr->fronnnd[dstpval] = blocptr->fronnnd[srcpval] + ((bremptr != NULL) ? bremptr->fronnnd[srcpval] : 0);
+}
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+/**********************************/
+/*                                */
+/* The gain and balance routines. */
+/*                                */
+/**********************************/
+
+/* This routine computes the load excess of
+** a domain, that is, the amount by which
+** its imbalance exceeds the allowed one.
+** It returns:
+** - the load excess, in all cases.
+*/
+
+static
+Gnum
+kgraphMapPfExcs (
+const Gnum                  comploaddlt,
+const Gnum                  comploadmax)
+{
+  Gnum                comploadabs;
+
+  comploadabs = ABS (comploaddlt);
+  return ((comploadabs > comploadmax) ? (comploadabs - comploadmax) : 0);
+}
+
+/* This routine tells whether moving a vertex
+** of given load between two domains is allowed
+** by the balance constraint, that is, if it
+** keeps the imbalance of each domain within
+** bounds, or at least does not worsen it.
+** It returns:
+** - 1  : if the move is allowed.
+** - 0  : else.
+*/
+
+static
+int
+kgraphMapPfBal (
+const Gnum * restrict const comploaddlt,
+const Gnum * restrict const comploadmax,
+const Anum                  domnnum,              /*+ Source domain      +*/
+const Anum                  domnend,              /*+ Destination domain +*/
+const Gnum                  veloval)              /*+ Vertex load        +*/
+{
+  Gnum                deltvalold;
+  Gnum                deltvalnew;
+
+  deltvalold = ABS (comploaddlt[domnnum] - veloval);
+  deltvalnew = ABS (comploaddlt[domnend] + veloval);
+  return ((((deltvalold <= comploadmax[domnnum]) || (deltvalold < ABS (comploaddlt[domnnum]))) &&
+           ((deltvalnew <= comploadmax[domnend]) || (deltvalnew < ABS (comploaddlt[domnend])))) ? 1 : 0);
+}
+
+/* This routine computes the migration cost
+** of placing the given vertex in the given
+** domain, when repartitioning.
+** It returns:
+** - the migration cost, in all cases.
+*/
+
+static
+Gnum
+kgraphMapPfMigr (
+const Kgraph * restrict const   grafptr,
+const Gnum                      vertnum,
+const ArchDom * restrict const  domoptr,          /*+ Old domain of vertex +*/
+const Anum                      domnnum)
+{
+  const ArchDom * restrict const  domnptr = &grafptr->m.domntab[domnnum];
+
+  if (archDomIncl (grafptr->m.archptr, domnptr, domoptr) == 1)
+    return (0);
+
+  return (grafptr->r.cmloval * ((grafptr->r.vmlotax != NULL) ? grafptr->r.vmlotax[vertnum] : 1) *
+          (Gnum) archDomDist (grafptr->m.archptr, domnptr, domoptr));
+}
+
+/* This routine computes the best move of
+** the given vertex to one of the domains of
+** its neighbors, with respect to the current
+** state of the part array. Only moves which
+** decrease the cost function, or which
+** decrease the load excess when they do not,
+** are considered.
+** It returns:
+** - 1  : if a move has been found.
+** - 0  : if no move is possible.
+*/
+
+static
+int
+kgraphMapPfMove (
+const KgraphMapPfData * restrict const  loopptr,
+const Gnum                              vertnum,
+Anum * restrict const                   dngbtab,  /*+ Scratch array of neighbor domains      +*/
+Gnum * restrict const                   edngtab,  /*+ Scratch array of neighbor edge loads   +*/
+Gnum * restrict const                   gainptr,  /*+ Pointer to gain of best move           +*/
+Anum * restrict const                   domnptr)  /*+ Pointer to destination domain of move  +*/
+{
+  const ArchDom *     domoptr;                    /* Domain in old mapping, if any    */
+  Gnum                edgenum;
+  Gnum                edlointn;                   /* Edge load towards own domain     */
+  Gnum                veloval;
+  Gnum                costorg;                    /* Cost of vertex in current domain */
+  Gnum                gainbst;
+  Gnum                excsbst;
+  Anum                dngbnbr;
+  Anum                dngbnum;
+  Anum                dngblst;                    /* Index of last neighbor domain found */
+  Anum                domnnum;
+  Anum                domnbst;
+
+  const Kgraph * restrict const   grafptr = loopptr->grafptr;
+  const Gnum * restrict const     verttax = grafptr->s.verttax;
+  const Gnum * restrict const     vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const     edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const     edlotax = grafptr->s.edlotax;
+  const KgraphDist * restrict const distptr = &loopptr->distdat;
+  const Anum * restrict const     parttax = grafptr->m.parttax;
+  const Anum * restrict const     parotax = grafptr->r.m.parttax;
+  const Gnum * restrict const     comploaddlt = loopptr->comploaddlt;
+  const Gnum * restrict const     comploadmax = loopptr->comploadmax;
+
+  domnnum  = parttax[vertnum];
+  edlointn = 0;
+  for (edgenum = verttax[vertnum], dngbnbr = 0, dngblst = 0; /* Aggregate edge loads per neighbor domain */
+       edgenum < vendtax[vertnum]; edgenum ++) {
+    Anum                domnend;
+    Gnum                edloval;
+
+    domnend = parttax[edgetax[edgenum]];
+    edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+    if (domnend == domnnum) {
+      edlointn += edloval;
+      continue;
+    }
+    if ((dngblst >= dngbnbr) || (dngbtab[dngblst] != domnend)) { /* If not same domain as last one, search it */
+      for (dngblst = 0; (dngblst < dngbnbr) && (dngbtab[dngblst] != domnend); dngblst ++) ;
+      if (dngblst == dngbnbr) {                   /* If new neighbor domain */
+        dngbtab[dngbnbr]   = domnend;
+        edngtab[dngbnbr ++] = 0;
+      }
+    }
+    edngtab[dngblst] += edloval;
+  }
+  if (dngbnbr == 0)                               /* If vertex does not belong to frontier */
+    return (0);
+
+  veloval = (grafptr->s.velotax != NULL) ? grafptr->s.velotax[vertnum] : 1;
+
+  domoptr = NULL;
+  if (parotax != NULL) {                          /* If we are doing a repartitioning */
+    Gnum                vertold;
+
+    vertold = ((grafptr->s.vnumtax != NULL) &&    /* Get vertex number in original graph, if not a band graph */
+               ((grafptr->s.flagval & KGRAPHHASANCHORS) == 0)) ? grafptr->s.vnumtax[vertnum] : vertnum;
+    if (parotax[vertold] != -1)                   /* If vertex was mapped to an old domain */
+      domoptr = mapDomain (&grafptr->r.m, vertold);
+  }
+
+  for (dngbnum = 0, costorg = 0; dngbnum < dngbnbr; dngbnum ++)
+    costorg += edngtab[dngbnum] * (Gnum) kgraphDistVal (distptr, domnnum, dngbtab[dngbnum]);
+
+  gainbst = GNUMMAX;
+  excsbst = 0;
+  domnbst = -1;
+  for (dngbnum = 0; dngbnum < dngbnbr; dngbnum ++) { /* For all candidate destination domains */
+    Anum                domnend;
+    Anum                dngbtmp;
+    Gnum                costend;
+    Gnum                gainval;
+    Gnum                excsval;
+
+    domnend = dngbtab[dngbnum];
+    if (kgraphMapPfBal (comploaddlt, comploadmax, domnnum, domnend, veloval) == 0)
+      continue;
+
+    for (dngbtmp = 0, costend = edlointn * (Gnum) kgraphDistVal (distptr, domnend, domnnum);
+         dngbtmp < dngbnbr; dngbtmp ++) {
+      if (dngbtmp != dngbnum)
+        costend += edngtab[dngbtmp] * (Gnum) kgraphDistVal (distptr, domnend, dngbtab[dngbtmp]);
+    }
+    gainval = (costend - costorg) * grafptr->r.crloval;
+    if (domoptr != NULL)
+      gainval += kgraphMapPfMigr (grafptr, vertnum, domoptr, domnend) -
+                 kgraphMapPfMigr (grafptr, vertnum, domoptr, domnnum);
+
+    excsval = kgraphMapPfExcs (comploaddlt[domnnum] - veloval, comploadmax[domnnum]) - /* Variation of load excess */
+              kgraphMapPfExcs (comploaddlt[domnnum],           comploadmax[domnnum]) +
+              kgraphMapPfExcs (comploaddlt[domnend] + veloval, comploadmax[domnend]) -
+              kgraphMapPfExcs (comploaddlt[domnend],           comploadmax[domnend]);
+    if ((gainval >= 0) && (excsval >= 0))         /* Keep only moves which improve cost or balance */
+      continue;
+
+    if ((gainval < gainbst) ||
+        ((gainval == gainbst) && (excsval < excsbst))) {
+      gainbst = gainval;
+      excsbst = excsval;
+      domnbst = domnend;
+    }
+  }
+  if (domnbst < 0)
+    return (0);
+
+  *gainptr = gainbst;
+  *domnptr = domnbst;
+  return (1);
+}
+
+/******************************/
+/*                            */
+/* The threaded loop routine. */
+/*                            */
+/******************************/
+
+/* This routine performs the refinement
+** passes on the given part of the k-way
+** graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapPfLoop (
+ThreadDescriptor * restrict const   descptr,
+KgraphMapPfData * restrict const    loopptr)
+{
+  Gnum * restrict     movetab;                    /* Local sub-array of move triplets  */
+  Gnum                movenbr;                    /* Number of local candidate moves   */
+  Gnum                movenum;
+  Gnum                movetmp;
+  Gnum                vertbas;                    /* Start index of vertex range       */
+  Gnum                vertnnd;                    /* End index of vertex range         */
+  Gnum                vmovnnd;                    /* End index of movable vertex range */
+  Gnum                vertnum;
+  Gnum                fronnbr;                    /* Local number of frontier vertices */
+  Gnum                commload;
+  Gnum                passnum;
+
+#ifndef KGRAPHMAPPFNOTHREAD
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+#else /* KGRAPHMAPPFNOTHREAD */
+  const int                           thrdnbr = 1;
+  const int                           thrdnum = 0;
+#endif /* KGRAPHMAPPFNOTHREAD */
+  Kgraph * restrict const             grafptr = loopptr->grafptr;
+  const Gnum * restrict const         verttax = grafptr->s.verttax;
+  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Anum * restrict const         pfixtax = grafptr->pfixtax;
+  const KgraphDist * restrict const   distptr = &loopptr->distdat;
+  Anum * restrict const               parttax = grafptr->m.parttax;
+  Gnum * restrict const               gaintax = loopptr->gaintax;
+  Gnum * restrict const               passtax = loopptr->passtax;
+  Anum * restrict const               dngbtab = loopptr->dngbtab + thrdnum * grafptr->s.degrmax;
+  Gnum * restrict const               edngtab = loopptr->edngtab + thrdnum * grafptr->s.degrmax;
+  const Gnum                          baseval = grafptr->s.baseval;
+  const Gnum                          vertnbr = grafptr->s.vertnbr;
+
+  vertbas = baseval + DATASCAN (vertnbr, thrdnbr, thrdnum); /* Compute bounds of each thread */
+  vertnnd = baseval + DATASCAN (vertnbr, thrdnbr, (thrdnum + 1));
+  vmovnnd = MIN (vertnnd, loopptr->vertnnd);      /* Anchor vertices, if any, are not movable */
+  movetab = loopptr->movetab + 3 * (vertbas - baseval);
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* No vertex is a candidate yet */
+    passtax[vertnum] = 0;
+
+  for (passnum = 1; ; passnum ++) {
+    for (vertnum = vertbas, movenbr = 0;          /* Select candidate moves in vertex range */
+         vertnum < vmovnnd; vertnum ++) {
+      Gnum                gainval;
+      Anum                domnend;
+
+      if ((pfixtax != NULL) && (pfixtax[vertnum] != -1)) /* Fixed vertices are never moved */
+        continue;
+      if (kgraphMapPfMove (loopptr, vertnum, dngbtab, edngtab, &gainval, &domnend) == 0)
+        continue;
+
+      passtax[vertnum] = passnum;
+      gaintax[vertnum] = gainval;
+      movetab[3 * movenbr]     = gainval;
+      movetab[3 * movenbr + 1] = vertnum;
+      movetab[3 * movenbr + 2] = (Gnum) domnend;
+      movenbr ++;
+    }
+
+#ifndef KGRAPHMAPPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until all candidates are known */
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+    for (movenum = 0, movetmp = movenbr, movenbr = 0; /* Drop moves which conflict with better neighbor moves */
+         movenum < movetmp; movenum ++) {
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                gainval;
+
+      gainval = movetab[3 * movenum];
+      vertnum = movetab[3 * movenum + 1];
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if ((passtax[vertend] == passnum) &&      /* If neighbor is a better-ranked candidate */
+            ((gaintax[vertend] < gainval) ||
+             ((gaintax[vertend] == gainval) && (vertend < vertnum))))
+          break;
+      }
+      if (edgenum < vendtax[vertnum])             /* If move conflicts, drop it */
+        continue;
+
+      movetab[3 * movenbr]     = gainval;
+      movetab[3 * movenbr + 1] = vertnum;
+      movetab[3 * movenbr + 2] = movetab[3 * movenum + 2];
+      movenbr ++;
+    }
+    loopptr->thrdtab[thrdnum].movenbr = movenbr;
+
+#ifndef KGRAPHMAPPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until all moves are filtered */
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+    if (thrdnum == 0) {                           /* First thread applies moves sequentially */
+      Gnum * restrict       movetax;              /* Global move array                       */
+      Gnum * restrict const comploaddlt = loopptr->comploaddlt;
+      const Gnum * restrict const comploadmax = loopptr->comploadmax;
+      Gnum                  moveapp;              /* Number of moves actually applied        */
+      int                   thrdtmp;
+
+      movetax = loopptr->movetab;
+      for (thrdtmp = 1, movenbr = loopptr->thrdtab[0].movenbr; thrdtmp < thrdnbr; thrdtmp ++) { /* Gather move sub-arrays */
+        movetmp = loopptr->thrdtab[thrdtmp].movenbr;
+        memMov (movetax + 3 * movenbr, movetax + 3 * DATASCAN (vertnbr, thrdnbr, thrdtmp), 3 * movetmp * sizeof (Gnum));
+        movenbr += movetmp;
+      }
+      intSort3asc2 (movetax, movenbr);            /* Sort moves by ascending gain, then by vertex number */
+
+      for (movenum = moveapp = 0; movenum < movenbr; movenum ++) {
+        Gnum                vertnum;
+        Gnum                veloval;
+        Anum                domnnum;
+        Anum                domnend;
+
+        vertnum = movetax[3 * movenum + 1];
+        domnend = (Anum) movetax[3 * movenum + 2];
+        domnnum = parttax[vertnum];
+        veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+        if (kgraphMapPfBal (comploaddlt, comploadmax, domnnum, domnend, veloval) == 0) /* Skip moves which would break balance */
+          continue;
+        if ((movetax[3 * movenum] >= 0) &&        /* Balance moves must still decrease the load excess */
+            ((kgraphMapPfExcs (comploaddlt[domnnum] - veloval, comploadmax[domnnum]) +
+              kgraphMapPfExcs (comploaddlt[domnend] + veloval, comploadmax[domnend])) >=
+             (kgraphMapPfExcs (comploaddlt[domnnum],           comploadmax[domnnum]) +
+              kgraphMapPfExcs (comploaddlt[domnend],           comploadmax[domnend]))))
+          continue;
+
+        comploaddlt[domnnum] -= veloval;          /* Gain is exact since no neighbor moves in the same pass */
+        comploaddlt[domnend] += veloval;
+        parttax[vertnum] = domnend;
+        moveapp ++;
+      }
+
+      loopptr->flagval = ((moveapp == 0) ||       /* Stop when nothing to do or when all passes done */
+                          (passnum == loopptr->passnbr)) ? 1 : 0;
+    }
+
+#ifndef KGRAPHMAPPFNOTHREAD
+    threadBarrier (descptr);                      /* Wait until moves are applied */
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+    if (loopptr->flagval != 0)
+      break;
+  }
+
+  for (vertnum = vertbas, fronnbr = commload = 0; /* Build local frontier in move sub-array and compute local load */
+       vertnum < vertnnd; vertnum ++) {
+    Gnum                edgenum;
+    Anum                domnnum;
+    Anum                domnlst;                  /* Domain of last vertex for which a distance was computed */
+    Anum                distlst;                  /* Last distance computed                                  */
+    int                 commcut;
+
+    domnnum = parttax[vertnum];
+    domnlst = -1;
+    distlst = 0;
+    for (edgenum = verttax[vertnum], commcut = 0;
+         edgenum < vendtax[vertnum]; edgenum ++) {
+      Anum                domnend;
+
+      domnend = parttax[edgetax[edgenum]];
+      if (domnend != domnnum) {
+        if (domnend != domnlst) {
+          distlst = kgraphDistVal (distptr, domnnum, domnend);
+          domnlst = domnend;
+        }
+        commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
+        commcut   = 1;
+      }
+    }
+    if (commcut != 0)
+      movetab[fronnbr ++] = vertnum;
+  }
+  loopptr->thrdtab[thrdnum].fronnnd[0] = fronnbr;
+  loopptr->thrdtab[thrdnum].commload   = commload;
+
+#ifndef KGRAPHMAPPFNOTHREAD
+  threadScan (descptr, (void *) &loopptr->thrdtab[thrdnum], sizeof (KgraphMapPfThread), (ThreadScanFunc) kgraphMapPfScan, NULL);
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+  memCpy (grafptr->frontab + loopptr->thrdtab[thrdnum].fronnnd[0] - fronnbr, movetab, fronnbr * sizeof (Gnum));
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the k-way
+** partitioning refinement.
+** It returns:
+** - 0 : if the k-partition could be computed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapPf (
+Kgraph * restrict const         grafptr,          /*+ Active graph      +*/
+const KgraphMapPfParam * const  paraptr)          /*+ Method parameters +*/
+{
+  KgraphMapPfData     loopdat;
+  Gnum                commload;
+  Anum                domnnum;
+  int                 thrdnum;
+
+  const int                 thrdnbr = contextThreadNbr (grafptr->contptr);
+  const Anum                domnnbr = grafptr->m.domnnbr;
+#ifndef KGRAPHMAPPFNOTHREAD
+  const int                 thrdlst = thrdnbr - 1;
+#else /* KGRAPHMAPPFNOTHREAD */
+  const int                 thrdlst = 0;
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+  grafptr->kbalval = paraptr->deltval;            /* Store last k-way imbalance ratio */
+  kgraphCost (grafptr);                           /* Compute current domain loads     */
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab, (size_t) (thrdnbr                           * sizeof (KgraphMapPfThread)),
+                     &loopdat.movetab, (size_t) (grafptr->s.vertnbr * 3            * sizeof (Gnum)),
+                     &loopdat.gaintax, (size_t) (grafptr->s.vertnbr                * sizeof (Gnum)),
+                     &loopdat.passtax, (size_t) (grafptr->s.vertnbr                * sizeof (Gnum)),
+                     &loopdat.comploadmax, (size_t) (domnnbr                       * sizeof (Gnum)),
+                     &loopdat.edngtab, (size_t) (thrdnbr * grafptr->s.degrmax      * sizeof (Gnum)),
+                     &loopdat.dngbtab, (size_t) (thrdnbr * grafptr->s.degrmax      * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("kgraphMapPf: out of memory");
+    return     (1);
+  }
+
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+    loopdat.comploadmax[domnnum] = (Gnum) ((double) grafptr->comploadavg[domnnum] * paraptr->deltval);
+
+  loopdat.grafptr      = grafptr;
+  kgraphDistInit (&loopdat.distdat, grafptr);     /* Fill distance cache before it is shared by threads */
+  loopdat.gaintax     -= grafptr->s.baseval;
+  loopdat.passtax     -= grafptr->s.baseval;
+  loopdat.comploaddlt  = grafptr->comploaddlt;    /* Update imbalance array of graph in place */
+  loopdat.passnbr      = paraptr->passnbr;
+  loopdat.vertnnd      = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) ? (grafptr->s.vertnnd - domnnbr) : grafptr->s.vertnnd;
+  loopdat.flagval      = 0;
+
+#ifndef KGRAPHMAPPFNOTHREAD
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapPfLoop, (void *) &loopdat);
+#else /* KGRAPHMAPPFNOTHREAD */
+  kgraphMapPfLoop (NULL, &loopdat);
+#endif /* KGRAPHMAPPFNOTHREAD */
+
+  for (thrdnum = 0, commload = 0; thrdnum <= thrdlst; thrdnum ++)
+    commload += loopdat.thrdtab[thrdnum].commload;
+  grafptr->fronnbr  = loopdat.thrdtab[thrdlst].fronnnd[0]; /* Get data after scan-reduction */
+  grafptr->commload = commload / 2;               /* Every cut edge has been accounted for twice */
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+  kgraphDistExit (&loopdat.distdat);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapPf: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,91 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_pf.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the function       **/
+/**                declarations for the multi-threaded     **/
+/**                k-way frontier refinement mapping       **/
+/**                method.                                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct KgraphMapPfParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes to do (-1 : infinite) +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio                 +*/
+} KgraphMapPfParam;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct KgraphMapPfThread_ {
+  Gnum                      movenbr;              /*+ Number of candidate moves in sub-array         +*/
+  Gnum                      commload;             /*+ Communication load of local vertices           +*/
+  Gnum                      fronnnd[2];           /*+ After-last frontier vertex index; [2] for scan +*/
+} KgraphMapPfThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct KgraphMapPfData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                      +*/
+  KgraphDist                distdat;              /*+ Inter-domain distance cache           +*/
+  KgraphMapPfThread *       thrdtab;              /*+ Array of thread-specific data         +*/
+  Gnum *                    movetab;              /*+ Array of (gain, vertex, domain) moves +*/
+  Gnum *                    gaintax;              /*+ Gain of candidate vertices            +*/
+  Gnum *                    passtax;              /*+ Pass stamp of candidate vertices      +*/
+  Anum *                    dngbtab;              /*+ Per-thread neighbor domain arrays     +*/
+  Gnum *                    edngtab;              /*+ Per-thread neighbor edge load arrays  +*/
+  Gnum *                    comploaddlt;          /*+ Current load imbalance of domains     +*/
+  Gnum *                    comploadmax;          /*+ Maximum load imbalance of domains     +*/
+  INT                       passnbr;              /*+ Maximum number of passes              +*/
+  Gnum                      vertnnd;              /*+ After-last movable vertex             +*/
+  int                       flagval;              /*+ Set when no more passes are to be run +*/
+} KgraphMapPfData;
+
+/*
+**  The function prototypes.
+*/
+
+int                         kgraphMapPf         (Kgraph * restrict const, const KgraphMapPfParam * const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2009,2011,2014,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2009,2011,2014,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -70,7 +70,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This code is a complete rewrite of    **/
 /**                  the original code of kgraphMapRb(),   **/
@@ -753,6 +753,108 @@ const KgraphMapRbMapJob * const joboldptr)        /* Job to be removed */
   }
 }
 
+/* This routine tells whether the given job
+** has no vertex adjacent to a vertex of a
+** job of the current batch.
+** It returns:
+** - 1  : if job is independent from the batch.
+** - 0  : if it is adjacent to some job of the batch.
+*/
+
+static
+int
+kgraphMapRbMapPoolIndep (
+const KgraphMapRbMapPoolData * restrict const poolptr,
+const KgraphMapRbMapJob * restrict const      jobptr)
+{
+  Gnum                jobvertnnd;
+  Gnum                jobvertnum;
+
+  const KgraphMapRbMapJob * restrict const  jobtab     = poolptr->jobtab;
+  const Anum * restrict const               mapparttax = poolptr->mappptr->parttax;
+  const Anum * restrict const               toppfixtax = poolptr->pfixtax;
+  const Gnum * restrict const               topverttax = poolptr->grafptr->verttax;
+  const Gnum * restrict const               topvendtax = poolptr->grafptr->vendtax;
+  const Gnum * restrict const               topedgetax = poolptr->grafptr->edgetax;
+  const Gnum * restrict const               jobverttax = jobptr->grafdat.verttax;
+  const Gnum * restrict const               jobvendtax = jobptr->grafdat.vendtax;
+  const Gnum * restrict const               jobvnumtax = jobptr->grafdat.vnumtax;
+
+  if (jobvnumtax == NULL)                         /* If job graph is top graph, it has no neighbors */
+    return (1);
+
+  for (jobvertnum = jobptr->grafdat.baseval, jobvertnnd = jobptr->grafdat.vertnnd;
+       jobvertnum < jobvertnnd; jobvertnum ++) {
+    Gnum                topvertnum;
+    Gnum                topedgenum;
+
+    topvertnum = jobvnumtax[jobvertnum];
+
+    if ((topvendtax[topvertnum] - topverttax[topvertnum]) == /* If vertex is internal, skip it */
+        (jobvendtax[jobvertnum] - jobverttax[jobvertnum]))
+      continue;
+
+    for (topedgenum = topverttax[topvertnum]; topedgenum < topvendtax[topvertnum]; topedgenum ++) {
+      Gnum                topvertend;
+
+      topvertend = topedgetax[topedgenum];
+      if ((toppfixtax != NULL) && (toppfixtax[topvertend] >= 0)) /* Fixed vertices belong to no job */
+        continue;
+
+      if (jobtab[mapparttax[topvertend]].poolflag == KGRAPHMAPRBMAPJOBBATC) /* If neighbor belongs to a job of the batch */
+        return (0);
+    }
+  }
+
+  return (1);
+}
+
+/* This routine fills the given batch with
+** jobs of the current pool, taken by order
+** of priority, such that no job of the batch
+** is adjacent to another one. Hence, all of
+** them can be bipartitioned concurrently,
+** as the external gains of each of them do
+** not depend on the result of the others.
+** Jobs that cannot join the batch are put
+** back in the pool.
+** It returns:
+** - k  : the number of jobs in the batch.
+*/
+
+static
+int
+kgraphMapRbMapPoolBatch (
+KgraphMapRbMapPoolData * restrict const poolptr,
+KgraphMapRbMapBatch * restrict const    batcptr,
+const int                               batcmax)  /*+ Maximum number of jobs in batch +*/
+{
+  KgraphMapRbMapJob * jobptr;
+  Anum                rejttab[KGRAPHMAPRBMAPBATCHMAX]; /* Jobs to put back in pool */
+  int                 rejtnbr;
+  int                 rejtnum;
+  int                 slotnbr;
+
+  for (slotnbr = rejtnbr = 0; (slotnbr < batcmax) && ((jobptr = kgraphMapRbMapPoolGet (poolptr)) != NULL); ) {
+    if ((slotnbr > 0) &&                          /* If job interacts with some job of the batch */
+        (poolptr->grafptr != NULL) &&             /* Which matters only if mapping depends on neighbor domains */
+        (kgraphMapRbMapPoolIndep (poolptr, jobptr) == 0)) {
+      rejttab[rejtnbr ++] = (Anum) (jobptr - poolptr->jobtab); /* Keep it for next batch */
+      if (rejtnbr >= KGRAPHMAPRBMAPBATCHMAX)      /* Do not scan the whole pool */
+        break;
+      continue;
+    }
+
+    jobptr->poolflag = KGRAPHMAPRBMAPJOBBATC;     /* Job now belongs to the batch */
+    batcptr->slottab[slotnbr ++].jobnum = (Anum) (jobptr - poolptr->jobtab);
+  }
+
+  for (rejtnum = rejtnbr - 1; rejtnum >= 0; rejtnum --) /* Put back rejected jobs in pool, in their original order */
+    kgraphMapRbMapPoolAdd (poolptr->pooltab[0], &poolptr->jobtab[rejttab[rejtnum]]);
+
+  return (slotnbr);
+}
+
 /**********************************************/
 /*                                            */
 /* These routines handle the pool part array. */
@@ -849,6 +951,232 @@ const Anum                              jobsubnum1)
   }
 }
 
+/*****************************************/
+/*                                       */
+/* These routines process batches of     */
+/* bipartitioning jobs.                  */
+/*                                       */
+/*****************************************/
+
+/* This routine bipartitions the job of the
+** given batch slot and induces the subgraphs
+** of its subjobs. As it only reads shared
+** mapping data, it can be run concurrently
+** on all the jobs of a batch.
+** It returns:
+** - VOID  : in all cases; the slot return
+**           value is set to !0 on error.
+*/
+
+static
+void
+kgraphMapRbMapJob1 (
+Context * const                       contptr,    /*+ Context of the job   +*/
+const int                             slotnum,    /*+ Number of batch slot +*/
+KgraphMapRbMapBatch * restrict const  batcptr)    /*+ Batch data           +*/
+{
+  int                 i;
+
+  KgraphMapRbMapSlot * restrict const     slotptr   = &batcptr->slottab[slotnum];
+  KgraphMapRbMapPoolData * restrict const poolptr   = batcptr->poolptr;
+  const KgraphMapRbData * restrict const  dataptr   = batcptr->dataptr;
+  Mapping * restrict const                mappptr   = poolptr->mappptr;
+  KgraphMapRbMapJob * restrict const      joborgptr = &poolptr->jobtab[slotptr->jobnum];
+
+  slotptr->o = 1;                                 /* Assume failure                      */
+  slotptr->joborgdat = *joborgptr;                /* Save current job data (clone graph) */
+
+  if (archDomBipart (mappptr->archptr, &slotptr->joborgdat.domnorg, &slotptr->domnsubtab[0], &slotptr->domnsubtab[1]) != 0) {
+    errorPrint ("kgraphMapRbMapJob1: cannot bipartition domain");
+    return;                                       /* Copied graph will be freed as not yet removed */
+  }
+
+  kgraphMapRbVfloSplit (mappptr->archptr, slotptr->domnsubtab, /* Split fixed vertex load slots, if any */
+                        slotptr->joborgdat.vflonbr, slotptr->joborgdat.vflotab, slotptr->vflonbrtab, slotptr->vflowgttab);
+  if (kgraphMapRbBgraph (dataptr, &slotptr->actgrafdat, &slotptr->joborgdat.grafdat, mappptr, slotptr->domnsubtab, slotptr->vflowgttab, contptr) != 0) { /* Create bipartition graph */
+    errorPrint ("kgraphMapRbMapJob1: cannot create bipartition graph");
+    return;                                       /* Copied graph will be freed as not yet removed */
+  }
+
+  slotptr->actgrafdat.s.flagval |= (slotptr->joborgdat.grafdat.flagval & GRAPHFREETABS); /* Bipartition graph is responsible for freeing the cloned graph data fields */
+  joborgptr->poolflag = 0;                        /* Original slot is now considered unused so that cloned graph data will not be freed twice           */
+
+  if ((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) == 0) { /* If not variable-sized, impose constraints on bipartition */
+    double              comploadavg;
+
+    comploadavg = (double) slotptr->actgrafdat.s.velosum / (double) archDomWght (mappptr->archptr, &slotptr->joborgdat.domnorg);
+    slotptr->actgrafdat.compload0min = slotptr->actgrafdat.compload0avg -
+                                       (Gnum) MIN ((batcptr->comploadmax - comploadavg) * (double) slotptr->actgrafdat.domnwght[0],
+                                                   (comploadavg - batcptr->comploadmin) * (double) slotptr->actgrafdat.domnwght[1]);
+    slotptr->actgrafdat.compload0max = slotptr->actgrafdat.compload0avg +
+                                       (Gnum) MIN ((comploadavg - batcptr->comploadmin) * (double) slotptr->actgrafdat.domnwght[0],
+                                                   (batcptr->comploadmax - comploadavg) * (double) slotptr->actgrafdat.domnwght[1]);
+  }
+
+  if (bgraphBipartSt (&slotptr->actgrafdat, dataptr->paraptr->strat) != 0) { /* Perform bipartitioning */
+    errorPrint ("kgraphMapRbMapJob1: cannot bipartition job");
+    bgraphExit (&slotptr->actgrafdat);
+    return;
+  }
+
+  if ((slotptr->partval = 1, slotptr->actgrafdat.compsize0 == 0) || /* If no bipartition found */
+      (slotptr->partval = 0, slotptr->actgrafdat.compsize0 == slotptr->actgrafdat.s.vertnbr)) {
+    slotptr->o = 0;                               /* Job will be updated on commit */
+    return;
+  }
+  slotptr->partval = -1;                          /* Bipartition found */
+
+  slotptr->jobsubsiz[1] = slotptr->actgrafdat.s.vertnbr - slotptr->actgrafdat.compsize0;
+  slotptr->jobsubsiz[0] = slotptr->actgrafdat.compsize0;
+
+  for (i = 1; i >= 0; i --) {                     /* For both subdomains */
+    if ((((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) == 0) && (archDomSize (mappptr->archptr, &slotptr->domnsubtab[i]) <= 1)) || /* If single-vertex domain  */
+        (((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) != 0) && (slotptr->jobsubsiz[i] <= 1))) { /* Or if variable-sized architecture with single vertex graph */
+      slotptr->jobsubsiz[i] = 0;                  /* Cancel subjob */
+      continue;
+    }
+
+    if (graphInducePart (&slotptr->actgrafdat.s, slotptr->actgrafdat.parttax, slotptr->jobsubsiz[i], (GraphPart) i, &slotptr->indgraftab[i]) != 0) {
+      errorPrint ("kgraphMapRbMapJob1: cannot create induced subgraph");
+      if ((i == 0) && (slotptr->jobsubsiz[1] != 0)) /* If other subgraph already induced */
+        graphExit (&slotptr->indgraftab[1]);
+      bgraphExit (&slotptr->actgrafdat);
+      return;
+    }
+  }
+
+  slotptr->o = 0;
+}
+
+/* This routine commits the result of the
+** bipartitioning of the job of the given
+** batch slot to the mapping and to the job
+** pools. It must be called in sequence for
+** all the jobs of a batch, in batch order.
+** On error, the slot data are left for
+** kgraphMapRbMapJobExit() to free them.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+kgraphMapRbMapJob2 (
+KgraphMapRbMapPoolData * restrict const poolptr,
+KgraphMapRbMapSlot * restrict const     slotptr)
+{
+  Anum                jobsubnum[2];               /* Number of subjob slots in job array */
+  Gnum                levlnum;
+  int                 partval;
+  int                 i;
+
+  Mapping * restrict const  mappptr = poolptr->mappptr;
+
+  jobsubnum[0] = slotptr->jobnum;                 /* Current (and first son) job slot number */
+
+  if (slotptr->partval >= 0) {                    /* If no bipartition found */
+    KgraphMapRbMapJob * restrict const  joborgptr = &poolptr->jobtab[jobsubnum[0]];
+
+    partval = slotptr->partval;
+    if ((poolptr->flagval & KGRAPHMAPRBMAPARCHVAR) != 0) { /* If architecture is variable-sized       */
+      poolptr->domntab[0][jobsubnum[0]] = slotptr->joborgdat.domnorg; /* Propagate domain in next pool */
+      kgraphMapRbMapPoolRemv (poolptr, &slotptr->joborgdat); /* Remove job from pool as long as graph exists */
+    }
+    else if (archDomSize (mappptr->archptr, &slotptr->domnsubtab[partval]) <= 1) { /* If domain is terminal */
+      poolptr->domntab[0][jobsubnum[0]] = slotptr->domnsubtab[partval]; /* Refine domain in next pool      */
+      kgraphMapRbMapPoolRemv (poolptr, &slotptr->joborgdat); /* Remove job from pool as long as graph exists */
+    }
+    else {                                        /* Re-use job slot and graph for further bipartitioning */
+      poolptr->domntab[0][jobsubnum[0]] =         /* Update domain in next pool                           */
+      joborgptr->domnorg = slotptr->domnsubtab[partval]; /* New job takes same graph and non-empty subdomain */
+      joborgptr->vflonbr = slotptr->vflonbrtab[partval];
+      joborgptr->vflotab = slotptr->joborgdat.vflotab + (partval * slotptr->vflonbrtab[0]); /* Point to proper sub-array */
+      joborgptr->levlnum ++;
+      kgraphMapRbMapPoolUpdt1 (poolptr, &slotptr->joborgdat, slotptr->actgrafdat.parttax, joborgptr, partval); /* Add job to pool */
+      slotptr->actgrafdat.s.flagval &= ~GRAPHFREETABS; /* Since graph will be re-used, never free its internal arrays */
+    }
+    bgraphExit (&slotptr->actgrafdat);            /* Free bipartitioning data as well as current graph */
+    return (0);
+  }
+
+  if ((mappptr->domnnbr == mappptr->domnmax) &&   /* If all job slots busy and if cannot resize */
+      (kgraphMapRbMapPoolResize (poolptr) != 0)) {
+    errorPrint ("kgraphMapRbMapJob2: cannot resize structures");
+    return (1);
+  }
+
+  jobsubnum[1] = mappptr->domnnbr ++;             /* Get slot number of new subdomain */
+
+  poolptr->jobtab[jobsubnum[1]].poolflag = 0;     /* Assume that new job is inactive in case of premature freeing                           */
+  poolptr->domntab[1][jobsubnum[1]] = slotptr->joborgdat.domnorg; /* Copy original domain to new subdomain as old mapping shares parttax with new */
+  poolptr->domntab[0][jobsubnum[0]] = slotptr->domnsubtab[0]; /* Set subdomains of second mapping before relinking subjobs in pool                */
+  poolptr->domntab[0][jobsubnum[1]] = slotptr->domnsubtab[1];
+
+  if ((poolptr->flagval & KGRAPHMAPRBMAPPARTHALF) != 0) /* If can only update second half */
+    kgraphMapRbMapPartOne (poolptr, &slotptr->actgrafdat, jobsubnum[1]);
+  else
+    kgraphMapRbMapPartBoth (poolptr, &slotptr->actgrafdat, jobsubnum);
+
+  levlnum = slotptr->joborgdat.levlnum + 1;
+  partval = 0;
+  for (i = 1; i >= 0; i --) {                     /* For both subdomains */
+    KgraphMapRbMapJob * jobsubptr;
+
+    jobsubptr = &poolptr->jobtab[jobsubnum[i]];   /* Point to subdomain job slot                                */
+    jobsubptr->poollink.prev =                    /* Prevent Valgrind from yelling in kgraphMapRbMapPoolResize() */
+    jobsubptr->poollink.next = NULL;
+    jobsubptr->prioval =                          /* Prevent Valgrind from yelling in kgraphMapRbMapPoolRemv()/Updt1()/Updt2() */
+    jobsubptr->priolvl = 0;
+
+    if (slotptr->jobsubsiz[i] == 0)               /* If subjob cancelled */
+      continue;
+
+    partval = i;                                  /* At least this subjob works */
+
+    jobsubptr->grafdat  = slotptr->indgraftab[i]; /* Job takes induced subgraph */
+    jobsubptr->poolflag = 1;                      /* So that graph is freed in case of error on other part */
+    jobsubptr->domnorg  = slotptr->domnsubtab[i];
+    jobsubptr->vflonbr  = slotptr->vflonbrtab[i];
+    jobsubptr->vflotab  = slotptr->joborgdat.vflotab + (i * slotptr->vflonbrtab[0]); /* Point to proper sub-array */
+    jobsubptr->levlnum  = levlnum;                /* Set new level */
+  }
+
+  if ((slotptr->jobsubsiz[0] | slotptr->jobsubsiz[1]) == 0) /* If both subjobs do not need further processing */
+    kgraphMapRbMapPoolRemv (poolptr, &slotptr->joborgdat);
+  else if (slotptr->jobsubsiz[1 - partval] == 0)  /* If one of the subjobs only needs further processing */
+    kgraphMapRbMapPoolUpdt1 (poolptr, &slotptr->joborgdat, slotptr->actgrafdat.parttax, &poolptr->jobtab[jobsubnum[partval]], (GraphPart) partval);
+  else
+    kgraphMapRbMapPoolUpdt2 (poolptr, &slotptr->joborgdat, slotptr->actgrafdat.parttax, &poolptr->jobtab[jobsubnum[0]], &poolptr->jobtab[jobsubnum[1]]);
+
+  bgraphExit (&slotptr->actgrafdat);              /* Free bipartition graph data */
+
+  return (0);
+}
+
+/* This routine frees the data of a batch
+** slot whose job has been bipartitioned
+** but not committed.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapRbMapJobExit (
+KgraphMapRbMapSlot * restrict const slotptr)
+{
+  int                 i;
+
+  if (slotptr->partval < 0) {                     /* If subgraphs have been induced */
+    for (i = 0; i < 2; i ++) {
+      if (slotptr->jobsubsiz[i] != 0)
+        graphExit (&slotptr->indgraftab[i]);
+    }
+  }
+  bgraphExit (&slotptr->actgrafdat);              /* Free bipartition graph, as well as job graph it owns */
+}
+
 /********************************************/
 /*                                          */
 /* This is the entry point for the Dual     */
@@ -858,6 +1186,13 @@ const Anum                              jobsubnum1)
 
 /* This routine runs the Dual Recursive
 ** Bipartitioning algorithm.
+** When the context has several threads,
+** jobs are processed by batches of jobs
+** that are not adjacent to each other.
+** The jobs of a batch are bipartitioned
+** concurrently, each with its own pseudo-
+** random generator, after which their
+** results are committed in sequence.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -872,14 +1207,7 @@ KgraphMapRbVflo * restrict const        vflotab,  /*+ Array of fixed vertex load
 Context * const                         contptr)  /*+ Execution context                    +*/
 {
   KgraphMapRbMapPoolData  pooldat;                /* Data for handling jobs and job pools */
-  ArchDom                 domnsubtab[2];          /* Subdomains of current job domain     */
-  KgraphMapRbMapJob       joborgdat;              /* Aera to save original job data       */
-  Anum                    jobsubnum[2];           /* Number of subjob slots in job array  */
-  Gnum                    jobsubsiz[2];           /* Sizes of subjobs                     */
-  Bgraph                  actgrafdat;             /* Bipartition graph                    */
-  double                  comploadmin;            /* Minimum vertex load per target load  */
-  double                  comploadmax;            /* Maximum vertex load per target load  */
-  int                     i;
+  KgraphMapRbMapBatch     batcdat;                /* Batch of jobs to bipartition         */
 
   Mapping * restrict const  mappptr = dataptr->mappptr;
 
@@ -918,140 +1246,35 @@ Context * const                         contptr)  /*+ Execution context
   pooldat.jobtab[0].levlnum = 0;                  /* Initial recursion level is 0 */
   kgraphMapRbMapPoolFrst (&pooldat, &pooldat.jobtab[0]); /* Add initial job       */
 
-  comploadmin = (1.0 - dataptr->paraptr->kbalval) * dataptr->comploadrat; /* Ratio can have been tilted when working on subgraph */
-  comploadmax = (1.0 + dataptr->paraptr->kbalval) * dataptr->comploadrat;
+  batcdat.poolptr     = &pooldat;
+  batcdat.dataptr     = dataptr;
+  batcdat.comploadmin = (1.0 - dataptr->paraptr->kbalval) * dataptr->comploadrat; /* Ratio can have been tilted when working on subgraph */
+  batcdat.comploadmax = (1.0 + dataptr->paraptr->kbalval) * dataptr->comploadrat;
 
   while (! kgraphMapRbMapPoolEmpty (&pooldat)) {  /* For all non-empty pools */
-    KgraphMapRbMapJob * joborgptr;                /* Pointer to current job  */
-
-    while ((joborgptr = kgraphMapRbMapPoolGet (&pooldat)) != NULL) { /* For all jobs in pool */
-      Gnum                vflonbrtab[2];
-      Gnum                vflowgttab[2];
-      Gnum                levlnum;
-      int                 partval;
-
-      jobsubnum[0] = (Anum) (joborgptr - pooldat.jobtab);  /* Get current (and first son) job slot number before possible move of pointers */
-      joborgdat = *joborgptr;                     /* Save current job data (clone graph)                                                   */
-
-      if (archDomBipart (mappptr->archptr, &joborgdat.domnorg, &domnsubtab[0], &domnsubtab[1]) != 0) {
-        errorPrint ("kgraphMapRbMap: cannot bipartition domain");
-        kgraphMapRbMapPoolExit (&pooldat);        /* Copied graph will be freed as not yet removed */
-        return (1);
-      }
-
-      kgraphMapRbVfloSplit (mappptr->archptr, domnsubtab, /* Split fixed vertex load slots, if any */
-                            joborgdat.vflonbr, joborgdat.vflotab, vflonbrtab, vflowgttab);
-      if (kgraphMapRbBgraph (dataptr, &actgrafdat, &joborgdat.grafdat, pooldat.mappptr, domnsubtab, vflowgttab, contptr) != 0) { /* Create bipartition graph */
-        errorPrint ("kgraphMapRbMap: cannot create bipartition graph");
-        kgraphMapRbMapPoolExit (&pooldat);        /* Copied graph will be freed as not yet removed */
-        return (1);
-      }
-
-      actgrafdat.s.flagval |= (joborgdat.grafdat.flagval & GRAPHFREETABS); /* Bipartition graph is responsible for freeing the cloned graph data fields */
-      joborgptr->poolflag = 0;                    /* Original slot is now considered unused so that cloned graph data will not be freed twice           */
-
-      if ((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) == 0) { /* If not variable-sized, impose constraints on bipartition */
-        double              comploadavg;
-
-        comploadavg = (double) actgrafdat.s.velosum / (double) archDomWght (mappptr->archptr, &joborgdat.domnorg);
-        actgrafdat.compload0min = actgrafdat.compload0avg -
-                                  (Gnum) MIN ((comploadmax - comploadavg) * (double) actgrafdat.domnwght[0],
-                                              (comploadavg - comploadmin) * (double) actgrafdat.domnwght[1]);
-        actgrafdat.compload0max = actgrafdat.compload0avg +
-                                  (Gnum) MIN ((comploadavg - comploadmin) * (double) actgrafdat.domnwght[0],
-                                              (comploadmax - comploadavg) * (double) actgrafdat.domnwght[1]);
-      }
-
-      if (bgraphBipartSt (&actgrafdat, dataptr->paraptr->strat) != 0) { /* Perform bipartitioning */
-        errorPrint             ("kgraphMapRbMap: cannot bipartition job");
-        bgraphExit             (&actgrafdat);
-        kgraphMapRbMapPoolExit (&pooldat);
+    while ((batcdat.slotnbr = kgraphMapRbMapPoolBatch (&pooldat, &batcdat, KGRAPHMAPRBMAPBATCHMAX)) > 0) { /* For all batches of jobs in pool */
+      int                 slotnum;
+
+      if (batcdat.slotnbr == 1)                   /* If single job, run it with all the threads of the context */
+        kgraphMapRbMapJob1 (contptr, 0, &batcdat);
+      else if (contextThreadLaunchMulti (contptr, batcdat.slotnbr, (ContextSplitFunc) kgraphMapRbMapJob1, (void *) &batcdat) != 0) {
+        errorPrint             ("kgraphMapRbMap: cannot launch jobs");
+        kgraphMapRbMapPoolExit (&pooldat);        /* Copied graphs will be freed as not yet removed */
         return (1);
       }
 
-      if ((partval = 1, actgrafdat.compsize0 == 0) || /* If no bipartition found */
-          (partval = 0, actgrafdat.compsize0 == actgrafdat.s.vertnbr)) {
-        if ((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) != 0) { /* If architecture is variable-sized       */
-          pooldat.domntab[0][jobsubnum[0]] = joborgdat.domnorg; /* Propagate domain in next pool         */
-          kgraphMapRbMapPoolRemv (&pooldat, &joborgdat); /* Remove job from pool as long as graph exists */
-        }
-        else if (archDomSize (mappptr->archptr, &domnsubtab[partval]) <= 1) { /* If domain is terminal   */
-          pooldat.domntab[0][jobsubnum[0]] = domnsubtab[partval]; /* Refine domain in next pool          */
-          kgraphMapRbMapPoolRemv (&pooldat, &joborgdat); /* Remove job from pool as long as graph exists */
-        }
-        else {                                    /* Re-use job slot and graph for further bipartitioning */
-          pooldat.domntab[0][jobsubnum[0]] =      /* Update domain in next pool                           */
-          joborgptr->domnorg = domnsubtab[partval]; /* New job takes same graph and non-empty subdomain   */
-          joborgptr->vflonbr = vflonbrtab[partval];
-          joborgptr->vflotab = joborgdat.vflotab + (partval * vflonbrtab[0]); /* Point to proper sub-array */
-          joborgptr->levlnum ++;
-          kgraphMapRbMapPoolUpdt1 (&pooldat, &joborgdat, actgrafdat.parttax, joborgptr, partval); /* Add job to pool */
-          actgrafdat.s.flagval &= ~GRAPHFREETABS; /* Since graph will be re-used, never free its internal arrays     */
-        }
-        bgraphExit (&actgrafdat);                 /* Free bipartitioning data as well as current graph */
-        continue;                                 /* Process next job in current pool                  */
-      }
-
-      if ((pooldat.mappptr->domnnbr == pooldat.mappptr->domnmax) && /* If all job slots busy and if cannot resize */
-          (kgraphMapRbMapPoolResize (&pooldat) != 0)) { /* From this point, joborgptr may no longer be valid      */
-        errorPrint             ("kgraphMapRbMap: cannot resize structures");
-        kgraphMapRbMapPoolExit (&pooldat);
-        return (1);
-      }
-
-      jobsubnum[1] = pooldat.mappptr->domnnbr ++; /* Get slot number of new subdomain */
-      jobsubsiz[1] = actgrafdat.s.vertnbr - actgrafdat.compsize0;
-      jobsubsiz[0] = actgrafdat.compsize0;
-
-      pooldat.jobtab[jobsubnum[1]].poolflag = 0;  /* Assume that new job is inactive in case of premature freeing                           */
-      pooldat.domntab[1][jobsubnum[1]] = joborgdat.domnorg; /* Copy original domain to new subdomain as old mapping shares parttax with new */
-      pooldat.domntab[0][jobsubnum[0]] = domnsubtab[0]; /* Set subdomains of second mapping before relinking subjobs in pool                */
-      pooldat.domntab[0][jobsubnum[1]] = domnsubtab[1];
-
-      if ((pooldat.flagval & KGRAPHMAPRBMAPPARTHALF) != 0) /* If can only update second half */
-        kgraphMapRbMapPartOne (&pooldat, &actgrafdat, jobsubnum[1]);
-      else
-        kgraphMapRbMapPartBoth (&pooldat, &actgrafdat, jobsubnum);
-
-      levlnum = joborgdat.levlnum + 1;
-      for (i = 1; i >= 0; i --) {                 /* For both subdomains */
-        KgraphMapRbMapJob * jobsubptr;
-
-        jobsubptr = &pooldat.jobtab[jobsubnum[i]]; /* Point to subdomain job slot                                */
-        jobsubptr->poollink.prev =                /* Prevent Valgrind from yelling in kgraphMapRbMapPoolResize() */
-        jobsubptr->poollink.next = NULL;
-        jobsubptr->prioval =                      /* Prevent Valgrind from yelling in kgraphMapRbMapPoolRemv()/Updt1()/Updt2() */
-        jobsubptr->priolvl = 0;
-
-        if ((((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) == 0) && (archDomSize (mappptr->archptr, &domnsubtab[i]) <= 1)) || /* If single-vertex domain  */
-            (((pooldat.flagval & KGRAPHMAPRBMAPARCHVAR) != 0) && (jobsubsiz[i] <= 1))) { /* Or if variable-sized architecture with single vertex graph */
-          jobsubsiz[i] = 0;                       /* Cancel subjob */
-          continue;
-        }
-
-        partval = i;                              /* At least this subjob works */
-
-        if (graphInducePart (&actgrafdat.s, actgrafdat.parttax, jobsubsiz[i], (GraphPart) i, &jobsubptr->grafdat) != 0) {
-          errorPrint             ("kgraphMapRbMap: cannot create induced subgraph");
-          bgraphExit             (&actgrafdat);
+      for (slotnum = 0; slotnum < batcdat.slotnbr; slotnum ++) { /* Commit jobs in batch order */
+        if ((batcdat.slottab[slotnum].o != 0) ||
+            (kgraphMapRbMapJob2 (&pooldat, &batcdat.slottab[slotnum]) != 0)) {
+          errorPrint ("kgraphMapRbMap: cannot bipartition job");
+          for ( ; slotnum < batcdat.slotnbr; slotnum ++) { /* Free data of jobs not yet committed */
+            if (batcdat.slottab[slotnum].o == 0)
+              kgraphMapRbMapJobExit (&batcdat.slottab[slotnum]);
+          }
           kgraphMapRbMapPoolExit (&pooldat);
           return (1);
         }
-        jobsubptr->poolflag = 1;                  /* So that graph is freed in case of error on other part */
-        jobsubptr->domnorg  = domnsubtab[i];
-        jobsubptr->vflonbr  = vflonbrtab[i];
-        jobsubptr->vflotab  = joborgdat.vflotab + (i * vflonbrtab[0]); /* Point to proper sub-array */
-        jobsubptr->levlnum  = levlnum;            /* Set new level */
       }
-
-      if ((jobsubsiz[0] | jobsubsiz[1]) == 0)     /* If both subjobs do not need further processing */
-        kgraphMapRbMapPoolRemv (&pooldat, &joborgdat);
-      else if (jobsubsiz[1 - partval] == 0)       /* If one of the subjobs only needs further processing */
-        kgraphMapRbMapPoolUpdt1 (&pooldat, &joborgdat, actgrafdat.parttax, &pooldat.jobtab[jobsubnum[partval]], (GraphPart) partval);
-      else
-        kgraphMapRbMapPoolUpdt2 (&pooldat, &joborgdat, actgrafdat.parttax, &pooldat.jobtab[jobsubnum[0]], &pooldat.jobtab[jobsubnum[1]]);
-
-      bgraphExit (&actgrafdat);                   /* Free bipartition graph data */
     }
 
     kgraphMapRbMapPoolSwap (&pooldat);            /* Swap current and next levels */
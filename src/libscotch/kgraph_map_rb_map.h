@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 16 jul 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,6 +82,18 @@
 #define KGRAPHMAPRBMAPARCHCMPLT     0x0002        /* Complete-graph architecture                         */
 #define KGRAPHMAPRBMAPPARTHALF      0x0004        /* Only update half of part array as mappings are tied */
 
+/*+ Maximum number of jobs bipartitioned
+    concurrently. It does not depend on
+    the number of threads, so that results
+    are the same for any number of threads. +*/
+
+#define KGRAPHMAPRBMAPBATCHMAX      16
+
+/*+ Pool flag value of jobs removed from
+    their pool to be part of current batch. +*/
+
+#define KGRAPHMAPRBMAPJOBBATC       2
+
 /*
 **  The type and structure definitions.
 */
@@ -100,7 +112,7 @@ typedef struct KgraphMapRbMapPoolLink_ {
 typedef struct KgraphMapRbMapJob_ {
   KgraphMapRbMapPoolLink    poollink;             /*+ Link to job pool; TRICK: FIRST           +*/
   KgraphMapRbMapPoolLink *  poolptr;              /*+ Pointer to last/current job pool         +*/
-  int                       poolflag;             /*+ Flag set if job in pool                  +*/
+  int                       poolflag;             /*+ Flag set if job in pool or in batch      +*/
   Gnum                      prioval;              /*+ Job priority value by policy             +*/
   Gnum                      priolvl;              /*+ Priority level computed for this job     +*/
   ArchDom                   domnorg;              /*+ Domain to which the vertices belong      +*/
@@ -127,6 +139,39 @@ typedef struct KgraphMapRbMapPoolData_ {
   Context *                 contptr;
 } KgraphMapRbMapPoolData;
 
+/*+ This structure holds the data of a job
+    of a batch of jobs to be bipartitioned
+    concurrently.                           +*/
+
+typedef struct KgraphMapRbMapSlot_ {
+  Anum                      jobnum;               /*+ Slot of job in job table                     +*/
+  KgraphMapRbMapJob         joborgdat;            /*+ Saved job data (clone graph)                 +*/
+  ArchDom                   domnsubtab[2];        /*+ Subdomains of job domain                     +*/
+  Anum                      vflonbrtab[2];        /*+ Number of fixed vertex load slots per part   +*/
+  Gnum                      vflowgttab[2];        /*+ Fixed vertex loads per part                  +*/
+  Bgraph                    actgrafdat;           /*+ Bipartition graph                            +*/
+  Gnum                      jobsubsiz[2];         /*+ Sizes of subjobs; 0 if no further processing +*/
+  Graph                     indgraftab[2];        /*+ Induced subgraphs of subjobs                 +*/
+  int                       partval;              /*+ Only non-empty part if no bipartition, or -1 +*/
+  int                       o;                    /*+ Return value of bipartitioning               +*/
+} KgraphMapRbMapSlot;
+
+/*+ This structure defines a batch of
+    jobs. Jobs of a batch do not have
+    any vertex adjacent to a vertex of
+    another job of the batch, so that
+    they can be bipartitioned in any
+    order, with the same result.       +*/
+
+typedef struct KgraphMapRbMapBatch_ {
+  KgraphMapRbMapPoolData *  poolptr;              /*+ Pointer to pool data               +*/
+  const KgraphMapRbData *   dataptr;              /*+ Global mapping data                +*/
+  double                    comploadmin;          /*+ Minimum vertex load per target load +*/
+  double                    comploadmax;          /*+ Maximum vertex load per target load +*/
+  int                       slotnbr;              /*+ Number of jobs in batch            +*/
+  KgraphMapRbMapSlot        slottab[KGRAPHMAPRBMAPBATCHMAX]; /*+ Array of job data         +*/
+} KgraphMapRbMapBatch;
+
 /*
 **  The function prototypes.
 */
@@ -140,6 +185,11 @@ static void                 kgraphMapRbMapPoolFrst (KgraphMapRbMapPoolData * con
 static void                 kgraphMapRbMapPoolUpdt1 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, const GraphPart);
 static void                 kgraphMapRbMapPoolUpdt2 (KgraphMapRbMapPoolData * const, const KgraphMapRbMapJob * const, const GraphPart * const, KgraphMapRbMapJob * const, KgraphMapRbMapJob * const);
 static int                  kgraphMapRbMapPoolResize (KgraphMapRbMapPoolData * restrict const);
+static int                  kgraphMapRbMapPoolIndep (const KgraphMapRbMapPoolData * restrict const, const KgraphMapRbMapJob * restrict const);
+static int                  kgraphMapRbMapPoolBatch (KgraphMapRbMapPoolData * restrict const, KgraphMapRbMapBatch * restrict const, const int);
+static void                 kgraphMapRbMapJob1  (Context * const, const int, KgraphMapRbMapBatch * restrict const);
+static int                  kgraphMapRbMapJob2  (KgraphMapRbMapPoolData * restrict const, KgraphMapRbMapSlot * restrict const);
+static void                 kgraphMapRbMapJobExit (KgraphMapRbMapSlot * restrict const);
 #endif /* SCOTCH_KGRAPH_MAP_RB_MAP */
 
 int                         kgraphMapRbMap      (const KgraphMapRbData * restrict const, const Graph * restrict const, const Anum, KgraphMapRbVflo * restrict const, Context * restrict const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -80,7 +80,9 @@
 #include "kgraph_map_df.h"
 #include "kgraph_map_ex.h"
 #include "kgraph_map_fm.h"
+#include "kgraph_map_gg.h"
 #include "kgraph_map_ml.h"
+#include "kgraph_map_pf.h"
 #include "kgraph_map_rb.h"
 #include "kgraph_map_st.h"
 
@@ -114,11 +116,21 @@ static union {
   StratNodeMethodData       padding;
 } kgraphmapstdefaultfm = { { 200, ~0, 0.05 } };
 
+static union {
+  KgraphMapGgParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultgg = { { 1 } };
+
 static union {
   KgraphMapMlParam          param;
   StratNodeMethodData       padding;
 } kgraphmapstdefaultml = { { 100, 0.8, &stratdummy, &stratdummy, 0 } };
 
+static union {
+  KgraphMapPfParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultpf = { { 40, 0.05 } };
+
 static union {
   KgraphMapRbParam          param;
   StratNodeMethodData       padding;
@@ -130,7 +142,9 @@ static StratMethodTab       kgraphmapstmethtab[] = { /* Mapping methods array */
                               { KGRAPHMAPSTMETHDF, "d",  (StratMethodFunc) kgraphMapDf, &kgraphmapstdefaultdf },
                               { KGRAPHMAPSTMETHEX, "x",  (StratMethodFunc) kgraphMapEx, &kgraphmapstdefaultex },
                               { KGRAPHMAPSTMETHFM, "f",  (StratMethodFunc) kgraphMapFm, &kgraphmapstdefaultfm },
+                              { KGRAPHMAPSTMETHGG, "g",  (StratMethodFunc) kgraphMapGg, &kgraphmapstdefaultgg },
                               { KGRAPHMAPSTMETHML, "m",  (StratMethodFunc) kgraphMapMl, &kgraphmapstdefaultml },
+                              { KGRAPHMAPSTMETHPF, "p",  (StratMethodFunc) kgraphMapPf, &kgraphmapstdefaultpf },
                               { KGRAPHMAPSTMETHRB, "r",  (StratMethodFunc) kgraphMapRb, &kgraphmapstdefaultrb },
                               { -1,                NULL, (StratMethodFunc) NULL,        NULL } };
 
@@ -175,6 +189,10 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultfm.param,
                                 (byte *) &kgraphmapstdefaultfm.param.deltval,
                                 NULL },
+                              { KGRAPHMAPSTMETHGG,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultgg.param,
+                                (byte *) &kgraphmapstdefaultgg.param.passnbr,
+                                NULL },
                               { KGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.stratasc,
@@ -194,7 +212,15 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                               { KGRAPHMAPSTMETHML,  STRATPARAMCASE,   "type",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.typeval,
-                                (void *) "hscd" },
+                                (void *) "hscld" },   /* Former 'd' type is heavy-edge matching */
+                              { KGRAPHMAPSTMETHPF,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultpf.param,
+                                (byte *) &kgraphmapstdefaultpf.param.passnbr,
+                                NULL },
+                              { KGRAPHMAPSTMETHPF,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kgraphmapstdefaultpf.param,
+                                (byte *) &kgraphmapstdefaultpf.param.deltval,
+                                NULL },
                               { KGRAPHMAPSTMETHRB,  STRATPARAMCASE,   "job",
                                 (byte *) &kgraphmapstdefaultrb.param,
                                 (byte *) &kgraphmapstdefaultrb.param.flagjobtie,
@@ -249,6 +275,81 @@ StratTab                    kgraphmapststratab = { /* Strategy tables for graph
 /*                                      */
 /****************************************/
 
+/* This routine computes the imbalance of
+** the current mapping, that is, the largest
+** deviation of the load of a domain with
+** respect to its average, relatively to it.
+** It returns:
+** - the imbalance ratio, in all cases.
+*/
+
+static
+double
+kgraphMapStImbalance (
+const Kgraph * restrict const grafptr)
+{
+  Anum                domnnum;
+  double              imbaval;
+
+  for (domnnum = 0, imbaval = 0.0; domnnum < grafptr->m.domnnbr; domnnum ++) {
+    Gnum                comploaddlt;
+    double              imbatmp;
+
+    if (grafptr->comploadavg[domnnum] <= 0)
+      continue;
+
+    comploaddlt = grafptr->comploaddlt[domnnum];
+    imbatmp = (double) ((comploaddlt < 0) ? - comploaddlt : comploaddlt) / (double) grafptr->comploadavg[domnnum];
+    if (imbaval < imbatmp)
+      imbaval = imbatmp;
+  }
+
+  return (imbaval);
+}
+
+/* This routine applies the given method
+** to the given graph, and records the
+** statistics of the call in its context.
+** It returns:
+** - the value returned by the method.
+*/
+
+static
+int
+kgraphMapStStats (
+Kgraph * restrict const       grafptr,            /*+ Active graph to map  +*/
+const Strat * restrict const  straptr)            /*+ Method strategy node +*/
+{
+  StatsRecord         recodat;
+  StatsRecord *       recoold;
+  int                 o;
+
+  recodat.clasptr    = "kgraph";
+  recodat.methptr    = straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr;
+  recodat.levlnum    = grafptr->levlnum;
+  recodat.vertnbr    = grafptr->s.vertnbr;
+  recodat.edgenbr    = grafptr->s.edgenbr;
+  recodat.cutvtab[0] = (double) grafptr->commload;
+  recodat.imbvtab[0] = kgraphMapStImbalance (grafptr);
+  recodat.passnbr    = -1;                        /* Not an iterative method unless it tells so */
+  recodat.passtim    = 0.0;
+  recodat.bandtim    = -1.0;                      /* No band graph built unless method tells so */
+  recodat.timeval    = clockGet ();
+  recoold            = grafptr->contptr->recoptr; /* Save record of enclosing call, if any */
+  grafptr->contptr->recoptr = &recodat;
+
+  o = ((KgraphMapFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+      (grafptr, (void *) &straptr->data.methdat.datadat);
+
+  grafptr->contptr->recoptr = recoold;
+  recodat.timeval    = clockGet () - recodat.timeval;
+  recodat.cutvtab[1] = (double) grafptr->commload;
+  recodat.imbvtab[1] = kgraphMapStImbalance (grafptr);
+  contextStatsAdd (grafptr->contptr, &recodat);   /* Statistics are not critical */
+
+  return (o);
+}
+
 /* This routine computes the given
 ** mapping according to the given
 ** strategy.
@@ -390,6 +491,8 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
 #else /* SCOTCH_DEBUG_KGRAPH1 */
     default :
 #endif /* SCOTCH_DEBUG_KGRAPH1 */
+      if (grafptr->contptr->statptr != NULL)      /* If strategy statistics wanted */
+        return (kgraphMapStStats (grafptr, straptr));
       return (((KgraphMapFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
               (grafptr, (void *) &straptr->data.methdat.datadat));
 #ifdef SCOTCH_DEBUG_KGRAPH1
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2018,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2018,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 08 jun 2011     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 07 nov 2024     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,7 +68,9 @@ typedef enum KgraphMapStMethodType_ {
   KGRAPHMAPSTMETHDF,                              /*+ Diffusion                     +*/
   KGRAPHMAPSTMETHEX,                              /*+ Exactifier                    +*/
   KGRAPHMAPSTMETHFM,                              /*+ Fiduccia-Mattheyses           +*/
+  KGRAPHMAPSTMETHGG,                              /*+ Greedy graph growing          +*/
   KGRAPHMAPSTMETHML,                              /*+ Multi-level (strategy)        +*/
+  KGRAPHMAPSTMETHPF,                              /*+ Threaded frontier refinement  +*/
   KGRAPHMAPSTMETHRB,                              /*+ Dual Recursive Bipartitioning +*/
   KGRAPHMAPSTMETHNBR                              /*+ Number of methods             +*/
 } KgraphMapStMethodType;
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014-2016,2018-2021,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014-2016,2018-2021,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 05 sep 2020     **/
 /**                                 to   : 01 apr 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 03 jun 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -97,7 +97,8 @@ typedef DUMMYINT SCOTCH_Num;
 #ifndef SCOTCH_OPTIONNUMNBR
 #define SCOTCH_OPTIONNUMDETERMINISTIC 0
 #define SCOTCH_OPTIONNUMRANDOMFIXEDSEED 1
-#define SCOTCH_OPTIONNUMNBR         2
+#define SCOTCH_OPTIONNUMMEMORYBUDGET 2
+#define SCOTCH_OPTIONNUMNBR         3
 #endif /* SCOTCH_OPTIONNUMNBR */
 
 /*+ Coarsening flags. +*/
@@ -227,11 +228,18 @@ int                         SCOTCH_contextOptionParse (SCOTCH_Context * const, c
 int                         SCOTCH_contextRandomClone (SCOTCH_Context * const);
 void                        SCOTCH_contextRandomReset (SCOTCH_Context * const);
 void                        SCOTCH_contextRandomSeed (SCOTCH_Context * const, const SCOTCH_Num);
+int                         SCOTCH_contextStatsData (SCOTCH_Context * const, const SCOTCH_Num, const char ** const, const char ** const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const, double * const);
+void                        SCOTCH_contextStatsExit (SCOTCH_Context * const);
+int                         SCOTCH_contextStatsInit (SCOTCH_Context * const);
+SCOTCH_Num                  SCOTCH_contextStatsNbr (SCOTCH_Context * const);
+int                         SCOTCH_contextStatsSave (SCOTCH_Context * const, FILE * const);
 int                         SCOTCH_contextThreadImport1 (SCOTCH_Context * const, const int);
 int                         SCOTCH_contextThreadImport2 (SCOTCH_Context * const, const int);
 int                         SCOTCH_contextThreadSpawn (SCOTCH_Context * const, const int, const int * const);
 int                         SCOTCH_contextBindGraph (SCOTCH_Context * const, const SCOTCH_Graph * const, SCOTCH_Graph * const);
 int                         SCOTCH_contextBindMesh (SCOTCH_Context * const, const SCOTCH_Mesh * const, SCOTCH_Mesh * const);
+void                        SCOTCH_contextCoarsenCacheExit (SCOTCH_Context * const);
+int                         SCOTCH_contextCoarsenCacheInit (SCOTCH_Context * const);
 
 void                        SCOTCH_errorProg    (const char * const);
 void                        SCOTCH_errorPrint   (const char * const, ...);
@@ -262,10 +270,12 @@ void                        SCOTCH_graphSize    (const SCOTCH_Graph * const, SCO
 void                        SCOTCH_graphStat    (const SCOTCH_Graph * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const);
 SCOTCH_Num                  SCOTCH_graphDiamPV  (const SCOTCH_Graph * const);
 int                         SCOTCH_graphDump    (const SCOTCH_Graph * const, const char * const, const char * const, FILE * const);
+int                         SCOTCH_graphGeomLoadBgrf (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadChac (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadHabo (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadMmkt (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadScot (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
+int                         SCOTCH_graphGeomSaveBgrf (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveChac (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveMmkt (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveScot (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
@@ -278,6 +288,7 @@ int                         SCOTCH_graphMapLoad (const SCOTCH_Graph * const, SCO
 int                         SCOTCH_graphMapSave (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, FILE * const);
 int                         SCOTCH_graphMapCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Strat * const);
 int                         SCOTCH_graphMapFixedCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Strat * const);
+int                         SCOTCH_graphMapIncrCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const double, SCOTCH_Strat * const);
 int                         SCOTCH_graphMap     (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphMapFixed (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphMapView (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, FILE * const);
@@ -1,4 +1,4 @@
-/* Copyright 2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                library.                                **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 03 jun 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -181,6 +181,130 @@ const SCOTCH_Num            seedval)
   intRandSeed (((Context *) libcontptr)->randptr, seedval);
 }
 
+/****************************************/
+/*                                      */
+/* These routines handle the statistics */
+/* features of contexts.                */
+/*                                      */
+/****************************************/
+
+/*+ This routine enables the recording of
+*** strategy method statistics in the given
+*** context. If recording is already enabled,
+*** previously recorded statistics are discarded.
+*** It returns:
+*** - 0   : if recording enabled.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatsInit (
+SCOTCH_Context * const      libcontptr)
+{
+  return (contextStatsInit ((Context *) libcontptr));
+}
+
+/*+ This routine disables the recording of
+*** strategy method statistics in the given
+*** context, and frees the recorded data.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_contextStatsExit (
+SCOTCH_Context * const      libcontptr)
+{
+  contextStatsExit ((Context *) libcontptr);
+}
+
+/*+ This routine returns the number of
+*** strategy method calls recorded in the
+*** given context.
+*** It returns:
+*** - the number of records, in all cases.
++*/
+
+SCOTCH_Num
+SCOTCH_contextStatsNbr (
+SCOTCH_Context * const      libcontptr)
+{
+  return ((SCOTCH_Num) contextStatsNbr ((Context *) libcontptr));
+}
+
+/*+ This routine returns the data of the given
+*** statistics record. Any output pointer may be
+*** NULL if the corresponding value is not wanted.
+*** Cut and imbalance arrays hold the values before
+*** and after the method call; negative values mean
+*** that the quantity does not apply to the class.
+*** It returns:
+*** - 0   : if the record exists.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatsData (
+SCOTCH_Context * const      libcontptr,
+const SCOTCH_Num            reconum,
+const char ** const         clasptr,
+const char ** const         methptr,
+SCOTCH_Num * const          levlptr,
+SCOTCH_Num * const          vertptr,
+SCOTCH_Num * const          edgeptr,
+double * const              cutvtab,
+double * const              imbvtab,
+double * const              timeptr)
+{
+  Context * restrict const      contptr = (Context *) libcontptr;
+  const StatsRecord * restrict  recoptr;
+
+  if ((reconum < 0) || (reconum >= (SCOTCH_Num) contextStatsNbr (contptr))) {
+    errorPrint (STRINGIFY (SCOTCH_contextStatsData) ": invalid record number");
+    return (1);
+  }
+
+  recoptr = contextStatsData (contptr, (INT) reconum);
+  if (clasptr != NULL)
+    *clasptr = recoptr->clasptr;
+  if (methptr != NULL)
+    *methptr = recoptr->methptr;
+  if (levlptr != NULL)
+    *levlptr = (SCOTCH_Num) recoptr->levlnum;
+  if (vertptr != NULL)
+    *vertptr = (SCOTCH_Num) recoptr->vertnbr;
+  if (edgeptr != NULL)
+    *edgeptr = (SCOTCH_Num) recoptr->edgenbr;
+  if (cutvtab != NULL) {
+    cutvtab[0] = recoptr->cutvtab[0];
+    cutvtab[1] = recoptr->cutvtab[1];
+  }
+  if (imbvtab != NULL) {
+    imbvtab[0] = recoptr->imbvtab[0];
+    imbvtab[1] = recoptr->imbvtab[1];
+  }
+  if (timeptr != NULL)
+    *timeptr = recoptr->timeval;
+
+  return (0);
+}
+
+/*+ This routine saves the statistics recorded
+*** in the given context to the given stream,
+*** in JSON format.
+*** It returns:
+*** - 0   : if statistics saved.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatsSave (
+SCOTCH_Context * const      libcontptr,
+FILE * const                stream)
+{
+  return (contextStatsSave ((Context *) libcontptr, stream));
+}
+
 /************************************/
 /*                                  */
 /* These routines handle the thread */
@@ -303,7 +427,7 @@ const SCOTCH_Num            optival)
   optitmp = optival;                              /* Set working value */
   o = 0;                                          /* Assume no error   */
 
-  switch (optival) {
+  switch (optinum) {
     case CONTEXTOPTIONNUMRANDOMFIXEDSEED :
       if (optitmp != 0)
         optitmp = 1;                              /* Only two values available */
@@ -315,6 +439,12 @@ const SCOTCH_Num            optival)
         o = contextValuesSetInt ((Context *) libcontptr, CONTEXTOPTIONNUMRANDOMFIXEDSEED, 1); /* If deterministic behavior wanted, use fixed random seed */
       }
       break;
+    case CONTEXTOPTIONNUMMEMORYBUDGET :
+      if (optitmp < 0) {
+        errorPrint (STRINGIFY (SCOTCH_contextOptionSetNum) ": invalid memory budget");
+        return (1);
+      }
+      break;
     default :
       errorPrint (STRINGIFY (SCOTCH_contextOptionSetNum) ": invalid option name");
       return (1);
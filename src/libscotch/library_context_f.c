@@ -1,4 +1,4 @@
-/* Copyright 2020,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2020,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                libSCOTCH library.                      **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 22 aug 2020     **/
-/**                                 to   : 03 jun 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -138,6 +138,79 @@ SCOTCH_Num * const          seedptr),   \
 **
 */
 
+SCOTCH_FORTRAN (                      \
+CONTEXTSTATSINIT, contextstatsinit, ( \
+SCOTCH_Context * const      contptr,  \
+int * const                 revaptr), \
+(contptr, revaptr))
+{
+  *revaptr = SCOTCH_contextStatsInit (contptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+CONTEXTSTATSEXIT, contextstatsexit, ( \
+SCOTCH_Context * const      contptr), \
+(contptr))
+{
+  SCOTCH_contextStatsExit (contptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+CONTEXTSTATSNBR, contextstatsnbr, (   \
+SCOTCH_Context * const      contptr,  \
+SCOTCH_Num * const          reconbr), \
+(contptr, reconbr))
+{
+  *reconbr = SCOTCH_contextStatsNbr (contptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+CONTEXTSTATSSAVE, contextstatssave, ( \
+SCOTCH_Context * const      contptr,  \
+int * const                 fileptr,  \
+int * const                 revaptr), \
+(contptr, fileptr, revaptr))
+{
+  FILE *              stream;                     /* Stream to build from handle */
+  int                 filenum;                    /* Duplicated handle           */
+  int                 o;
+
+  if ((filenum = dup (*fileptr)) < 0) {           /* If cannot duplicate file descriptor */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (CONTEXTSTATSSAVE)) ": cannot duplicate handle");
+
+    *revaptr = 1;                                 /* Indicate error */
+    return;
+  }
+  if ((stream = fdopen (filenum, "w")) == NULL) { /* Build stream from handle */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (CONTEXTSTATSSAVE)) ": cannot open output stream");
+    close      (filenum);
+    *revaptr = 1;
+    return;
+  }
+
+  o = SCOTCH_contextStatsSave (contptr, stream);
+
+  fclose (stream);                                /* This closes filenum too */
+
+  *revaptr = o;
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                              \
 CONTEXTTHREADIMPORT1, contextthreadimport1, ( \
 SCOTCH_Context * const      contptr,          \
@@ -1,4 +1,4 @@
-/* Copyright 2019,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                library.                                **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 24 oct 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -51,7 +51,9 @@
 #include "module.h"
 #include "common.h"
 #include "context.h"
+#include "arch.h"
 #include "graph.h"
+#include "graph_coarsen.h"
 #include "scotch.h"
 
 /****************************************/
@@ -107,3 +109,43 @@ SCOTCH_Graph * restrict const       cntgrafptr)
 
   return (0);
 }
+
+/*+ This routine enables the caching of the
+*** coarsening hierarchies built by the k-way
+*** multilevel mapping method in the given
+*** context. Subsequent mappings of the same
+*** graph with the same method parameters then
+*** re-use the cached coarse graphs, and only
+*** aggregate the current vertex loads across
+*** levels. Only the outermost multilevel
+*** call of a strategy uses the cache. If
+*** caching is already enabled, cached data
+*** are discarded, which should be done
+*** whenever the graph is re-built with
+*** another topology, or its topology or
+*** edge loads are modified.
+*** It returns:
+*** - 0   : if caching enabled.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextCoarsenCacheInit (
+SCOTCH_Context * const      libcontptr)
+{
+  return (graphCoarsenCacheInit ((Context *) libcontptr));
+}
+
+/*+ This routine disables the caching of
+*** coarsening hierarchies in the given
+*** context, and frees the cached data.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_contextCoarsenCacheExit (
+SCOTCH_Context * const      libcontptr)
+{
+  graphCoarsenCacheExit ((Context *) libcontptr);
+}
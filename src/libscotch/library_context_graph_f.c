@@ -1,4 +1,4 @@
-/* Copyright 2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                libSCOTCH library.                      **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 22 aug 2020     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -73,3 +73,28 @@ int * const                 revaptr),   \
 {
   *revaptr = SCOTCH_contextBindGraph (contptr, orggrafptr, cntgrafptr);
 }
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                                    \
+CONTEXTCOARSENCACHEINIT, contextcoarsencacheinit, ( \
+SCOTCH_Context * const      contptr,                \
+int * const                 revaptr),               \
+(contptr, revaptr))
+{
+  *revaptr = SCOTCH_contextCoarsenCacheInit (contptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                                    \
+CONTEXTCOARSENCACHEEXIT, contextcoarsencacheexit, ( \
+SCOTCH_Context * const      contptr),               \
+(contptr))
+{
+  SCOTCH_contextCoarsenCacheExit (contptr);
+}
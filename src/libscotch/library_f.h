@@ -53,7 +53,7 @@
 !*                # Version 6.1  : from : 22 jun 2021     **
 !*                                 to   : 22 jun 2021     **
 !*                # Version 7.0  : from : 25 aug 2019     **
-!*                                 to   : 23 oct 2021     **
+!*                                 to   : 18 oct 2026     **
 !*                                                        **
 !***********************************************************
 
@@ -69,10 +69,12 @@
 
         INTEGER SCOTCH_OPTIONNUMDETERMINISTIC
         INTEGER SCOTCH_OPTIONNUMRANDOMFIXEDSEED
+        INTEGER SCOTCH_OPTIONNUMMEMORYBUDGET
         INTEGER SCOTCH_OPTIONNUMNBR
         PARAMETER (SCOTCH_OPTIONNUMDETERMINISTIC   = 0)
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
-        PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
+        PARAMETER (SCOTCH_OPTIONNUMMEMORYBUDGET    = 2)
+        PARAMETER (SCOTCH_OPTIONNUMNBR             = 3)
 
 !* Flag definitions for the coarsening
 !* routines.
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 31 may 2021     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -162,6 +162,8 @@ SCOTCH_Graph * const        grafptr)
 *** to -1. On input, vertex loads are discarded if
 *** flagval is 1, edge loads are discarded if flagval
 *** is 2, and both if flagval is set to 3.
+*** Text graph data are parsed concurrently
+*** by the threads of the graph context.
 *** It returns:
 *** - 0   : if the loading succeeded.
 *** - !0  : on error.
@@ -175,6 +177,9 @@ const SCOTCH_Num            baseval,
 const SCOTCH_Num            flagval)
 {
   GraphFlag           srcgrafflag;                /* Graph flags */
+  int                 o;
+
+  CONTEXTDECL        (grafptr);
 
   if ((flagval < 0) || (flagval > 3)) {
     errorPrint (STRINGIFY (SCOTCH_graphLoad) ": invalid flag parameter");
@@ -192,7 +197,16 @@ const SCOTCH_Num            flagval)
   srcgrafflag = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
                 (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
 
-  return (graphLoad ((Graph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag));
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphLoad) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphLoadThread ((Graph * const) CONTEXTGETOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
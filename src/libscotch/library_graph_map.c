@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -71,6 +71,7 @@
 #include "kgraph.h"
 #include "kgraph_map_st.h"
 #include "library_mapping.h"
+#include "library_graph_map.h"
 #include "scotch.h"
 
 /************************************/
@@ -98,6 +99,7 @@ SCOTCH_Num * const          parttab)              /*+ Mapping array
   LibMapping * restrict const lmapptr = (LibMapping *) mappptr;
 
   lmapptr->flagval = LIBMAPPINGNONE;              /* No options set */
+  lmapptr->incrptr = NULL;                        /* No incremental mapping data yet */
   lmapptr->grafptr = (Graph *) CONTEXTOBJECT (grafptr);
   lmapptr->archptr = (Arch *)  archptr;
   if (parttab == NULL) {
@@ -114,6 +116,31 @@ SCOTCH_Num * const          parttab)              /*+ Mapping array
   return (0);
 }
 
+/*+ This routine frees the incremental
+*** mapping data of an API mapping, if any.
+*** It returns:
+*** - VOID  : in all cases.
++*/
+
+static
+void
+graphMapIncrExit (
+LibMapping * restrict const lmapptr)
+{
+  LibMappingIncr * restrict const incrptr = lmapptr->incrptr;
+
+  if (incrptr == NULL)                            /* If no incremental mapping data */
+    return;
+
+  if (incrptr->straptr != NULL)
+    stratExit (incrptr->straptr);
+  kgraphExit (&incrptr->grafdat);                 /* Private load array is not freed by graph */
+  memFree    (incrptr->velotab);
+  memFree    (incrptr);
+
+  lmapptr->incrptr = NULL;
+}
+
 /*+ This routine frees an API mapping.
 *** It returns:
 *** - VOID  : in all cases.
@@ -126,6 +153,8 @@ SCOTCH_Mapping * const      mappptr)
 {
   LibMapping * restrict const lmapptr = (LibMapping *) mappptr;
 
+  graphMapIncrExit (lmapptr);                     /* Free incremental mapping data, if any */
+
   if (((lmapptr->flagval & LIBMAPPINGFREEPART) != 0) && /* If parttab must be freed */
       (lmapptr->parttab != NULL))                 /* And if exists                  */
     memFree (lmapptr->parttab);                   /* Free it                        */
@@ -269,6 +298,8 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
     crloval = 1;
   }
 
+  graphMapIncrExit (lmapptr);                     /* Kept incremental data would no longer match mapping */
+
   if (kgraphInit (&mapgrafdat, grafptr, lmapptr->archptr, &domnorg, vfixnbr, pfixtax, crloval, cmloval, vmlotax) != 0)
     goto abort;
 
@@ -389,6 +420,312 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   return (graphMapCompute2 (grafptr, mappptr, mapoptr, emraval, vmlotab, vfixnbr, straptr));
 }
 
+/*+ This routine computes the maximum
+*** imbalance ratio of the parts of the
+*** given mapping graph.
+*** It returns:
+*** - the imbalance ratio.
++*/
+
+static
+double
+graphMapIncrImbalance (
+const Kgraph * restrict const grafptr)
+{
+  Anum                domnnum;
+  double              imbaval;
+
+  for (domnnum = 0, imbaval = 0.0; domnnum < grafptr->m.domnnbr; domnnum ++) {
+    Gnum                comploaddlt;
+    double              imbatmp;
+
+    if (grafptr->comploadavg[domnnum] <= 0)
+      continue;
+
+    comploaddlt = grafptr->comploaddlt[domnnum];
+    imbatmp = (double) ((comploaddlt < 0) ? - comploaddlt : comploaddlt) / (double) grafptr->comploadavg[domnnum];
+    if (imbaval < imbatmp)
+      imbaval = imbatmp;
+  }
+
+  return (imbaval);
+}
+
+/*+ This routine computes a full mapping,
+*** or a full remapping with respect to the
+*** current contents of the part array, of
+*** the incremental mapping graph, which is
+*** rebuilt from the given source graph and
+*** the private vertex load array. Upon
+*** success, the frontier and load arrays
+*** of the mapping graph are up to date, so
+*** that it can be refined incrementally.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error; the mapping graph has
+***         then been freed.
++*/
+
+static
+int
+graphMapIncrFull (
+LibMapping * restrict const     lmapptr,          /*+ Mapping to compute                +*/
+LibMappingIncr * restrict const incrptr,          /*+ Incremental mapping data          +*/
+const Graph * restrict const    srcgrafptr,       /*+ Source graph                      +*/
+const Gnum                      velosum,          /*+ Sum of private vertex loads       +*/
+Context * restrict const        contptr,          /*+ Execution context                 +*/
+const Strat * restrict const    straptr,          /*+ Mapping strategy                  +*/
+const int                       remaflag)         /*+ Flag set if remapping from parttab +*/
+{
+  Graph               grafdat;
+  ArchDom             domnorg;
+  int                 o;
+
+  Kgraph * restrict const mapgrafptr = &incrptr->grafdat;
+  const Gnum              baseval    = srcgrafptr->baseval;
+
+  grafdat         = *srcgrafptr;                  /* Use private vertex loads */
+  grafdat.velotax = incrptr->velotab - baseval;
+  grafdat.velosum = velosum;
+
+  archDomFrst (lmapptr->archptr, &domnorg);
+  if (kgraphInit (mapgrafptr, &grafdat, lmapptr->archptr, &domnorg, 0, NULL, 1, 1, NULL) != 0)
+    return (1);
+
+  if (remaflag != 0) {                            /* If remapping from current mapping, fill old mapping structure */
+    if (mapAlloc (&mapgrafptr->r.m) != 0) {
+      errorPrint ("graphMapIncrFull: cannot initialize remapping (1)");
+      kgraphExit (mapgrafptr);
+      return (1);
+    }
+
+    memSet (mapgrafptr->r.m.parttax + baseval, ~0, srcgrafptr->vertnbr * sizeof (Anum));
+    mapgrafptr->r.m.flagval |= MAPPINGINCOMPLETE;
+
+    if (mapBuild (&mapgrafptr->r.m, lmapptr->parttab - baseval) != 0) {
+      errorPrint ("graphMapIncrFull: cannot initialize remapping (2)");
+      kgraphExit (mapgrafptr);
+      return (1);
+    }
+  }
+
+  mapgrafptr->contptr = contptr;
+
+  if ((o = kgraphMapSt (mapgrafptr, straptr)) != 0) {
+    kgraphExit (mapgrafptr);
+    return (o);
+  }
+
+  mapExit  (&mapgrafptr->r.m);                    /* Old mapping is of no use for later refinements */
+  mapInit2 (&mapgrafptr->r.m, &mapgrafptr->s, lmapptr->archptr, mapgrafptr->m.domnmax, 0);
+
+  kgraphFron (mapgrafptr);                        /* Not all methods keep frontier and loads up to date */
+  kgraphCost (mapgrafptr);
+  mapTerm    (&mapgrafptr->m, lmapptr->parttab - baseval); /* Propagate mapping result to part array */
+
+  return (0);
+}
+
+/*+ This routine computes a mapping of the
+*** API mapping structure incrementally,
+*** after the loads of some vertices have
+*** changed. The first call computes a full
+*** mapping and keeps the resulting mapping
+*** graph, with its frontier and part loads,
+*** within the mapping structure. Subsequent
+*** calls only update part loads according
+*** to the given load deltas, and refine the
+*** kept mapping locally, around its frontier.
+*** When the imbalance of the refined mapping
+*** is above the given ratio, a full remapping
+*** is computed, with respect to the given
+*** strategy.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphMapIncrCompute (
+SCOTCH_Graph * const        actgrafptr,           /*+ Graph to map                       +*/
+SCOTCH_Mapping * const      mappptr,              /*+ Mapping to compute                 +*/
+const SCOTCH_Num            vchgnbr,              /*+ Number of vertices with new loads  +*/
+const SCOTCH_Num * const    vchgtab,              /*+ Array of (based) vertex numbers    +*/
+const SCOTCH_Num * const    veldtab,              /*+ Array of vertex load deltas        +*/
+const double                kbalval,              /*+ Maximum imbalance ratio            +*/
+SCOTCH_Strat * const        straptr)              /*+ Full mapping strategy              +*/
+{
+  LibMappingIncr *    incrptr;
+  Kgraph *            mapgrafptr;
+  ArchDom             domnorg;
+  CONTEXTDECL        (actgrafptr);
+  Gnum * restrict     velotax;
+  Gnum                velosum;
+  Gnum                vchgnum;
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  if (CONTEXTINIT (actgrafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": cannot initialize context");
+    return (o);
+  }
+
+  const Graph * restrict const  grafptr = (Graph *) CONTEXTGETOBJECT (actgrafptr);
+  LibMapping * restrict const   lmapptr = (LibMapping *) mappptr;
+  const Gnum                    baseval = grafptr->baseval;
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if (grafptr != lmapptr->grafptr) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": mapping does not correspond to input graph");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+  if (lmapptr->parttab == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": missing output mapping part array");
+    goto abort;
+  }
+  for (vchgnum = 0; vchgnum < vchgnbr; vchgnum ++) {
+    if ((vchgtab[vchgnum] < baseval) || (vchgtab[vchgnum] >= grafptr->vertnnd)) {
+      errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": invalid vertex number");
+      goto abort;
+    }
+  }
+
+  archDomFrst (lmapptr->archptr, &domnorg);       /* Compute initial domain to map to */
+
+  if (*((Strat **) straptr) == NULL)              /* Set default mapping strategy if necessary */
+    SCOTCH_stratGraphMapBuild (straptr, SCOTCH_STRATDEFAULT, archDomSize (lmapptr->archptr, &domnorg), kbalval);
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((*((Strat **) straptr))->tablptr != &kgraphmapststratab) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": not a graph mapping strategy");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  incrptr = lmapptr->incrptr;
+  if (incrptr == NULL) {                          /* If first call, create incremental data with private loads */
+    Gnum                vertnum;
+
+    if (((incrptr = memAlloc (sizeof (LibMappingIncr))) == NULL) ||
+        ((incrptr->velotab = memAlloc (grafptr->vertnbr * sizeof (Gnum))) == NULL)) {
+      errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": out of memory");
+      if (incrptr != NULL)
+        memFree (incrptr);
+      goto abort;
+    }
+    incrptr->straptr = NULL;
+    incrptr->kbalval = -1.0;                      /* No refinement strategy built yet */
+
+    if (grafptr->velotax != NULL)
+      memCpy (incrptr->velotab, grafptr->velotax + baseval, grafptr->vertnbr * sizeof (Gnum));
+    else {
+      for (vertnum = 0; vertnum < grafptr->vertnbr; vertnum ++)
+        incrptr->velotab[vertnum] = 1;
+    }
+    mapgrafptr = NULL;                            /* No mapping graph yet */
+    velotax    = incrptr->velotab - baseval;
+    velosum    = grafptr->velosum;
+  }
+  else {
+    mapgrafptr = &incrptr->grafdat;
+    velotax    = (Gnum *) mapgrafptr->s.velotax;  /* Private load array */
+    velosum    = mapgrafptr->s.velosum;
+
+    if ((archVar (lmapptr->archptr) == 0) &&      /* If refinement strategy must be (re)built, do it before loads are changed */
+        (incrptr->kbalval != kbalval)) {
+      char                bufftab[256];
+      char                kbaltab[64];
+
+      if (incrptr->straptr != NULL)
+        stratExit (incrptr->straptr);
+
+      sprintf (kbaltab, "%lf", kbalval);
+      strcpy (bufftab, LIBMAPPINGINCRSTRAT);
+      stringSubst (bufftab, "<KBAL>", kbaltab);
+      if ((incrptr->straptr = stratInit (&kgraphmapststratab, bufftab)) == NULL) {
+        errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": cannot build refinement strategy");
+        incrptr->kbalval = -1.0;
+        goto abort;
+      }
+      incrptr->kbalval = kbalval;
+    }
+  }
+
+  for (vchgnum = 0; vchgnum < vchgnbr; vchgnum ++) { /* Apply load deltas */
+    Gnum                vertnum;
+
+    vertnum = vchgtab[vchgnum];
+    velotax[vertnum] += veldtab[vchgnum];
+    velosum          += veldtab[vchgnum];
+    if (velotax[vertnum] < 0)
+      break;
+    if (mapgrafptr != NULL)                       /* Update load of part of vertex */
+      mapgrafptr->comploaddlt[mapgrafptr->m.parttax[vertnum]] += veldtab[vchgnum];
+  }
+  if (vchgnum < vchgnbr) {                        /* If negative vertex load, roll back deltas */
+    errorPrint (STRINGIFY (SCOTCH_graphMapIncrCompute) ": invalid load delta");
+    velotax[vchgtab[vchgnum]] -= veldtab[vchgnum];
+    while (vchgnum -- > 0) {
+      velotax[vchgtab[vchgnum]] -= veldtab[vchgnum];
+      if (mapgrafptr != NULL)
+        mapgrafptr->comploaddlt[mapgrafptr->m.parttax[vchgtab[vchgnum]]] -= veldtab[vchgnum];
+    }
+    if (mapgrafptr == NULL) {                     /* Do not keep incremental data that were just created */
+      memFree (incrptr->velotab);
+      memFree (incrptr);
+    }
+    goto abort;
+  }
+
+  if (mapgrafptr == NULL) {                       /* If first call, compute full mapping */
+    if ((o = graphMapIncrFull (lmapptr, incrptr, grafptr, velosum, CONTEXTGETDATA (actgrafptr), *((Strat **) straptr), 0)) != 0) {
+      memFree (incrptr->velotab);
+      memFree (incrptr);
+      goto abort;
+    }
+    lmapptr->incrptr = incrptr;
+    goto abort;
+  }
+
+  mapgrafptr->s.velosum = velosum;                /* Update average part loads and their deltas */
+  mapgrafptr->comploadrat = (double) velosum / (double) archDomWght (lmapptr->archptr, &mapgrafptr->domnorg);
+  if (archVar (lmapptr->archptr) == 0) {          /* Only refine on fixed-size architectures */
+    Anum                domnnum;
+    double              domnrat;
+
+    domnrat = (double) archDomWght (lmapptr->archptr, &domnorg);
+    for (domnnum = 0; domnnum < mapgrafptr->m.domnnbr; domnnum ++) {
+      Gnum                comploadavg;
+
+      comploadavg = (Gnum) ((double) velosum * ((double) archDomWght (lmapptr->archptr, &mapgrafptr->m.domntab[domnnum]) / domnrat));
+      mapgrafptr->comploaddlt[domnnum] += mapgrafptr->comploadavg[domnnum] - comploadavg;
+      mapgrafptr->comploadavg[domnnum]  = comploadavg;
+    }
+
+    mapgrafptr->contptr = CONTEXTGETDATA (actgrafptr);
+    if ((kgraphMapSt (mapgrafptr, incrptr->straptr) == 0) && /* If local refinement succeeded and mapping is balanced enough */
+        (graphMapIncrImbalance (mapgrafptr) <= kbalval)) {
+      mapTerm (&mapgrafptr->m, lmapptr->parttab - baseval);
+      o = 0;
+      goto abort;
+    }
+  }
+
+  kgraphExit (mapgrafptr);                        /* Recompute full remapping from current part array */
+  if ((o = graphMapIncrFull (lmapptr, incrptr, grafptr, velosum, CONTEXTGETDATA (actgrafptr), *((Strat **) straptr), 1)) != 0) {
+    if (incrptr->straptr != NULL)                 /* Mapping graph has been freed; free remaining data */
+      stratExit (incrptr->straptr);
+    memFree (incrptr->velotab);
+    memFree (incrptr);
+    lmapptr->incrptr = NULL;
+  }
+
+abort:
+  CONTEXTEXIT (actgrafptr);
+  return (o);
+}
+
 /*+ This routine computes a mapping of the
 *** given graph structure onto the given
 *** target architecture with respect to the
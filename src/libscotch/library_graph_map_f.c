@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010-2012,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010-2012,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 17 apr 2011     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -132,6 +132,25 @@ int * const                 revaptr),         \
 **
 */
 
+SCOTCH_FORTRAN (                            \
+GRAPHMAPINCRCOMPUTE, graphmapincrcompute, ( \
+SCOTCH_Graph * const        grafptr,        \
+SCOTCH_Mapping * const      mappptr,        \
+const SCOTCH_Num * const    vchgptr,        \
+const SCOTCH_Num * const    vchgtab,        \
+const SCOTCH_Num * const    veldtab,        \
+const double * const        kbalptr,        \
+SCOTCH_Strat * const        straptr,        \
+int * const                 revaptr),       \
+(grafptr, mappptr, vchgptr, vchgtab, veldtab, kbalptr, straptr, revaptr))
+{
+  *revaptr = SCOTCH_graphMapIncrCompute (grafptr, mappptr, *vchgptr, vchgtab, veldtab, *kbalptr, straptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                        \
 GRAPHREMAPCOMPUTE, graphremapcompute, ( \
 SCOTCH_Graph * const        grafptr,    \
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2011 ENSEIRB, INRIA & CNRS
+/* Copyright 2004,2007,2010,2011,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,6 +46,8 @@
 /**                                 to   : 17 nov 2010     **/
 /**                # Version 6.0  : from : 15 apr 2011     **/
 /**                                 to   : 23 aug 2014     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,7 +69,8 @@
 
 typedef struct LibMapping_ {
   Gnum                      flagval;
-  Graph *                   grafptr;              /*+ Graph data        +*/
-  Arch *                    archptr;              /*+ Architecture data +*/
-  Gnum *                    parttab;              /*+ Mapping array     +*/
+  Graph *                   grafptr;              /*+ Graph data                       +*/
+  Arch *                    archptr;              /*+ Architecture data                +*/
+  Gnum *                    parttab;              /*+ Mapping array                    +*/
+  struct LibMappingIncr_ *  incrptr;              /*+ Incremental mapping data, if any +*/
 } LibMapping;
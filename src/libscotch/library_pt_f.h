@@ -51,7 +51,7 @@
 !*                # Version 6.0  : from : 22 oct 2011     **
 !*                                 to   : 27 nov 2012     **
 !*                # Version 7.0  : from : 28 jul 2024     **
-!*                                 to   : 13 jun 2025     **
+!*                                 to   : 18 oct 2026     **
 !*                                                        **
 !***********************************************************
 
@@ -67,10 +67,12 @@
 
         INTEGER SCOTCH_OPTIONNUMDETERMINISTIC
         INTEGER SCOTCH_OPTIONNUMRANDOMFIXEDSEED
+        INTEGER SCOTCH_OPTIONNUMMEMORYBUDGET
         INTEGER SCOTCH_OPTIONNUMNBR
         PARAMETER (SCOTCH_OPTIONNUMDETERMINISTIC   = 0)
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
-        PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
+        PARAMETER (SCOTCH_OPTIONNUMMEMORYBUDGET    = 2)
+        PARAMETER (SCOTCH_OPTIONNUMNBR             = 3)
 
 !* Flag definitions for the coarsening
 !* routines.
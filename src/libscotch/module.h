@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 24 aug 2020     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 19 feb 2018     **/
-/**                                 to   : 05 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -307,14 +307,31 @@
 
 #define commonStubDummy             SCOTCH_NAME_INTERN (commonStubDummy)
 
+#define contextArenaAllocGroup      SCOTCH_NAME_INTERN (contextArenaAllocGroup)
+#define contextArenaExit            SCOTCH_NAME_INTERN (contextArenaExit)
+#define contextArenaExit2           SCOTCH_NAME_INTERN (contextArenaExit2)
+#define contextArenaFree            SCOTCH_NAME_INTERN (contextArenaFree)
+#define contextArenaInit            SCOTCH_NAME_INTERN (contextArenaInit)
+#define contextArenaInit2           SCOTCH_NAME_INTERN (contextArenaInit2)
 #define contextCommit               SCOTCH_NAME_INTERN (contextCommit)
 #define contextExit                 SCOTCH_NAME_INTERN (contextExit)
 #define contextInit                 SCOTCH_NAME_INTERN (contextInit)
 #define contextOptionsInit          SCOTCH_NAME_INTERN (contextOptionsInit)
 #define contextRandomClone          SCOTCH_NAME_INTERN (contextRandomClone)
+#define contextStatsAdd             SCOTCH_NAME_INTERN (contextStatsAdd)
+#define contextStatsArena           SCOTCH_NAME_INTERN (contextStatsArena)
+#define contextStatsBand            SCOTCH_NAME_INTERN (contextStatsBand)
+#define contextStatsData            SCOTCH_NAME_INTERN (contextStatsData)
+#define contextStatsExit            SCOTCH_NAME_INTERN (contextStatsExit)
+#define contextStatsInit            SCOTCH_NAME_INTERN (contextStatsInit)
+#define contextStatsNbr             SCOTCH_NAME_INTERN (contextStatsNbr)
+#define contextStatsPass            SCOTCH_NAME_INTERN (contextStatsPass)
+#define contextStatsSave            SCOTCH_NAME_INTERN (contextStatsSave)
 #define contextThreadInit           SCOTCH_NAME_INTERN (contextThreadInit)
 #define contextThreadInit2          SCOTCH_NAME_INTERN (contextThreadInit2)
+#define contextThreadLaunchMulti    SCOTCH_NAME_INTERN (contextThreadLaunchMulti)
 #define contextThreadLaunchSplit    SCOTCH_NAME_INTERN (contextThreadLaunchSplit)
+#define contextThreadLaunchTask     SCOTCH_NAME_INTERN (contextThreadLaunchTask)
 
 #define contextValuesGetDbl         SCOTCH_NAME_INTERN (contextValuesGetDbl)
 #define contextValuesGetInt         SCOTCH_NAME_INTERN (contextValuesGetInt)
@@ -713,6 +730,7 @@
 #define bgraphCheck                 SCOTCH_NAME_INTERN (bgraphCheck)
 #define bgraphCost                  SCOTCH_NAME_INTERN (bgraphCost)
 #define bgraphCost2                 SCOTCH_NAME_INTERN (bgraphCost2)
+#define bgraphCostVert              SCOTCH_NAME_INTERN (bgraphCostVert)
 #define bgraphSwal                  SCOTCH_NAME_INTERN (bgraphSwal)
 #define bgraphZero                  SCOTCH_NAME_INTERN (bgraphZero)
 #define bgraphBipartBd              SCOTCH_NAME_INTERN (bgraphBipartBd)
@@ -724,6 +742,8 @@
 #define bgraphBipartGg              SCOTCH_NAME_INTERN (bgraphBipartGg)
 #define bgraphBipartGp              SCOTCH_NAME_INTERN (bgraphBipartGp)
 #define bgraphBipartMl              SCOTCH_NAME_INTERN (bgraphBipartMl)
+#define bgraphBipartMt              SCOTCH_NAME_INTERN (bgraphBipartMt)
+#define bgraphBipartPf              SCOTCH_NAME_INTERN (bgraphBipartPf)
 #define bgraphBipartSt              SCOTCH_NAME_INTERN (bgraphBipartSt)
 #define bgraphBipartZr              SCOTCH_NAME_INTERN (bgraphBipartZr)
 #define bgraphStoreInit             SCOTCH_NAME_INTERN (bgraphStoreInit)
@@ -845,15 +865,31 @@
 #define graphExit                   SCOTCH_NAME_INTERN (graphExit)
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
+#define graphLoad1                  SCOTCH_NAME_INTERN (graphLoad1)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadBgrf               SCOTCH_NAME_INTERN (graphLoadBgrf)
+#define graphLoadThread             SCOTCH_NAME_INTERN (graphLoadThread)
+#define graphPack                   SCOTCH_NAME_INTERN (graphPack)
+#define graphPackRead               SCOTCH_NAME_INTERN (graphPackRead)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
+#define graphSaveBgrf               SCOTCH_NAME_INTERN (graphSaveBgrf)
+#define graphUnmapBgrf              SCOTCH_NAME_INTERN (graphUnmapBgrf)
+#define graphUnpack                 SCOTCH_NAME_INTERN (graphUnpack)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
 #define graphClone                  SCOTCH_NAME_INTERN (graphClone)
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
 #define graphCoarsenBuild           SCOTCH_NAME_INTERN (graphCoarsenBuild)
+#define graphCoarsenCache           SCOTCH_NAME_INTERN (graphCoarsenCache)
+#define graphCoarsenCacheEnter      SCOTCH_NAME_INTERN (graphCoarsenCacheEnter)
+#define graphCoarsenCacheExit       SCOTCH_NAME_INTERN (graphCoarsenCacheExit)
+#define graphCoarsenCacheInit       SCOTCH_NAME_INTERN (graphCoarsenCacheInit)
+#define graphCoarsenCacheLeave      SCOTCH_NAME_INTERN (graphCoarsenCacheLeave)
 #define graphCoarsenMatch           SCOTCH_NAME_INTERN (graphCoarsenMatch)
+#define graphCoarsenRestore         SCOTCH_NAME_INTERN (graphCoarsenRestore)
+#define graphCoarsenSpill           SCOTCH_NAME_INTERN (graphCoarsenSpill)
+#define graphCoarsenSpillSize       SCOTCH_NAME_INTERN (graphCoarsenSpillSize)
 #define graphDiamPV                 SCOTCH_NAME_INTERN (graphDiamPV)
 #define graphDump                   SCOTCH_NAME_INTERN (graphDump)
 #define graphDump2                  SCOTCH_NAME_INTERN (graphDump2)
@@ -865,10 +901,12 @@
 #define graphMatch                  SCOTCH_NAME_INTERN (graphMatch)
 #define graphMatchInit              SCOTCH_NAME_INTERN (graphMatchInit)
 #define graphMatchNone              SCOTCH_NAME_INTERN (graphMatchNone)
+#define graphGeomLoadBgrf           SCOTCH_NAME_INTERN (graphGeomLoadBgrf)
 #define graphGeomLoadChac           SCOTCH_NAME_INTERN (graphGeomLoadChac)
 #define graphGeomLoadHabo           SCOTCH_NAME_INTERN (graphGeomLoadHabo)
 #define graphGeomLoadMmkt           SCOTCH_NAME_INTERN (graphGeomLoadMmkt)
 #define graphGeomLoadScot           SCOTCH_NAME_INTERN (graphGeomLoadScot)
+#define graphGeomSaveBgrf           SCOTCH_NAME_INTERN (graphGeomSaveBgrf)
 #define graphGeomSaveChac           SCOTCH_NAME_INTERN (graphGeomSaveChac)
 #define graphGeomSaveScot           SCOTCH_NAME_INTERN (graphGeomSaveScot)
 #define graphGeomSaveMmkt           SCOTCH_NAME_INTERN (graphGeomSaveMmkt)
@@ -951,6 +989,8 @@
 #define kgraphCheck                 SCOTCH_NAME_INTERN (kgraphCheck)
 #define kgraphBand                  SCOTCH_NAME_INTERN (kgraphBand)
 #define kgraphCost                  SCOTCH_NAME_INTERN (kgraphCost)
+#define kgraphDistExit              SCOTCH_NAME_INTERN (kgraphDistExit)
+#define kgraphDistInit              SCOTCH_NAME_INTERN (kgraphDistInit)
 #define kgraphFron                  SCOTCH_NAME_INTERN (kgraphFron)
 #define kgraphFrst                  SCOTCH_NAME_INTERN (kgraphFrst)
 #define kgraphMapBd                 SCOTCH_NAME_INTERN (kgraphMapBd)
@@ -958,7 +998,9 @@
 #define kgraphMapDf                 SCOTCH_NAME_INTERN (kgraphMapDf)
 #define kgraphMapEx                 SCOTCH_NAME_INTERN (kgraphMapEx)
 #define kgraphMapFm                 SCOTCH_NAME_INTERN (kgraphMapFm)
+#define kgraphMapGg                 SCOTCH_NAME_INTERN (kgraphMapGg)
 #define kgraphMapMl                 SCOTCH_NAME_INTERN (kgraphMapMl)
+#define kgraphMapPf                 SCOTCH_NAME_INTERN (kgraphMapPf)
 #define kgraphMapRb                 SCOTCH_NAME_INTERN (kgraphMapRb)
 #define kgraphMapRbMap              SCOTCH_NAME_INTERN (kgraphMapRbMap)
 #define kgraphMapRbBgraph           SCOTCH_NAME_INTERN (kgraphMapRbBgraph)
@@ -1056,6 +1098,9 @@
 #define threadLaunch                SCOTCH_NAME_INTERN (threadLaunch)
 #define threadReduce                SCOTCH_NAME_INTERN (threadReduce)
 #define threadScan                  SCOTCH_NAME_INTERN (threadScan)
+#define threadTaskLaunch            SCOTCH_NAME_INTERN (threadTaskLaunch)
+#define threadTaskSpawn             SCOTCH_NAME_INTERN (threadTaskSpawn)
+#define threadTaskWait              SCOTCH_NAME_INTERN (threadTaskWait)
 
 #define vdgraphseparateststratab    SCOTCH_NAME_INTERN (vdgraphseparateststratab)
 #define vdgraphCheck                SCOTCH_NAME_INTERN (vdgraphCheck)
@@ -1170,6 +1215,8 @@
 #define SCOTCH_contextBindDgraph    SCOTCH_NAME_PUBLIC (SCOTCH_contextBindDgraph)
 #define SCOTCH_contextBindGraph     SCOTCH_NAME_PUBLIC (SCOTCH_contextBindGraph)
 #define SCOTCH_contextBindMesh      SCOTCH_NAME_PUBLIC (SCOTCH_contextBindMesh)
+#define SCOTCH_contextCoarsenCacheExit SCOTCH_NAME_PUBLIC (SCOTCH_contextCoarsenCacheExit)
+#define SCOTCH_contextCoarsenCacheInit SCOTCH_NAME_PUBLIC (SCOTCH_contextCoarsenCacheInit)
 #define SCOTCH_contextExit          SCOTCH_NAME_PUBLIC (SCOTCH_contextExit)
 #define SCOTCH_contextInit          SCOTCH_NAME_PUBLIC (SCOTCH_contextInit)
 #define SCOTCH_contextOptionGetNum  SCOTCH_NAME_PUBLIC (SCOTCH_contextOptionGetNum)
@@ -1178,6 +1225,11 @@
 #define SCOTCH_contextRandomClone   SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomClone)
 #define SCOTCH_contextRandomReset   SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomReset)
 #define SCOTCH_contextRandomSeed    SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomSeed)
+#define SCOTCH_contextStatsData     SCOTCH_NAME_PUBLIC (SCOTCH_contextStatsData)
+#define SCOTCH_contextStatsExit     SCOTCH_NAME_PUBLIC (SCOTCH_contextStatsExit)
+#define SCOTCH_contextStatsInit     SCOTCH_NAME_PUBLIC (SCOTCH_contextStatsInit)
+#define SCOTCH_contextStatsNbr      SCOTCH_NAME_PUBLIC (SCOTCH_contextStatsNbr)
+#define SCOTCH_contextStatsSave     SCOTCH_NAME_PUBLIC (SCOTCH_contextStatsSave)
 #define SCOTCH_contextThreadImport1 SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadImport1)
 #define SCOTCH_contextThreadImport2 SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadImport2)
 #define SCOTCH_contextThreadSpawn   SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadSpawn)
@@ -1254,10 +1306,12 @@
 #define SCOTCH_graphDump            SCOTCH_NAME_PUBLIC (SCOTCH_graphDump)
 #define SCOTCH_graphExit            SCOTCH_NAME_PUBLIC (SCOTCH_graphExit)
 #define SCOTCH_graphFree            SCOTCH_NAME_PUBLIC (SCOTCH_graphFree)
+#define SCOTCH_graphGeomLoadBgrf    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadBgrf)
 #define SCOTCH_graphGeomLoadChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadChac)
 #define SCOTCH_graphGeomLoadHabo    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadHabo)
 #define SCOTCH_graphGeomLoadMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadMmkt)
 #define SCOTCH_graphGeomLoadScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadScot)
+#define SCOTCH_graphGeomSaveBgrf    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveBgrf)
 #define SCOTCH_graphGeomSaveChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveChac)
 #define SCOTCH_graphGeomSaveMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveMmkt)
 #define SCOTCH_graphGeomSaveScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveScot)
@@ -1270,6 +1324,7 @@
 #define SCOTCH_graphMapExit         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapExit)
 #define SCOTCH_graphMapFixed        SCOTCH_NAME_PUBLIC (SCOTCH_graphMapFixed)
 #define SCOTCH_graphMapFixedCompute SCOTCH_NAME_PUBLIC (SCOTCH_graphMapFixedCompute)
+#define SCOTCH_graphMapIncrCompute  SCOTCH_NAME_PUBLIC (SCOTCH_graphMapIncrCompute)
 #define SCOTCH_graphMapInit         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapInit)
 #define SCOTCH_graphMapLoad         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapLoad)
 #define SCOTCH_graphMapSave         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapSave)
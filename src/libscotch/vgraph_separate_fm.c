@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2014,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2014,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 01 dec 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -215,13 +215,13 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;                         /* Use hash table at 1/4 of its capacity */
 
-  if (((tablptr = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS)) == NULL) || /* Use logarithmic array only */
+  if (((tablptr = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS, grafptr->contptr)) == NULL) || /* Use logarithmic array only */
       (memAllocGroup ((void **) (void *)
                       &hashtab, (size_t) (hashsiz * sizeof (VgraphSeparateFmVertex)),
                       &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)), NULL) == NULL)) {
     errorPrint ("vgraphSeparateFm: out of memory (1)");
     if (tablptr != NULL)
-      gainTablExit (tablptr);
+      gainTablExit (tablptr, grafptr->contptr);
     return (1);
   }
   memSet (hashtab, ~0, hashsiz * sizeof (VgraphSeparateFmVertex)); /* Set all vertex numbers to ~0 */
@@ -687,7 +687,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
 
   memFree      (hashtab);                         /* Free group leader */
-  gainTablExit (tablptr);
+  gainTablExit (tablptr, grafptr->contptr);
 
   return (0);
 }
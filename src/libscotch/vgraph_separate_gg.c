@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 21 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -114,11 +114,12 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
   const Gnum                  dwg0val = grafptr->dwgttab[0]; /* Part weights */
   const Gnum                  dwg1val = grafptr->dwgttab[1];
 
-  if (((tablptr = gainTablInit (GAIN_LINMAX, VGRAPHSEPAGGSUBBITS)) == NULL) || /* Use logarithmic array only */
-      ((vexxtax = (VgraphSeparateGgVertex *) memAlloc (grafptr->s.vertnbr * sizeof (VgraphSeparateGgVertex))) == NULL)) {
+  if (((tablptr = gainTablInit (GAIN_LINMAX, VGRAPHSEPAGGSUBBITS, grafptr->contptr)) == NULL) || /* Use logarithmic array only */
+      (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                               &vexxtax, (size_t) (grafptr->s.vertnbr * sizeof (VgraphSeparateGgVertex)), NULL) == NULL)) {
     errorPrint ("vgraphSeparateGg: out of memory (1)");
     if (tablptr != NULL)
-      gainTablExit (tablptr);
+      gainTablExit (tablptr, grafptr->contptr);
     return (1);
   }
   vexxtax -= grafptr->s.baseval;                  /* Base access to vexxtax                */
@@ -242,10 +243,11 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
 
       if (permnum == 0) {                         /* If permutation has not been built yet  */
         if (permtab == NULL) {                    /* If permutation array not allocated yet */
-          if ((permtab = (Gnum *) memAlloc (grafptr->s.vertnbr * sizeof (Gnum))) == NULL) {
-            errorPrint   ("vgraphSeparateGg: out of memory (2)");
-            memFree      (vexxtax + grafptr->s.baseval);
-            gainTablExit (tablptr);
+          if (contextArenaAllocGroup (grafptr->contptr, (void **) (void *)
+                                      &permtab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)), NULL) == NULL) {
+            errorPrint       ("vgraphSeparateGg: out of memory (2)");
+            contextArenaFree (grafptr->contptr, vexxtax + grafptr->s.baseval);
+            gainTablExit     (tablptr, grafptr->contptr);
             return (1);
           }
           intAscn (permtab, grafptr->s.vertnbr, grafptr->s.baseval); /* Initialize based permutation array */
@@ -274,10 +276,10 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
     }
   }
 
-  if (permtab != NULL)                            /* Free work arrays */
-    memFree (permtab);
-  memFree      (vexxtax + grafptr->s.baseval);
-  gainTablExit (tablptr);
+  if (permtab != NULL)                            /* Free work arrays in reverse order */
+    contextArenaFree (grafptr->contptr, permtab);
+  contextArenaFree (grafptr->contptr, vexxtax + grafptr->s.baseval);
+  gainTablExit     (tablptr, grafptr->contptr);
 
   grafptr->compload[0] = (grafptr->comploaddlt + (grafptr->s.velosum - grafptr->compload[2]) * dwg0val) / (dwg0val + dwg1val);
   grafptr->compload[1] = grafptr->s.velosum - grafptr->compload[2] - grafptr->compload[0];
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011,2014,2015,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011,2014,2015,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 21 nov 2021     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -64,6 +64,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -99,7 +100,8 @@ const VgraphSeparateMlParam * const   paraptr)    /*+ Method parameters
 {
   *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
   if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr,
-                    paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
+                    paraptr->coarnbr, paraptr->coarval,
+                    GRAPHCOARSENNOCOMPACT | graphCoarsenTypeFlag (paraptr->coartype),
                     NULL, NULL, 0, finegrafptr->contptr) != 0)
     return (1);                                   /* Return if coarsening failed */
 
@@ -201,7 +203,11 @@ const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode ar
 }
 
 /* This routine recursively performs the
-** separation recursion.
+** separation recursion. When a memory budget
+** is set and exceeded once the coarser graph
+** is built, the arrays of the current graph,
+** if it is itself a coarse graph, are spilled
+** until it is uncoarsened.
 ** It returns:
 ** - 0   : if separator could be computed.
 ** - !0  : on error.
@@ -210,19 +216,43 @@ const GraphCoarsenMulti * restrict const  coarmulttab) /*+ Un-based multinode ar
 static
 int
 vgraphSeparateMl2 (
-Vgraph * restrict const             grafptr,      /* Vertex-separation graph */
-const VgraphSeparateMlParam * const paraptr)      /* Method parameters       */
+Vgraph * restrict const             grafptr,      /* Vertex-separation graph              */
+GraphCoarsenMulti ** const          multptr,      /* Its multinode array, if coarse graph */
+GraphCoarsenBudget * const          budgptr,      /* Memory budget                        */
+const VgraphSeparateMlParam * const paraptr)      /* Method parameters                    */
 {
   Vgraph                        coargrafdat;
-  GraphCoarsenMulti * restrict  coarmulttab;
+  GraphCoarsenMulti *           coarmulttab;
+  GraphCoarsenSpill             spildat;
+  size_t                        coarmemusiz;
   int                           o;
 
   if (vgraphSeparateMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = vgraphSeparateMl2         (&coargrafdat, paraptr))              == 0) &&
+    coarmemusiz = graphCoarsenSpillSize (&coargrafdat.s, NULL);
+    budgptr->memunbr += coarmemusiz;
+
+    spildat.fileptr = NULL;
+    if ((multptr != NULL) &&                      /* If current graph is a coarse graph over budget */
+        (budgptr->memumax > 0) &&
+        (budgptr->memunbr > budgptr->memumax)) {
+      if (graphCoarsenSpill (&grafptr->s, *multptr, NULL, &spildat) == 0) /* Level remains resident if it cannot be spilled */
+        budgptr->memunbr -= spildat.memusiz;
+    }
+
+    o = vgraphSeparateMl2 (&coargrafdat, &coarmulttab, budgptr, paraptr);
+
+    if (spildat.fileptr != NULL) {                /* If current graph has been spilled */
+      if (graphCoarsenRestore (&grafptr->s, multptr, NULL, &spildat) != 0)
+        o = 1;
+      budgptr->memunbr += spildat.memusiz;
+    }
+
+    if ((o == 0) &&
         ((o = vgraphSeparateMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = vgraphSeparateSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("vgraphSeparateMl2: cannot apply ascending strategy");
     vgraphExit (&coargrafdat);
+    budgptr->memunbr -= coarmemusiz;
   }
   else {                                          /* Cannot coarsen due to lack of memory or error */
     if (((o = vgraphSeparateMlUncoarsen (grafptr, NULL, NULL)) == 0) && /* Finalize graph          */
@@ -250,12 +280,18 @@ vgraphSeparateMl (
 Vgraph * const                      grafptr,      /*+ Vertex-separation graph +*/
 const VgraphSeparateMlParam * const paraptr)      /*+ Method parameters       +*/
 {
+  GraphCoarsenBudget  budgdat;
+  INT                 budgval;
   Gnum                levlnum;                    /* Save value for graph level */
   int                 o;
 
+  contextValuesGetInt (grafptr->contptr, CONTEXTOPTIONNUMMEMORYBUDGET, &budgval);
+  budgdat.memumax = (size_t) budgval * 1024;      /* Budget is expressed in kilobytes */
+  budgdat.memunbr = 0;
+
   levlnum = grafptr->levlnum;                     /* Save graph level               */
   grafptr->levlnum = 0;                           /* Initialize coarsening level    */
-  o = vgraphSeparateMl2 (grafptr, paraptr);       /* Perform multi-level separation */
+  o = vgraphSeparateMl2 (grafptr, NULL, &budgdat, paraptr); /* Perform multi-level separation */
   grafptr->levlnum = levlnum;                     /* Restore graph level            */
 
   return (o);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2013,2018,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2013,2018,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.0  : from : 16 apr 2011     **/
 /**                                 to   : 30 apr 2018     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 16 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,7 +74,7 @@ typedef struct VgraphSeparateMlParam_ {
 
 static int                  vgraphSeparateMlCoarsen (const Vgraph * const, Vgraph * const, GraphCoarsenMulti * restrict * const, const VgraphSeparateMlParam * const);
 static int                  vgraphSeparateMlUncoarsen (Vgraph * const, const Vgraph * const, const GraphCoarsenMulti * restrict const);
-static int                  vgraphSeparateMl2   (Vgraph * const, const VgraphSeparateMlParam * const);
+static int                  vgraphSeparateMl2   (Vgraph * const, GraphCoarsenMulti ** const, GraphCoarsenBudget * const, const VgraphSeparateMlParam * const);
 
 #endif /* SCOTCH_VGRAPH_SEPARATE_ML */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2014,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2014,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 01 may 2014     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -181,7 +181,7 @@ static StratParamTab        vgraphseparatestparatab[] = { /* Graph separation me
                               { VGRAPHSEPASTMETHML,  STRATPARAMCASE,   "type",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coartype,
-                                (void *) "hs" },
+                                (void *) "hscl" },
                               { VGRAPHSEPASTMETHML,  STRATPARAMINT,    "vert",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coarnbr,
@@ -224,6 +224,73 @@ StratTab                    vgraphseparateststratab = { /* Strategy tables for v
 /*                                         */
 /*******************************************/
 
+/* This routine computes the imbalance of
+** the current separator, that is, the
+** deviation of the load of part 0 with
+** respect to its weighted average, relatively
+** to it.
+** It returns:
+** - the imbalance ratio, in all cases.
+*/
+
+static
+double
+vgraphSeparateStImbalance (
+const Vgraph * restrict const grafptr)
+{
+  double              compload0avg;
+
+  compload0avg = (double) (grafptr->compload[0] + grafptr->compload[1]) * (double) grafptr->dwgttab[0] /
+                 (double) (grafptr->dwgttab[0] + grafptr->dwgttab[1]);
+  if (compload0avg <= 0.0)
+    return (0.0);
+
+  return (fabs ((double) grafptr->compload[0] - compload0avg) / compload0avg);
+}
+
+/* This routine applies the given method
+** to the given graph, and records the
+** statistics of the call in its context.
+** It returns:
+** - the value returned by the method.
+*/
+
+static
+int
+vgraphSeparateStStats (
+Vgraph * restrict const       grafptr,            /*+ Active graph to separate +*/
+const Strat * restrict const  straptr)            /*+ Method strategy node     +*/
+{
+  StatsRecord         recodat;
+  StatsRecord *       recoold;
+  int                 o;
+
+  recodat.clasptr    = "vgraph";
+  recodat.methptr    = straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr;
+  recodat.levlnum    = grafptr->levlnum;
+  recodat.vertnbr    = grafptr->s.vertnbr;
+  recodat.edgenbr    = grafptr->s.edgenbr;
+  recodat.cutvtab[0] = (double) grafptr->compload[2];
+  recodat.imbvtab[0] = vgraphSeparateStImbalance (grafptr);
+  recodat.passnbr    = -1;                        /* Not an iterative method unless it tells so */
+  recodat.passtim    = 0.0;
+  recodat.bandtim    = -1.0;                      /* No band graph built unless method tells so */
+  recodat.timeval    = clockGet ();
+  recoold            = grafptr->contptr->recoptr; /* Save record of enclosing call, if any */
+  grafptr->contptr->recoptr = &recodat;
+
+  o = ((VgraphSeparateFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+      (grafptr, (const void * const) &straptr->data.methdat.datadat);
+
+  grafptr->contptr->recoptr = recoold;
+  recodat.timeval    = clockGet () - recodat.timeval;
+  recodat.cutvtab[1] = (double) grafptr->compload[2];
+  recodat.imbvtab[1] = vgraphSeparateStImbalance (grafptr);
+  contextStatsAdd (grafptr->contptr, &recodat);   /* Statistics are not critical */
+
+  return (o);
+}
+
 /* This routine computes the separation of
 ** the given graph according to the given
 ** strategy.
@@ -325,6 +392,8 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
 #else /* SCOTCH_DEBUG_VGRAPH1 */
     default :
 #endif /* SCOTCH_DEBUG_VGRAPH1 */
+      if (grafptr->contptr->statptr != NULL)      /* If strategy statistics wanted */
+        return (vgraphSeparateStStats (grafptr, straptr));
       return (((VgraphSeparateFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
               (grafptr, (const void * const) &straptr->data.methdat.datadat));
 #ifdef SCOTCH_DEBUG_VGRAPH1
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 05 dec 2021     **/
 /**                                 to   : 05 dec 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -363,14 +363,14 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
   hashsiz = 4 * hashmax;
   hashmsk = hashsiz - 1;
 
-  if (((tablptr = gainTablInit (meshptr->m.vnlosum, VMESHSEPAFMGAINBITS)) == NULL) ||
+  if (((tablptr = gainTablInit (meshptr->m.vnlosum, VMESHSEPAFMGAINBITS, meshptr->contptr)) == NULL) ||
       (memAllocGroup ((void **) (void *)
                       &helmtab, (size_t) (hashsiz * sizeof (VmeshSeparateFmElement)),
                       &hnodtab, (size_t) (hashsiz * sizeof (VmeshSeparateFmNode)),
                       &movetab, (size_t) (hashmax * sizeof (VmeshSeparateFmSave)), NULL) == NULL)) {
     if (tablptr != NULL) {
       errorPrint   ("vmeshSeparateFm: out of memory (1)");
-      gainTablExit (tablptr);
+      gainTablExit (tablptr, meshptr->contptr);
     }
     return (1);
   }
@@ -439,7 +439,7 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
             if (vmeshSeparateFmResize (tablptr, &helmtab, &hnodtab, &movetab, savenbr, &lockptr, NULL, hashmax) != 0) {
               errorPrint   ("vmeshSeparateFm: cannot resize arrays (1)");
               memFree      (helmtab);             /* Free group leader */
-              gainTablExit (tablptr);
+              gainTablExit (tablptr, meshptr->contptr);
               return (1);
             }
             hashmax <<= 1;
@@ -650,7 +650,7 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
               if (vmeshSeparateFmResize (tablptr, &helmtab, &hnodtab, &movetab, savenbr, &lockptr, &sepaptr, hashmax) != 0) {
                 errorPrint   ("vmeshSeparateFm: cannot resize arrays (2)");
                 memFree      (helmtab);           /* Free group leader */
-                gainTablExit (tablptr);
+                gainTablExit (tablptr, meshptr->contptr);
                 return (1);
               }
               hashmax <<= 1;
@@ -754,7 +754,7 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
                 if (vmeshSeparateFmResize (tablptr, &helmtab, &hnodtab, &movetab, savenbr, &lockptr, &sepaptr, hashmax) != 0) {
                   errorPrint   ("vmeshSeparateFm: cannot resize arrays (3)");
                   memFree      (helmtab);         /* Free group leader */
-                  gainTablExit (tablptr);
+                  gainTablExit (tablptr, meshptr->contptr);
                   return (1);
                 }
                 hashmax <<= 1;
@@ -1043,7 +1043,7 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
   meshptr->ncmpsize[0]  = meshptr->m.vnodnbr - fronnum - meshptr->ncmpsize[1];
 
   memFree      (helmtab);                         /* Free group leader */
-  gainTablExit (tablptr);
+  gainTablExit (tablptr, meshptr->contptr);
 
 #ifdef SCOTCH_DEBUG_VMESH2
   if (vmeshCheck (meshptr) != 0) {
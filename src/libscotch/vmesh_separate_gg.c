@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2019,2020,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2019,2020,2021,2023-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.1  : from : 05 dec 2021     **/
 /**                                 to   : 05 dec 2021     **/
 /**                # Version 7.0  : from : 13 sep 2019     **/
-/**                                 to   : 09 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -111,14 +111,14 @@ const VmeshSeparateGgParam * restrict const paraptr) /*+ Method parameters    +*
   }
 
   velssiz = (meshptr->m.vnlotax == NULL) ? 0 : meshptr->m.velmnbr; /*  Compute size of vertex load sum array */
-  if (((tablptr = gainTablInit (GAINMAX, VMESHSEPAGGSUBBITS)) == NULL) || /* Use logarithmic array only      */
+  if (((tablptr = gainTablInit (GAINMAX, VMESHSEPAGGSUBBITS, meshptr->contptr)) == NULL) || /* Use logarithmic array only      */
       ((vexxtab = (byte *) memAllocGroup ((void **) (void *)
                                           &velxtax, (size_t) (meshptr->m.velmnbr * sizeof (VmeshSeparateGgElem)),
                                           &vnoxtax, (size_t) (meshptr->m.vnodnbr * sizeof (VmeshSeparateGgNode)),
                                           &velitax, (size_t) (meshptr->m.velmnbr * sizeof (Gnum)),
                                           &velstax, (size_t) (velssiz            * sizeof (Gnum)), NULL)) == NULL)) {
     if (tablptr != NULL)
-      gainTablExit (tablptr);
+      gainTablExit (tablptr, meshptr->contptr);
     errorPrint ("vmeshSeparateGg: out of memory (1)");
     return (1);
   }
@@ -365,7 +365,7 @@ next:                                             /* Select next root element sy
           if ((permtab = (Gnum *) memAlloc (meshptr->m.velmnbr * sizeof (Gnum))) == NULL) {
             errorPrint   ("vmeshSeparateGg: out of memory (2)");
             memFree      (vexxtab);
-            gainTablExit (tablptr);
+            gainTablExit (tablptr, meshptr->contptr);
             return (1);
           }
           intAscn (permtab, meshptr->m.velmnbr, meshptr->m.velmbas); /* Initialize permutation array with based element indices */
@@ -436,7 +436,7 @@ next:                                             /* Select next root element sy
   if (permtab != NULL)
     memFree (permtab);
   memFree      (vexxtab);                         /* Free group leader */
-  gainTablExit (tablptr);
+  gainTablExit (tablptr, meshptr->contptr);
 
   return (0);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2007-2013,2018,2020,2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2013,2018,2020,2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 30 jul 2020     **/
 /**                                 to   : 18 dec 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 09 jul 2025     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -382,7 +382,7 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
   savedat.savenbr = 0;                            /* No moves saved (yet) */
 
-  if (((tablptr = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS)) == NULL) || /* Use logarithmic array only         */
+  if (((tablptr = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS, grafptr->contptr)) == NULL) || /* Use logarithmic array only         */
       ((nplstab = memAlloc ((partnbr + 1) * sizeof (WgraphPartFmPartList))) == NULL) || /* TRICK: +1 for frontier */
       ((hashdat.hashtab = memAlloc (hashdat.hashsiz * sizeof (WgraphPartFmVertex))) == NULL) ||
       ((linkdat.linktab = memAlloc (linkdat.linksiz * sizeof (WgraphPartFmLink)))   == NULL) ||
@@ -397,7 +397,7 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
         }
         memFree (nplstab);
       }
-      gainTablExit (tablptr);
+      gainTablExit (tablptr, grafptr->contptr);
     }
     return (1);
   }
@@ -1023,7 +1023,7 @@ abort:
   memFree (linkdat.linktab);
   memFree (hashdat.hashtab);
   memFree (nplstab - 1);                          /* TRICK: array starts one cell before */
-  gainTablExit (tablptr);
+  gainTablExit (tablptr, grafptr->contptr);
 
   return (o);
 }
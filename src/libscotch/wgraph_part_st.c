@@ -1,4 +1,4 @@
-/* Copyright 2007-2011,2018,2020,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2011,2018,2020,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 25 aug 2020     **/
 /**                                 to   : 26 nov 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -177,6 +177,85 @@ StratTab                    wgraphpartststratab = { /* Strategy tables for overl
 /*                                           */
 /*********************************************/
 
+/* This routine computes the imbalance of
+** the current partition, that is, the largest
+** deviation of the load of a part with
+** respect to the average part load, relatively
+** to it.
+** It returns:
+** - the imbalance ratio, in all cases.
+*/
+
+static
+double
+wgraphPartStImbalance (
+const Wgraph * restrict const grafptr)
+{
+  Anum                partnum;
+  Gnum                comploadsum;
+  double              comploadavg;
+  double              imbaval;
+
+  for (partnum = 0, comploadsum = 0; partnum < grafptr->partnbr; partnum ++)
+    comploadsum += grafptr->compload[partnum];
+  if (comploadsum <= 0)
+    return (0.0);
+
+  comploadavg = (double) comploadsum / (double) grafptr->partnbr;
+  for (partnum = 0, imbaval = 0.0; partnum < grafptr->partnbr; partnum ++) {
+    double              imbatmp;
+
+    imbatmp = fabs ((double) grafptr->compload[partnum] - comploadavg) / comploadavg;
+    if (imbaval < imbatmp)
+      imbaval = imbatmp;
+  }
+
+  return (imbaval);
+}
+
+/* This routine applies the given method
+** to the given graph, and records the
+** statistics of the call in its context.
+** It returns:
+** - the value returned by the method.
+*/
+
+static
+int
+wgraphPartStStats (
+Wgraph * restrict const       grafptr,            /*+ Active graph to partition +*/
+const Strat * restrict const  straptr)            /*+ Method strategy node      +*/
+{
+  StatsRecord         recodat;
+  StatsRecord *       recoold;
+  int                 o;
+
+  recodat.clasptr    = "wgraph";
+  recodat.methptr    = straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr;
+  recodat.levlnum    = grafptr->levlnum;
+  recodat.vertnbr    = grafptr->s.vertnbr;
+  recodat.edgenbr    = grafptr->s.edgenbr;
+  recodat.cutvtab[0] = (double) grafptr->fronload;
+  recodat.imbvtab[0] = wgraphPartStImbalance (grafptr);
+  recodat.passnbr    = -1;                        /* Not an iterative method unless it tells so */
+  recodat.passtim    = 0.0;
+  recodat.bandtim    = -1.0;                      /* No band graph built unless method tells so */
+  recodat.timeval    = clockGet ();
+  recoold            = grafptr->contptr->recoptr; /* Save record of enclosing call, if any */
+  grafptr->contptr->recoptr = &recodat;
+
+  o = ((WgraphPartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+      (grafptr, (const void * const) &straptr->data.methdat.datadat);
+
+  grafptr->contptr->recoptr = recoold;
+  recodat.timeval    = clockGet () - recodat.timeval;
+  recodat.cutvtab[1] = (double) grafptr->fronload;
+  recodat.imbvtab[1] = wgraphPartStImbalance (grafptr);
+  contextStatsAdd (grafptr->contptr, &recodat);   /* Statistics are not critical */
+
+  return (o);
+}
+
 /* This routine computes the separation of
 ** the given graph according to the given
 ** strategy.
@@ -270,6 +349,8 @@ const Strat * restrict const straptr)             /*+ Overlap partitioning strat
 #else /* SCOTCH_DEBUG_WGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
+      if (grafptr->contptr->statptr != NULL)      /* If strategy statistics wanted */
+        return (wgraphPartStStats (grafptr, straptr));
       return (((WgraphPartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
               (grafptr, (const void * const) &straptr->data.methdat.datadat));
 #ifdef SCOTCH_DEBUG_WGRAPH2
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.0  : from : 29 may 2010     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 10 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -130,6 +130,7 @@ static const char *         C_usageList[] = {     /* Usage */
   "  -V         : Print program version and copyright",
   "  -v<verb>   : Set verbose mode to <verb>:",
   "                 m  : mapping information",
+  "                 p  : strategy method statistics (JSON)",
   "                 s  : strategy information",
   "                 t  : timing information",
   "",
@@ -335,6 +336,10 @@ char *                      argv[])
               case 'm' :
                 flagval |= C_FLAGVERBMAP;
                 break;
+              case 'P' :
+              case 'p' :
+                flagval |= C_FLAGVERBSTA;
+                break;
               case 'S' :
               case 's' :
                 flagval |= C_FLAGVERBSTR;
@@ -434,6 +439,9 @@ char *                      argv[])
   }
 
   SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat);
+  if ((flagval & C_FLAGVERBSTA) &&                /* If method statistics wanted */
+      (SCOTCH_contextStatsInit (&contdat) != 0))
+    errorPrint ("main: cannot enable statistics");
 
   clockStop  (&runtime[0]);                       /* Get input time */
   clockInit  (&runtime[1]);
@@ -489,6 +497,8 @@ char *                      argv[])
              (double) clockVal (&runtime[0]) +
              (double) clockVal (&runtime[1]));
   }
+  if (flagval & C_FLAGVERBSTA)
+    SCOTCH_contextStatsSave (&contdat, C_filepntrlogout);
   if ((flagval & C_FLAGPARTOVL) != 0) {           /* If overlap partitioning wanted */
     if (flagval & C_FLAGVERBMAP)
       SCOTCH_graphPartOvlView (&grafdat, C_partNbr, parttab, C_filepntrlogout);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 30 oct 2019     **/
 /**                                 to   : 30 oct 2019     **/
 /**                # Version 7.0  : from : 23 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,6 +100,7 @@ static const char *         C_usageList[] = {
   "  -t<file>   : Save partitioning tree data to <file>",
   "  -V         : Print program version and copyright",
   "  -v<verb>   : Set verbose mode to <verb> :",
+  "                 p  : strategy method statistics (JSON)",
   "                 s  : strategy information",
   "                 t  : timing information",
   "",
@@ -213,6 +214,10 @@ char *                      argv[])
         case 'v' :                               /* Output control info */
           for (j = 2; argv[i][j] != '\0'; j ++) {
             switch (argv[i][j]) {
+              case 'P' :
+              case 'p' :
+                flagval |= C_FLAGVERBSTA;
+                break;
               case 'S' :
               case 's' :
                 flagval |= C_FLAGVERBSTR;
@@ -249,6 +254,9 @@ char *                      argv[])
   }
 
   SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat);
+  if ((flagval & C_FLAGVERBSTA) &&                /* If method statistics wanted */
+      (SCOTCH_contextStatsInit (&contdat) != 0))
+    errorPrint ("main: cannot enable statistics");
 
   clockStop  (&runtime[0]);                       /* Get input time */
   clockInit  (&runtime[1]);
@@ -288,6 +296,8 @@ char *                      argv[])
              (double) clockVal (&runtime[0]) +
              (double) clockVal (&runtime[1]));
   }
+  if (flagval & C_FLAGVERBSTA)
+    SCOTCH_contextStatsSave (&contdat, C_filepntrlogout);
 
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2014 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2014,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,6 +47,8 @@
 /**                                 to   : 27 dec 2004     **/
 /**                # Version 6.0  : from : 12 nov 2014     **/
 /**                                 to   : 12 nov 2014     **/
+/**                # Version 7.0  : from : 18 oct 2026     **/
+/**                                 to   : 18 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,3 +80,4 @@
 #define C_FLAGTREOUT                0x0002        /* Output separator tree data */
 #define C_FLAGVERBSTR               0x0004        /* Output strategy string     */
 #define C_FLAGVERBTIM               0x0008        /* Output timing information  */
+#define C_FLAGVERBSTA               0x0010        /* Output method statistics   */